@@ -85,8 +85,7 @@ struct Genode::Time_source : Interface
  * example, in a Timer-session server. If this is not the case, the classes
  * Periodic_timeout and One_shot_timeout are the better choice.
  */
-class Genode::Timeout : private Noncopyable,
-                        public Genode::List<Timeout>::Element
+class Genode::Timeout : private Noncopyable
 {
 	friend class Timeout_scheduler;
 
@@ -102,6 +101,11 @@ class Genode::Timeout : private Noncopyable,
 		bool                   _in_discard_blockade { false };
 		Blockade               _discard_blockade    { };
 
+		/* membership in a slot of the scheduler's timing wheel */
+		Timeout               *_wheel_prev          { nullptr };
+		Timeout               *_wheel_next          { nullptr };
+		Timeout              **_wheel_slot          { nullptr };
+
 		Timeout(Timeout const &);
 
 		Timeout &operator = (Timeout const &);
@@ -128,6 +132,16 @@ class Genode::Timeout : private Noncopyable,
 
 /**
  * Multiplexes one time source amongst different timeouts
+ *
+ * Scheduled timeouts are kept in a hierarchical timing wheel. The lowest
+ * level has one slot per tick of 2^TICK_SHIFT microseconds, each slot of a
+ * higher level spans a whole revolution of the level below. A timeout
+ * enters the lowest level whose current revolution covers its deadline and
+ * is moved down level by level as the wheel reaches its slot. Timeouts that
+ * lie beyond the range of the topmost level wait in an overflow list that is
+ * re-examined once per revolution of that level. Thus, scheduling and
+ * discarding a timeout takes constant time, independent of the number of
+ * scheduled timeouts.
  */
 class Genode::Timeout_scheduler : private Noncopyable,
                                   public  Timeout_handler
@@ -140,20 +154,47 @@ class Genode::Timeout_scheduler : private Noncopyable,
 
 		static constexpr uint64_t max_sleep_time_us { 60'000'000 };
 
+		enum {
+			TICK_SHIFT   = 10,
+			SLOT_SHIFT   = 6,
+			NR_OF_SLOTS  = 1 << SLOT_SHIFT,
+			SLOT_MASK    = NR_OF_SLOTS - 1,
+			NR_OF_LEVELS = 4,
+		};
+
 		Mutex               _mutex              { };
 		Time_source        &_time_source;
 		Microseconds const  _max_sleep_time     { min(_time_source.max_timeout().value, max_sleep_time_us) };
-		List<Timeout>       _timeouts           { };
+		Timeout            *_slots[NR_OF_LEVELS][NR_OF_SLOTS] { };
+		uint64_t            _occupied[NR_OF_LEVELS] { };
+		Timeout            *_overflow           { nullptr };
+		uint64_t            _wheel_tick         { 0 };
+		uint64_t            _wakeup_us          { ~(uint64_t)0 };
 		Microseconds        _current_time       { 0 };
 		bool                _destructor_called  { false };
 		Microseconds        _rate_limit_period;
 		Microseconds        _rate_limit_deadline;
 
-		void _insert_into_timeouts_list(Timeout &timeout);
+		bool _wheel_empty() const;
+
+		void _insert_into_wheel(Timeout &timeout);
+
+		void _remove_from_wheel(Timeout &timeout);
+
+		void _reinsert_slot(Timeout *&slot);
+
+		Timeout *_any_timeout() const;
+
+		uint64_t _next_event_tick() const;
+
+		uint64_t _next_deadline() const;
+
+		void _advance_wheel(List<List_element<Timeout> > &pending_timeouts);
 
 		void _set_time_source_timeout();
 
-		void _set_time_source_timeout(uint64_t duration_us);
+		void _set_time_source_timeout(uint64_t curr_time_us,
+		                              uint64_t deadline_us);
 
 		void _schedule_timeout(Timeout         &timeout,
 		                       Microseconds     duration,
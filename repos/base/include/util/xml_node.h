@@ -232,6 +232,70 @@ class Genode::Xml_node
 		 */
 		typedef Xml_attribute Attribute;
 
+		/**
+		 * Offset table of the nodes of an XML document
+		 *
+		 * By default, each 'Xml_node' searches its end tag when constructed,
+		 * which rescans the node's content each time a sub node is visited.
+		 * An index records the node structure of a whole document in a single
+		 * pass instead. Nodes obtained from an indexed node look up their end
+		 * tags and siblings in the index without scanning the content.
+		 *
+		 * The index is stored in memory provided by the caller, which must
+		 * outlive all nodes obtained from it. If the memory does not suffice
+		 * or the document is not well-formed, the node falls back to the
+		 * unindexed mode, which behaves the same but is slower.
+		 */
+		class Index : Noncopyable
+		{
+			public:
+
+				struct Entry
+				{
+					uint32_t start;         /* offset of start tag */
+					uint32_t end;           /* offset of end tag */
+					uint32_t first_child;   /* entry of first sub node */
+					uint32_t next;          /* entry of next sibling */
+					uint32_t num_sub_nodes;
+				};
+
+			private:
+
+				friend class Xml_node;
+
+				/*
+				 * Noncopyable
+				 */
+				Index(Index const &);
+				Index &operator = (Index const &);
+
+				Entry  * const _entries;
+				size_t   const _capacity;
+
+				size_t      _count   = 0;
+				char const *_addr    = nullptr;
+				size_t      _max_len = 0;
+
+				Entry const &_entry(unsigned i) const { return _entries[i]; }
+
+			public:
+
+				/**
+				 * Constructor
+				 *
+				 * \param entries      backing store of the index
+				 * \param num_entries  capacity in number of XML nodes
+				 */
+				Index(Entry *entries, size_t num_entries)
+				: _entries(entries), _capacity(num_entries) { }
+
+				/**
+				 * Return number of indexed nodes, or 0 if the last document
+				 * could not be indexed
+				 */
+				size_t num_nodes() const { return _count; }
+		};
+
 	private:
 
 		class Tag
@@ -539,6 +603,131 @@ class Genode::Xml_node
 			return Tag();
 		}
 
+		static bool _names_match(Tag const &a, Tag const &b)
+		{
+			return a.name().len() == b.name().len()
+			    && !strcmp(a.name().start(), b.name().start(), a.name().len());
+		}
+
+		/**
+		 * Index the XML node starting with 'start_tag' and all its sub nodes
+		 *
+		 * \return  end tag or invalid tag, like '_search_end_tag'
+		 *
+		 * The document is scanned once in the same way as '_search_end_tag'
+		 * scans the root node. In contrast to '_search_end_tag', each end tag
+		 * is checked against its start tag at any depth. If this check fails
+		 * or the index is exhausted, the index is left empty and the end tag
+		 * is searched in the regular way.
+		 *
+		 * While a node is open, its 'end' field holds the entry of its parent
+		 * and its 'next' field holds the entry of its last sub node, which
+		 * spares a separate stack.
+		 */
+		static Tag _build_index(Index &index, char const *addr, size_t max_len,
+		                        Tag start_tag, int &sub_nodes_count)
+		{
+			typedef Index::Entry Entry;
+
+			index._count   = 0;
+			index._addr    = addr;
+			index._max_len = max_len;
+
+			Entry * const e = index._entries;
+
+			auto fallback = [&] ()
+			{
+				index._count = 0;
+				return _search_end_tag(start_tag, sub_nodes_count);
+			};
+
+			auto offset = [&] (Tag const &tag) {
+				return (size_t)(tag.token().start() - addr); };
+
+			if (!start_tag.node() || index._capacity == 0
+			 || offset(start_tag) > ~0U)
+				return fallback();
+
+			uint32_t const root_start = (uint32_t)offset(start_tag);
+			e[0] = { root_start, root_start, 0, 0, 0 };
+
+			if (start_tag.type() == Tag::EMPTY) {
+				index._count = 1;
+				return start_tag;
+			}
+
+			size_t   count = 1;
+			uint32_t open  = 0;
+			Token    curr_token = start_tag.next_token();
+
+			while (curr_token.type() != Token::END) {
+
+				Comment curr_comment(curr_token);
+				if (curr_comment.valid()) {
+					curr_token = curr_comment.next_token();
+					continue;
+				}
+
+				Tag curr_tag(curr_token);
+				if (curr_tag.type() == Tag::INVALID) {
+					curr_token = curr_token.next();
+					continue;
+				}
+
+				if (offset(curr_tag) > ~0U)
+					return fallback();
+
+				uint32_t const curr_offset = (uint32_t)offset(curr_tag);
+
+				if (curr_tag.node()) {
+
+					if (count == index._capacity)
+						return fallback();
+
+					uint32_t const n = (uint32_t)count++;
+					Entry &parent = e[open];
+
+					if (parent.num_sub_nodes)
+						e[parent.next].next = n;
+					else
+						parent.first_child = n;
+
+					parent.next = n;
+					parent.num_sub_nodes++;
+
+					if (curr_tag.type() == Tag::START) {
+						e[n] = { curr_offset, open, 0, 0, 0 };
+						open = n;
+					} else {
+						e[n] = { curr_offset, curr_offset, 0, 0, 0 };
+					}
+
+				} else {
+
+					Entry &node = e[open];
+
+					Tag const node_start(Token(addr + node.start, max_len - node.start));
+					if (!_names_match(node_start, curr_tag))
+						return fallback();
+
+					uint32_t const parent = node.end;
+
+					node.end  = curr_offset;
+					node.next = 0;
+
+					if (open == 0) {
+						index._count    = count;
+						sub_nodes_count = e[0].num_sub_nodes;
+						return curr_tag;
+					}
+					open = parent;
+				}
+
+				curr_token = curr_tag.next_token();
+			}
+			return fallback();
+		}
+
 		/**
 		 * Find next non-whitespace and non-comment token
 		 */
@@ -578,8 +767,89 @@ class Genode::Xml_node
 				start(skip_non_tag_characters(Token(addr, max_len))),
 				end(_search_end_tag(start, num_sub_nodes))
 			{ }
+
+			Tags(Index &index, char const *addr, size_t max_len)
+			:
+				start(skip_non_tag_characters(Token(addr, max_len))),
+				end(_build_index(index, addr, max_len, start, num_sub_nodes))
+			{ }
+
+			Tags(Index const &index, Index::Entry const &e)
+			:
+				num_sub_nodes((int)e.num_sub_nodes),
+				start(Token(index._addr + e.start, index._max_len - e.start)),
+				end  (Token(index._addr + e.end,   index._max_len - e.end))
+			{ }
 		} _tags;
 
+		Index const *_index = nullptr;  /* index of document, if any */
+		unsigned     _entry = 0;        /* index entry of this node */
+
+		/**
+		 * Create node from index entry
+		 *
+		 * \param at  start of the node, which precedes the start tag by the
+		 *            characters skipped when creating the node unindexed
+		 */
+		Xml_node(Index const &index, unsigned entry, char const *at)
+		:
+			_addr(at), _max_len(index._max_len - (at - index._addr)),
+			_tags(index, index._entry(entry)), _index(&index), _entry(entry)
+		{ }
+
+		Index::Entry const &_indexed() const { return _index->_entry(_entry); }
+
+		/**
+		 * Return true if siblings of the node are known from the index
+		 *
+		 * The root node of an index is not followed by indexed siblings.
+		 */
+		bool _indexed_siblings() const { return _index && _entry != 0; }
+
+		Xml_node _indexed_node(unsigned entry) const
+		{
+			return Xml_node(*_index, entry,
+			                _index->_addr + _index->_entry(entry).start);
+		}
+
+		/**
+		 * Return indexed sub node
+		 *
+		 * The first sub node starts at the content base.
+		 */
+		Xml_node _indexed_sub_node(unsigned entry) const
+		{
+			if (entry == _indexed().first_child)
+				return Xml_node(*_index, entry, _content_base());
+
+			return _indexed_node(entry);
+		}
+
+		bool _indexed_has_type(unsigned entry, char const *type) const
+		{
+			if (!type)
+				return true;
+
+			Index::Entry const &e = _index->_entry(entry);
+			Tag const tag(Token(_index->_addr + e.start, _index->_max_len - e.start));
+
+			return !strcmp(type, tag.name().start(), tag.name().len())
+			    && strlen(type) == tag.name().len();
+		}
+
+		/**
+		 * Return index entry of first sub node of 'type' starting at 'entry'
+		 *
+		 * \return  entry, or 0 if no such node exists
+		 */
+		unsigned _indexed_find(unsigned entry, char const *type) const
+		{
+			for (; entry && !_indexed_has_type(entry, type);
+			     entry = _index->_entry(entry).next);
+
+			return entry;
+		}
+
 		/**
 		 * Return true if specified buffer contains a valid XML node
 		 */
@@ -638,6 +908,27 @@ class Genode::Xml_node
 				throw Invalid_syntax();
 		}
 
+		/**
+		 * Constructor that indexes the XML document
+		 *
+		 * \param index  index populated with the nodes of the document
+		 *
+		 * The index is rebuilt from scratch, which invalidates all nodes
+		 * obtained from a previous use of 'index'.
+		 *
+		 * \throw Invalid_syntax
+		 */
+		Xml_node(Index &index, char const *addr, size_t max_len = ~0UL)
+		:
+			_addr(addr), _max_len(max_len), _tags(index, addr, max_len)
+		{
+			if (!_valid(_tags))
+				throw Invalid_syntax();
+
+			if (index.num_nodes())
+				_index = &index;
+		}
+
 		/**
 		 * Return size of node including start and end tags in bytes
 		 */
@@ -752,6 +1043,13 @@ class Genode::Xml_node
 		 */
 		Xml_node next() const
 		{
+			if (_indexed_siblings()) {
+				if (!_indexed().next)
+					throw Nonexistent_sub_node();
+
+				return _indexed_node(_indexed().next);
+			}
+
 			Token after_node = _tags.end.next_token();
 			after_node = skip_non_tag_characters(after_node);
 			try {
@@ -779,6 +1077,9 @@ class Genode::Xml_node
 		 */
 		bool last(char const *type = nullptr) const
 		{
+			if (_indexed_siblings())
+				return !_indexed_find(_indexed().next, type);
+
 			Token after = _tags.end.next_token();
 			after = skip_non_tag_characters(after);
 
@@ -804,6 +1105,17 @@ class Genode::Xml_node
 		 */
 		Xml_node sub_node(unsigned idx = 0U) const
 		{
+			if (_index) {
+				unsigned entry = _indexed().first_child;
+				for (; entry && idx > 0; idx--)
+					entry = _index->_entry(entry).next;
+
+				if (entry)
+					return _indexed_sub_node(entry);
+
+				throw Nonexistent_sub_node();
+			}
+
 			if (_tags.num_sub_nodes > 0) {
 				try {
 					Xml_node curr_node = _node_at(_content_base());
@@ -822,6 +1134,14 @@ class Genode::Xml_node
 		 */
 		Xml_node sub_node(char const *type) const
 		{
+			if (_index) {
+				unsigned const entry = _indexed_find(_indexed().first_child, type);
+				if (entry)
+					return _indexed_sub_node(entry);
+
+				throw Nonexistent_sub_node();
+			}
+
 			if (_tags.num_sub_nodes > 0) {
 
 				/* search for sub node of specified type */
@@ -854,6 +1174,13 @@ class Genode::Xml_node
 		template <typename FN>
 		void for_each_sub_node(char const *type, FN const &fn) const
 		{
+			if (_index) {
+				for (unsigned entry = _indexed_find(_indexed().first_child, type);
+				     entry; entry = _indexed_find(_index->_entry(entry).next, type))
+					fn(_indexed_sub_node(entry));
+				return;
+			}
+
 			if (!has_sub_node(type))
 				return;
 
@@ -977,6 +1304,9 @@ class Genode::Xml_node
 		 */
 		bool has_sub_node(char const *type) const
 		{
+			if (_index)
+				return _indexed_find(_indexed().first_child, type) != 0;
+
 			if (_tags.num_sub_nodes == 0)
 				return false;
 
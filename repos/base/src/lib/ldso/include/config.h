@@ -49,6 +49,7 @@ class Linker::Config : Noncopyable
 
 		bool const _verbose     = _config.attribute_value("ld_verbose",     false);
 		bool const _check_ctors = _config.attribute_value("ld_check_ctors", true);
+		bool const _reloc_stats = _config.attribute_value("ld_relocation_stats", false);
 
 	public:
 
@@ -58,6 +59,8 @@ class Linker::Config : Noncopyable
 		bool verbose()     const { return _verbose; }
 		bool check_ctors() const { return _check_ctors; }
 
+		bool relocation_stats() const { return _reloc_stats; }
+
 		typedef String<100> Rom_name;
 
 		/**
@@ -20,6 +20,8 @@
 
 namespace Linker {
 	struct Hash_table;
+	struct Gnu_hash_table;
+	struct Symbol_hash;
 	struct Dynamic;
 }
 
@@ -53,6 +55,100 @@ struct Linker::Hash_table
 };
 
 
+/**
+ * GNU-style hash table (DT_GNU_HASH)
+ *
+ * The table covers only the symbols starting at 'symoffset', which are the
+ * symbols defined by the object. A bloom filter rejects most lookups of
+ * symbols not defined by the object without touching the buckets. Each chain
+ * entry carries the hash value of its symbol with the lowest bit marking the
+ * end of the chain, so that names are compared only for likely matches.
+ */
+struct Linker::Gnu_hash_table
+{
+	uint32_t const nbuckets;
+	uint32_t const symoffset;
+	uint32_t const bloom_size;
+	uint32_t const bloom_shift;
+
+	Elf::Addr const *bloom()   const { return (Elf::Addr const *)(this + 1); }
+	uint32_t  const *buckets() const { return (uint32_t const *)(bloom() + bloom_size); }
+
+	/**
+	 * Return chain entry of symbol, 'sym_index' must be >= 'symoffset'
+	 */
+	uint32_t chain(unsigned long sym_index) const {
+		return (buckets() + nbuckets)[sym_index - symoffset]; }
+
+	/**
+	 * Hash function of the GNU toolchain (Bernstein)
+	 */
+	static uint32_t hash(char const *name)
+	{
+		unsigned const char *p = (unsigned char const *)name;
+		uint32_t             h = 5381;
+
+		while (*p)
+			h = (h << 5) + h + *p++;
+
+		return h;
+	}
+
+	/**
+	 * Return false if the object definitely lacks a symbol of 'hash'
+	 */
+	bool bloom_match(uint32_t hash) const
+	{
+		enum { WORD_BITS = sizeof(Elf::Addr)*8 };
+
+		/* the bloom size is a power of two */
+		Elf::Addr const word = bloom()[(hash / WORD_BITS) & (bloom_size - 1)];
+		Elf::Addr const mask = ((Elf::Addr)1 << (hash % WORD_BITS))
+		                     | ((Elf::Addr)1 << ((hash >> bloom_shift) % WORD_BITS));
+
+		return (word & mask) == mask;
+	}
+
+	/**
+	 * Return number of symbols of the dynamic symbol table
+	 *
+	 * In contrast to the ELF hash table, the number is not stored explicitly
+	 * but results from the end of the chain of the highest bucket.
+	 */
+	unsigned long symbol_count() const
+	{
+		unsigned long last = 0;
+		for (unsigned long i = 0; i < nbuckets; i++)
+			if (buckets()[i] > last)
+				last = buckets()[i];
+
+		if (last < symoffset)
+			return symoffset;
+
+		while (!(chain(last) & 1))
+			last++;
+
+		return last + 1;
+	}
+};
+
+
+/**
+ * Hash values of a symbol name for both hash-table formats
+ *
+ * The values are computed once per lookup and used for all objects of the
+ * lookup scope.
+ */
+struct Linker::Symbol_hash
+{
+	unsigned long const elf;
+	uint32_t      const gnu;
+
+	Symbol_hash(char const *name)
+	: elf(Hash_table::hash(name)), gnu(Gnu_hash_table::hash(name)) { }
+};
+
+
 /**
  * .dynamic section entries
  */
@@ -94,6 +190,8 @@ class Linker::Dynamic
 		Allocator           *_md_alloc      = nullptr;
 
 		Hash_table          *_hash_table    = nullptr;
+		Gnu_hash_table      *_gnu_hash_table = nullptr;
+		unsigned long        _symbol_count  = 0;
 
 		Elf::Rela           *_reloca        = nullptr;
 		unsigned long        _reloca_size   = 0;
@@ -158,6 +256,7 @@ class Linker::Dynamic
 				case DT_PLTRELSZ: _pltrel_size = d->un.val;                             break;
 				case DT_PLTGOT  : _section<typeof(_pltgot)>(&_pltgot, d);               break;
 				case DT_HASH    : _section<typeof(_hash_table)>(&_hash_table, d);       break;
+				case DT_GNU_HASH: _section<typeof(_gnu_hash_table)>(&_gnu_hash_table, d); break;
 				case DT_RELA    : _section<typeof(_reloca)>(&_reloca, d);               break;
 				case DT_RELASZ  : _reloca_size = d->un.val;                             break;
 				case DT_SYMTAB  : _section<typeof(_symtab)>(&_symtab, d);               break;
@@ -173,6 +272,84 @@ class Linker::Dynamic
 					break;
 				}
 			}
+
+			if (_hash_table)
+				_symbol_count = _hash_table->nchains();
+			else if (_gnu_hash_table)
+				_symbol_count = _gnu_hash_table->symbol_count();
+		}
+
+		/**
+		 * Return true if 'sym' is a definition of the symbol 'name'
+		 */
+		bool _defines(Elf::Sym const &sym, char const *name) const
+		{
+			/* this omitts everything but 'NOTYPE', 'OBJECT', and 'FUNC' */
+			if (sym.type() > STT_FUNC)
+				return false;
+
+			if (sym.st_value == 0)
+				return false;
+
+			/* check for symbol name */
+			char const *sym_name = symbol_name(sym);
+			return name[0] == sym_name[0] && !strcmp(name, sym_name);
+		}
+
+		Elf::Sym const *_lookup_elf_hash(char const *name, unsigned long hash) const
+		{
+			Hash_table *h = _hash_table;
+
+			if (!h->buckets())
+				return nullptr;
+
+			unsigned long sym_index = h->buckets()[hash % h->nbuckets()];
+
+			/* traverse hash chain */
+			for (; sym_index != STN_UNDEF; sym_index = h->chains()[sym_index])
+			{
+				/* bad object */
+				if (sym_index > h->nchains())
+					return nullptr;
+
+				Elf::Sym const *sym = symbol(sym_index);
+
+				if (sym && _defines(*sym, name))
+					return sym;
+			}
+
+			return nullptr;
+		}
+
+		Elf::Sym const *_lookup_gnu_hash(char const *name, uint32_t hash) const
+		{
+			Gnu_hash_table const &h = *_gnu_hash_table;
+
+			if (!h.nbuckets || !h.bloom_match(hash))
+				return nullptr;
+
+			unsigned long sym_index = h.buckets()[hash % h.nbuckets];
+
+			/* empty bucket */
+			if (sym_index < h.symoffset)
+				return nullptr;
+
+			/* traverse hash chain, the lowest bit marks its end */
+			for (; sym_index < _symbol_count; sym_index++) {
+
+				uint32_t const chain = h.chain(sym_index);
+
+				if (((chain ^ hash) >> 1) == 0) {
+					Elf::Sym const *sym = symbol((unsigned)sym_index);
+					if (sym && _defines(*sym, name))
+						return sym;
+				}
+
+				if (chain & 1)
+					break;
+			}
+
+			return nullptr;
 		}
 
 	public:
@@ -216,7 +393,7 @@ class Linker::Dynamic
 
 		Elf::Sym const *symbol(unsigned sym_index) const
 		{
-			if (sym_index > _hash_table->nchains())
+			if (sym_index >= _symbol_count)
 				return nullptr;
 
 			return _symtab + sym_index;
@@ -234,46 +411,30 @@ class Linker::Dynamic
 		Dependency const &dep() const { return *_dep; }
 
 		/*
-		 * Use DT_HASH table address for linker, assuming that it will always be at
-		 * the beginning of the file
+		 * Use the hash-table address for linker, assuming that it will always be
+		 * at the beginning of the file
 		 */
-		Elf::Addr link_map_addr() const { return trunc_page((Elf::Addr)_hash_table); }
+		Elf::Addr link_map_addr() const
+		{
+			return trunc_page(_hash_table ? (Elf::Addr)_hash_table
+			                              : (Elf::Addr)_gnu_hash_table);
+		}
 
 		/**
 		 * Lookup symbol name in this ELF
+		 *
+		 * The GNU hash table is preferred. It lacks the undefined symbols
+		 * though, which are still visible via the ELF hash table if 'undef'
+		 * is requested.
 		 */
-		Elf::Sym const *lookup_symbol(char const *name, unsigned long hash) const
+		Elf::Sym const *lookup_symbol(char const *name, Symbol_hash const &hash,
+		                              bool undef = false) const
 		{
-			Hash_table *h = _hash_table;
+			if (_gnu_hash_table && !(undef && _hash_table))
+				return _lookup_gnu_hash(name, hash.gnu);
 
-			if (!h->buckets())
-				return nullptr;
-
-			unsigned long sym_index = h->buckets()[hash % h->nbuckets()];
-
-			/* traverse hash chain */
-			for (; sym_index != STN_UNDEF; sym_index = h->chains()[sym_index])
-			{
-				/* bad object */
-				if (sym_index > h->nchains())
-					return nullptr;
-
-				Elf::Sym const *sym      = symbol(sym_index);
-				char const     *sym_name = symbol_name(*sym);
-
-				/* this omitts everything but 'NOTYPE', 'OBJECT', and 'FUNC' */
-				if (sym->type() > STT_FUNC)
-					continue;
-
-				if (sym->st_value == 0)
-					continue;
-
-				/* check for symbol name */
-				if (name[0] != sym_name[0] || strcmp(name, sym_name))
-					continue;
-
-				return sym;
-			}
+			if (_hash_table)
+				return _lookup_elf_hash(name, hash.elf);
 
 			return nullptr;
 		}
@@ -285,7 +446,7 @@ class Linker::Dynamic
 		{
 			addr_t const reloc_base = _obj.reloc_base();
 
-			for (unsigned long i = 0; i < _hash_table->nchains(); i++)
+			for (unsigned long i = 0; i < _symbol_count; i++)
 			{
 				Elf::Sym const *sym = symbol(i);
 				if (!sym)
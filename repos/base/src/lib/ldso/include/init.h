@@ -14,6 +14,10 @@
 #ifndef _INCLUDE__INIT_H_
 #define _INCLUDE__INIT_H_
 
+/* Genode includes */
+#include <trace/timestamp.h>
+
+/* local includes */
 #include <linker.h>
 
 
@@ -30,6 +34,21 @@ struct Linker::Init : List<Object>
 	bool in_progress = false;
 	bool restart     = false;
 
+	static void _relocate_with_stats(Object &obj, Bind bind)
+	{
+		Lookup_stats     const before = lookup_stats();
+		Trace::Timestamp const start  = Trace::timestamp();
+
+		obj.relocate(bind);
+
+		Trace::Timestamp const end    = Trace::timestamp();
+		Lookup_stats     const after  = lookup_stats();
+
+		log("LD: relocated ", obj.name(), " in ", end - start, " ticks, ",
+		    after.lookups - before.lookups, " lookups, ",
+		    after.cache_hits - before.cache_hits, " cache hits");
+	}
+
 	static Init *list()
 	{
 		static Init _list;
@@ -82,7 +101,11 @@ struct Linker::Init : List<Object>
 		for (; obj; obj = obj->next_init()) {
 			if (verbose_relocation)
 				log("Relocate ", obj->name());
-			obj->relocate(bind);
+
+			if (relocation_stats)
+				_relocate_with_stats(*obj, bind);
+			else
+				obj->relocate(bind);
 		}
 
 		/*
@@ -48,6 +48,20 @@ namespace Linker {
 	 */
 	extern bool verbose;
 
+	/**
+	 * Report the relocation costs of each object
+	 *
+	 * The value corresponds to the config attribute "ld_relocation_stats".
+	 */
+	extern bool relocation_stats;
+
+	/**
+	 * Number of symbol lookups by name and the share answered by the cache
+	 */
+	struct Lookup_stats { unsigned long lookups, cache_hits; };
+
+	Lookup_stats lookup_stats();
+
 	/**
 	 * Stage of execution
 	 *
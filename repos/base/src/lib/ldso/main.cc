@@ -46,6 +46,7 @@ namespace Linker {
 static    Binary *binary_ptr = nullptr;
 static    Parent *parent_ptr = nullptr;
 bool      Linker::verbose  = false;
+bool      Linker::relocation_stats = false;
 Stage     Linker::stage    = STAGE_BINARY;
 Link_map *Link_map::first;
 
@@ -76,6 +77,130 @@ Genode::Mutex &Linker::shared_object_mutex()
 }
 
 
+/**
+ * Cache of symbols resolved by name
+ *
+ * Many relocations refer to the same symbols, e.g., the GLOB_DAT and
+ * JUMP_SLOT relocations of a function, or the references of all libraries of
+ * a program to 'memcpy'. The direct-mapped cache remembers the result of a
+ * lookup by name and lookup scope, which is the first dependency of the
+ * root object.
+ *
+ * The result of a lookup depends on the set of loaded objects, e.g., for
+ * weak symbols, and the cached names point into the string tables of the
+ * objects. Hence, the cache is flushed whenever an object is loaded or
+ * unloaded.
+ */
+class Symbol_cache : Noncopyable
+{
+	private:
+
+		enum { SLOTS_LOG2 = 10, SLOTS = 1 << SLOTS_LOG2 };
+
+		struct Entry
+		{
+			Dependency const *scope;
+			char       const *name;
+			Elf::Sym   const *symbol;
+			Elf::Addr         base;
+			unsigned          generation;
+			uint32_t          hash;
+			bool              undef;
+		};
+
+		/*
+		 * The cache is used by the initial relocation, lazy binding, and
+		 * the relocation of objects loaded at runtime, which are not
+		 * serialized by the same mutex.
+		 */
+		Mutex _mutex { };
+
+		Entry _entries[SLOTS] { };
+
+		/* entries of older generations are invalid */
+		unsigned _generation = 1;
+
+		Lookup_stats _stats { 0, 0 };
+
+		Entry &_entry(uint32_t hash, Dependency const &scope)
+		{
+			unsigned long const key = hash ^ ((addr_t)&scope >> 4);
+			return _entries[(key * 2654435761UL) % SLOTS];
+		}
+
+	public:
+
+		Elf::Sym const *lookup(char const *name, uint32_t hash,
+		                       Dependency const &scope, bool undef,
+		                       Elf::Addr *base)
+		{
+			Mutex::Guard guard(_mutex);
+
+			_stats.lookups++;
+
+			Entry const &e = _entry(hash, scope);
+
+			if (e.generation != _generation || e.hash != hash
+			 || e.scope != &scope || e.undef != undef)
+				return nullptr;
+
+			if (e.name != name && strcmp(e.name, name))
+				return nullptr;
+
+			_stats.cache_hits++;
+
+			*base = e.base;
+			return e.symbol;
+		}
+
+		void insert(char const *name, uint32_t hash, Dependency const &scope,
+		            bool undef, Elf::Sym const *symbol, Elf::Addr base)
+		{
+			Mutex::Guard guard(_mutex);
+
+			_entry(hash, scope) = { .scope      = &scope,
+			                        .name       = name,
+			                        .symbol     = symbol,
+			                        .base       = base,
+			                        .generation = _generation,
+			                        .hash       = hash,
+			                        .undef      = undef };
+		}
+
+		void flush()
+		{
+			Mutex::Guard guard(_mutex);
+			_generation++;
+		}
+
+		Lookup_stats stats()
+		{
+			Mutex::Guard guard(_mutex);
+			return _stats;
+		}
+};
+
+
+/*
+ * The cache is constructed not before the linker is relocated, lookups of the
+ * linker's own relocation bypass the cache.
+ */
+static Symbol_cache *symbol_cache_ptr = nullptr;
+
+
+static void flush_symbol_cache()
+{
+	if (symbol_cache_ptr)
+		symbol_cache_ptr->flush();
+}
+
+
+Lookup_stats Linker::lookup_stats()
+{
+	return symbol_cache_ptr ? symbol_cache_ptr->stats() : Lookup_stats { 0, 0 };
+}
+
+
 /**************************************************************
  ** ELF object types (shared object, dynamic binaries, ldso  **
  **************************************************************/
@@ -145,6 +270,8 @@ class Linker::Elf_object : public Object, private Fifo<Elf_object>::Element
 			with_object_list([&] (Object_list &list) {
 				list.enqueue(*this); });
 
+			flush_symbol_cache();
+
 			/* add to link map */
 			Debug::state_change(Debug::ADD, nullptr);
 			setup_link_map();
@@ -168,6 +295,8 @@ class Linker::Elf_object : public Object, private Fifo<Elf_object>::Element
 			with_object_list([&] (Object_list &list) {
 				list.remove(*this); });
 			Init::list()->remove(this);
+
+			flush_symbol_cache();
 		}
 
 		/**
@@ -189,9 +318,10 @@ class Linker::Elf_object : public Object, private Fifo<Elf_object>::Element
 			return _dyn.symbol_name(sym);
 		}
 
-		Elf::Sym const *lookup_symbol(char const *name, unsigned long hash) const
+		Elf::Sym const *lookup_symbol(char const *name, Symbol_hash const &hash,
+		                              bool undef) const
 		{
-			return _dyn.lookup_symbol(name, hash);
+			return _dyn.lookup_symbol(name, hash, undef);
 		}
 
 		/**
@@ -516,8 +646,8 @@ void genode_exit(int status)
 
 Elf::Addr Linker::Object::_symbol_address(char const *name)
 {
-	unsigned long   hash = Hash_table::hash(name);
-	Elf::Sym const *sym  = dynamic().lookup_symbol(name, hash);
+	Symbol_hash const hash(name);
+	Elf::Sym    const *sym = dynamic().lookup_symbol(name, hash);
 
 	if (sym)
 		return reloc_base() + sym->st_value;
@@ -582,11 +712,11 @@ Elf::Sym const *Linker::lookup_symbol(unsigned sym_index, Dependency const &dep,
 }
 
 
-Elf::Sym const *Linker::lookup_symbol(char const *name, Dependency const &dep,
-                                      Elf::Addr *base, bool undef, bool other)
+static Elf::Sym const *lookup_uncached(char const *name, Symbol_hash const &hash,
+                                       Dependency const &dep, Elf::Addr *base,
+                                       bool undef, bool other)
 {
 	Dependency const *curr        = &dep.first();
-	unsigned long     hash        = Hash_table::hash(name);
 	Elf::Sym   const *weak_symbol = 0;
 	Elf::Addr        weak_base    = 0;
 	Elf::Sym   const *symbol      = 0;
@@ -599,7 +729,7 @@ Elf::Sym const *Linker::lookup_symbol(char const *name, Dependency const &dep,
 
 		Elf_object const &elf = static_cast<Elf_object const &>(curr->obj());
 
-		if ((symbol = elf.lookup_symbol(name, hash)) && (symbol->st_value || undef)) {
+		if ((symbol = elf.lookup_symbol(name, hash, undef)) && (symbol->st_value || undef)) {
 
 			if (dep.root() && verbose_lookup)
 				log("LD: lookup ", name, " obj_src ", elf.name(),
@@ -624,7 +754,7 @@ Elf::Sym const *Linker::lookup_symbol(char const *name, Dependency const &dep,
 	/* try searching binary's dependencies */
 	if (!weak_symbol && dep.root()) {
 		if (binary_ptr && &dep != binary_ptr->first_dep()) {
-			return lookup_symbol(name, *binary_ptr->first_dep(), base, undef, other);
+			return lookup_uncached(name, hash, *binary_ptr->first_dep(), base, undef, other);
 		} else {
 			throw Not_found(name);
 		}
@@ -641,6 +771,29 @@ Elf::Sym const *Linker::lookup_symbol(char const *name, Dependency const &dep,
 }
 
 
+Elf::Sym const *Linker::lookup_symbol(char const *name, Dependency const &dep,
+                                      Elf::Addr *base, bool undef, bool other)
+{
+	Symbol_hash const hash(name);
+
+	/* lookups that skip the requesting object are rare (copy relocations) */
+	if (!symbol_cache_ptr || other)
+		return lookup_uncached(name, hash, dep, base, undef, other);
+
+	Dependency const &scope = dep.first();
+
+	if (Elf::Sym const *symbol = symbol_cache_ptr->lookup(name, hash.gnu, scope,
+	                                                      undef, base))
+		return symbol;
+
+	Elf::Sym const *symbol = lookup_uncached(name, hash, dep, base, undef, other);
+
+	symbol_cache_ptr->insert(name, hash.gnu, scope, undef, symbol, *base);
+
+	return symbol;
+}
+
+
 /********************
  ** Initialization **
  ********************/
@@ -731,6 +884,8 @@ void Genode::init_ldso_phdr(Env &env)
 	/* load program headers of linker now */
 	if (!Ld::linker().file())
 		Ld::linker().load_phdr(env, *heap());
+
+	symbol_cache_ptr = unmanaged_singleton<Symbol_cache>();
 }
 
 void Genode::exec_static_constructors()
@@ -803,7 +958,8 @@ void Component::construct(Genode::Env &env)
 	/* read configuration */
 	Config const config(env);
 
-	verbose = config.verbose();
+	verbose          = config.verbose();
+	relocation_stats = config.relocation_stats();
 
 	parent_ptr = &env.parent();
 
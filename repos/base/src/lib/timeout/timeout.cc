@@ -78,6 +78,7 @@ void Timeout_scheduler::handle_timeout(Duration curr_time)
 				               _current_time.value },
 				*this);
 
+			_wakeup_us = _rate_limit_deadline.value;
 			return;
 		}
 		_rate_limit_deadline.value = _current_time.value +
@@ -85,20 +86,12 @@ void Timeout_scheduler::handle_timeout(Duration curr_time)
 
 		/*
 		 * Filter out all pending timeouts to a local list first. The
-		 * processing of pending timeouts can have effects on the '_timeouts'
-		 * list and these would interfere with the filtering if we would do
+		 * processing of pending timeouts can have effects on the timing
+		 * wheel and these would interfere with the filtering if we would do
 		 * it all in the same loop.
 		 */
-		while (Timeout *timeout = _timeouts.first()) {
+		_advance_wheel(pending_timeouts);
 
-			timeout->_mutex.acquire();
-			if (timeout->_deadline.value > _current_time.value) {
-				timeout->_mutex.release();
-				break;
-			}
-			_timeouts.remove(timeout);
-			pending_timeouts.insert(&timeout->_pending_timeouts_le);
-		}
 		/*
 		 * Do the framework-internal processing of the pending timeouts and
 		 * then release their mutexes.
@@ -153,9 +146,9 @@ void Timeout_scheduler::handle_timeout(Duration curr_time)
 				if (deadline_us < _current_time.value) {
 					deadline_us = ~(uint64_t)0;
 				}
-				/* re-insert timeout into timeouts list */
+				/* re-insert timeout into the timing wheel */
 				timeout._deadline = Microseconds { deadline_us };
-				_insert_into_timeouts_list(timeout);
+				_insert_into_wheel(timeout);
 			}
 			timeout._mutex.release();
 		}
@@ -223,7 +216,7 @@ Timeout_scheduler::~Timeout_scheduler()
 	_destructor_called = true;
 
 	/* discard all scheduled timeouts */
-	while (Timeout *timeout = _timeouts.first()) {
+	while (Timeout *timeout = _any_timeout()) {
 		Mutex::Guard const timeout_guard { timeout->_mutex };
 		_discard_timeout_unsynchronized(*timeout);
 	}
@@ -242,15 +235,16 @@ void Timeout_scheduler::_enable()
 
 void Timeout_scheduler::_set_time_source_timeout()
 {
-	_set_time_source_timeout(
-		_timeouts.first() ?
-			_timeouts.first()->_deadline.value - _current_time.value :
-			~(uint64_t)0);
+	_set_time_source_timeout(_current_time.value, _next_deadline());
 }
 
 
-void Timeout_scheduler::_set_time_source_timeout(uint64_t duration_us)
+void Timeout_scheduler::_set_time_source_timeout(uint64_t curr_time_us,
+                                                 uint64_t deadline_us)
 {
+	uint64_t duration_us {
+		deadline_us > curr_time_us ? deadline_us - curr_time_us : 0 };
+
 	if (duration_us < _rate_limit_period.value) {
 		duration_us = _rate_limit_period.value;
 	}
@@ -258,6 +252,7 @@ void Timeout_scheduler::_set_time_source_timeout(uint64_t duration_us)
 		duration_us = _max_sleep_time.value;
 	}
 	_time_source.set_timeout(Microseconds(duration_us), *this);
+	_wakeup_us = curr_time_us + duration_us;
 }
 
 
@@ -297,52 +292,235 @@ void Timeout_scheduler::_schedule_timeout(Timeout         &timeout,
 
 	/* prevent inserting a timeout twice */
 	if (timeout._handler != nullptr) {
-		_timeouts.remove(&timeout);
+		_remove_from_wheel(timeout);
 	}
 	/* determine timeout deadline */
 	uint64_t const curr_time_us {
 		_time_source.curr_time().trunc_to_plain_us().value };
 
+	/*
+	 * An empty wheel may have been idle for long. Let it start at the
+	 * current time so that the new timeout does not needlessly end up in
+	 * the overflow list or in a high level.
+	 */
+	if (_wheel_empty()) {
+		_wheel_tick = max(_wheel_tick, curr_time_us >> TICK_SHIFT);
+	}
+
 	uint64_t const deadline_us {
 		duration.value <= ~(uint64_t)0 - curr_time_us ?
 			curr_time_us + duration.value : ~(uint64_t)0 };
 
-	/* set up timeout object and insert into timeouts list */
+	/* set up timeout object and insert into the timing wheel */
 	timeout._handler = &handler;
 	timeout._deadline = Microseconds { deadline_us };
 	timeout._period = period;
-	_insert_into_timeouts_list(timeout);
+	_insert_into_wheel(timeout);
 
 	/*
-	 * If the new timeout is the first to trigger, we have to  update the
-	 * time-source timeout.
+	 * If the new timeout triggers before the time source would wake us up,
+	 * we have to update the time-source timeout.
 	 */
-	if (_timeouts.first() == &timeout) {
-		_set_time_source_timeout(deadline_us - curr_time_us);
+	if (deadline_us < _wakeup_us) {
+		_set_time_source_timeout(curr_time_us, deadline_us);
 	}
 }
 
 
-void Timeout_scheduler::_insert_into_timeouts_list(Timeout &timeout)
+bool Timeout_scheduler::_wheel_empty() const
 {
-	/* if timeout list is empty, insert as first element */
-	if (_timeouts.first() == nullptr) {
-		_timeouts.insert(&timeout);
+	for (uint64_t const occupied : _occupied) {
+		if (occupied) {
+			return false;
+		}
+	}
+	return _overflow == nullptr;
+}
+
+
+void Timeout_scheduler::_insert_into_wheel(Timeout &timeout)
+{
+	uint64_t tick { timeout._deadline.value >> TICK_SHIFT };
+	if (tick < _wheel_tick) {
+		tick = _wheel_tick;
+	}
+	/*
+	 * Use the lowest level whose current revolution covers the tick. As the
+	 * tick is not covered by the current slot of the level below, the slot
+	 * lies ahead of the current slot of the level.
+	 */
+	Timeout **slot { &_overflow };
+	for (unsigned level { 0 }; level < NR_OF_LEVELS; level++) {
+
+		unsigned const shift { level * SLOT_SHIFT };
+		if ((tick         >> (shift + SLOT_SHIFT)) !=
+		    (_wheel_tick  >> (shift + SLOT_SHIFT))) {
+			continue;
+		}
+		unsigned const idx { (unsigned)(tick >> shift) & SLOT_MASK };
+		slot = &_slots[level][idx];
+		_occupied[level] |= (uint64_t)1 << idx;
+		break;
+	}
+	timeout._wheel_slot = slot;
+	timeout._wheel_prev = nullptr;
+	timeout._wheel_next = *slot;
+	if (*slot) {
+		(*slot)->_wheel_prev = &timeout;
+	}
+	*slot = &timeout;
+}
+
+
+void Timeout_scheduler::_remove_from_wheel(Timeout &timeout)
+{
+	Timeout **const slot { timeout._wheel_slot };
+	if (!slot) {
 		return;
 	}
-	/* if timeout has the shortest deadline, insert as first element */
-	if (_timeouts.first()->_deadline.value >= timeout._deadline.value) {
-		_timeouts.insert(&timeout);
+	if (timeout._wheel_prev) {
+		timeout._wheel_prev->_wheel_next = timeout._wheel_next;
+	} else {
+		*slot = timeout._wheel_next;
+	}
+	if (timeout._wheel_next) {
+		timeout._wheel_next->_wheel_prev = timeout._wheel_prev;
+	}
+	timeout._wheel_slot = nullptr;
+	timeout._wheel_prev = nullptr;
+	timeout._wheel_next = nullptr;
+
+	if (*slot || slot == &_overflow) {
 		return;
 	}
-	/* find list element with next shorter deadline and insert behind it */
-	Timeout *curr_timeout { _timeouts.first() };
-	for (;
-	     curr_timeout->next() != nullptr &&
-	     curr_timeout->next()->_deadline.value < timeout._deadline.value;
-	     curr_timeout = curr_timeout->_next);
-
-	_timeouts.insert(&timeout, curr_timeout);
+	size_t const pos { (size_t)(slot - &_slots[0][0]) };
+	_occupied[pos / NR_OF_SLOTS] &= ~((uint64_t)1 << (pos % NR_OF_SLOTS));
+}
+
+
+void Timeout_scheduler::_reinsert_slot(Timeout *&slot)
+{
+	Timeout *timeout { slot };
+	while (timeout) {
+		Timeout *const next { timeout->_wheel_next };
+		_remove_from_wheel(*timeout);
+		_insert_into_wheel(*timeout);
+		timeout = next;
+	}
+}
+
+
+Timeout *Timeout_scheduler::_any_timeout() const
+{
+	for (unsigned level { 0 }; level < NR_OF_LEVELS; level++) {
+		if (_occupied[level]) {
+			return _slots[level][__builtin_ctzll(_occupied[level])];
+		}
+	}
+	return _overflow;
+}
+
+
+uint64_t Timeout_scheduler::_next_event_tick() const
+{
+	/*
+	 * Slots at or behind the current slot of a level are always empty
+	 * except for the current slot of the lowest level. Hence, the first
+	 * occupied slot of a level starting from the current one marks the
+	 * next event of the level. This is either the expiration of timeouts
+	 * (lowest level) or the moving down of timeouts (higher levels).
+	 */
+	for (unsigned level { 0 }; level < NR_OF_LEVELS; level++) {
+
+		unsigned const shift { level * SLOT_SHIFT };
+		unsigned const curr  { (unsigned)(_wheel_tick >> shift) & SLOT_MASK };
+		uint64_t const slots { _occupied[level] & (~(uint64_t)0 << curr) };
+		if (!slots) {
+			continue;
+		}
+		uint64_t const revolution {
+			(_wheel_tick >> (shift + SLOT_SHIFT)) << (shift + SLOT_SHIFT) };
+
+		return max(_wheel_tick, revolution |
+		           ((uint64_t)__builtin_ctzll(slots) << shift));
+	}
+	if (_overflow) {
+		unsigned const shift { NR_OF_LEVELS * SLOT_SHIFT };
+		return ((_wheel_tick >> shift) + 1) << shift;
+	}
+	return ~(uint64_t)0;
+}
+
+
+uint64_t Timeout_scheduler::_next_deadline() const
+{
+	uint64_t const tick { _next_event_tick() };
+	if (tick == ~(uint64_t)0) {
+		return ~(uint64_t)0;
+	}
+	/*
+	 * Timeouts that are still to be moved down provide only a lower bound
+	 * for their deadlines. We wake up at that bound, move them down, and
+	 * determine the next deadline anew.
+	 */
+	unsigned const idx { (unsigned)tick & SLOT_MASK };
+	if ((tick >> SLOT_SHIFT) != (_wheel_tick >> SLOT_SHIFT) ||
+	    !(_occupied[0] & ((uint64_t)1 << idx))) {
+		return tick << TICK_SHIFT;
+	}
+	uint64_t deadline_us { ~(uint64_t)0 };
+	for (Timeout const *timeout { _slots[0][idx] };
+	     timeout != nullptr;
+	     timeout = timeout->_wheel_next) {
+
+		deadline_us = min(deadline_us, timeout->_deadline.value);
+	}
+	return deadline_us;
+}
+
+
+void Timeout_scheduler::_advance_wheel(List<List_element<Timeout> > &pending_timeouts)
+{
+	uint64_t const curr_tick { _current_time.value >> TICK_SHIFT };
+	while (true) {
+
+		/* collect the expired timeouts of the current tick */
+		Timeout *timeout { _slots[0][_wheel_tick & SLOT_MASK] };
+		while (timeout) {
+
+			Timeout *const next { timeout->_wheel_next };
+			if (timeout->_deadline.value <= _current_time.value) {
+				_remove_from_wheel(*timeout);
+				timeout->_mutex.acquire();
+				pending_timeouts.insert(&timeout->_pending_timeouts_le);
+			}
+			timeout = next;
+		}
+		if (_wheel_tick >= curr_tick) {
+			break;
+		}
+		/* skip all ticks without events at once */
+		uint64_t const next_tick { _next_event_tick() };
+		if (next_tick > curr_tick) {
+			_wheel_tick = curr_tick;
+			break;
+		}
+		_wheel_tick = next_tick;
+
+		/* move down the timeouts of the slots that the wheel has reached */
+		unsigned const top_shift { NR_OF_LEVELS * SLOT_SHIFT };
+		if (!(_wheel_tick & (((uint64_t)1 << top_shift) - 1))) {
+			_reinsert_slot(_overflow);
+		}
+		for (unsigned level { NR_OF_LEVELS - 1 }; level > 0; level--) {
+
+			unsigned const shift { level * SLOT_SHIFT };
+			if (_wheel_tick & (((uint64_t)1 << shift) - 1)) {
+				continue;
+			}
+			_reinsert_slot(_slots[level][(_wheel_tick >> shift) & SLOT_MASK]);
+		}
+	}
 }
 
 
@@ -393,7 +571,7 @@ void Timeout_scheduler::_discard_timeout_unsynchronized(Timeout &timeout)
 		timeout._mutex.acquire();
 		timeout._in_discard_blockade = false;
 	}
-	_timeouts.remove(&timeout);
+	_remove_from_wheel(timeout);
 	timeout._handler = nullptr;
 }
 
@@ -368,6 +368,44 @@ static void test_decoded_content(Env        &env,
 }
 
 
+/**
+ * Check that an indexed node is equivalent to the unindexed one
+ */
+static bool equivalent(Xml_node const &a, Xml_node const &b)
+{
+	if (a.differs_from(b) || a.num_sub_nodes() != b.num_sub_nodes()
+	 || a.content_size() != b.content_size() || a.last() != b.last())
+		return false;
+
+	for (unsigned i = 0; i < a.num_sub_nodes(); i++)
+		if (!equivalent(a.sub_node(i), b.sub_node(i)))
+			return false;
+
+	unsigned count = 0;
+	a.for_each_sub_node("program", [&] (Xml_node const &) { count++; });
+	b.for_each_sub_node("program", [&] (Xml_node const &) { count--; });
+
+	return count == 0;
+}
+
+
+static void test_indexed(const char *xml_string, size_t capacity)
+{
+	static Xml_node::Index::Entry entries[32];
+	Xml_node::Index index(entries, min(capacity, sizeof(entries)/sizeof(entries[0])));
+
+	try {
+		Xml_node indexed(index, xml_string);
+
+		log("indexed nodes: ", index.num_nodes(), ", ",
+		    equivalent(Xml_node(xml_string), indexed) ? "equivalent"
+		                                              : "not equivalent");
+	} catch (Xml_node::Invalid_syntax) {
+		log("string has invalid XML syntax");
+	}
+}
+
+
 void Component::construct(Genode::Env &env)
 {
 	log("--- XML-token test ---");
@@ -420,6 +458,14 @@ void Component::construct(Genode::Env &env)
 	}
 	log("");
 
+	log("-- Test indexed XML nodes --");
+	test_indexed(xml_test_valid,              ~0UL);
+	test_indexed(xml_test_comments,           ~0UL);
+	test_indexed(xml_test_text_between_nodes, ~0UL);
+	test_indexed(xml_test_valid,              4);
+	test_indexed(xml_test_truncated,          ~0UL);
+	log("");
+
 	log("--- End of XML-parser test ---");
 	env.parent().exit(0);
 }
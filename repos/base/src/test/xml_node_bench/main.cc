@@ -0,0 +1,131 @@
+/*
+ * \brief  Benchmark for traversing large XML documents
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_ram_dataspace.h>
+#include <base/log.h>
+#include <util/xml_generator.h>
+#include <util/xml_node.h>
+#include <timer_session/connection.h>
+
+using namespace Genode;
+
+
+struct Main
+{
+	enum { XML_SIZE    = 16*1024*1024,
+	       MAX_ENTRIES = 1024*1024 };
+
+	typedef Xml_node::Index::Entry Entry;
+
+	Env &_env;
+
+	Timer::Connection _timer { _env };
+
+	Attached_ram_dataspace _xml_ds   { _env.ram(), _env.rm(), XML_SIZE };
+	Attached_ram_dataspace _index_ds { _env.ram(), _env.rm(),
+	                                   MAX_ENTRIES*sizeof(Entry) };
+
+	Xml_node::Index _index { _index_ds.local_addr<Entry>(), MAX_ENTRIES };
+
+	char const *_xml() { return _xml_ds.local_addr<char const>(); }
+
+	/**
+	 * Generate 'width' sub nodes per node down to 'depth'
+	 */
+	static void _generate(Xml_generator &xml, unsigned depth, unsigned width)
+	{
+		for (unsigned i = 0; i < width; i++) {
+			if (depth == 0) {
+				xml.node("leaf", [&] () {
+					xml.attribute("index", i);
+					xml.append_content("content"); });
+				continue;
+			}
+			xml.node("node", [&] () {
+				xml.attribute("index", i);
+				_generate(xml, depth - 1, width); });
+		}
+	}
+
+	void _generate(unsigned depth, unsigned width)
+	{
+		Xml_generator xml(_xml_ds.local_addr<char>(), XML_SIZE, "config", [&] () {
+			_generate(xml, depth, width); });
+	}
+
+	static unsigned long _count_recursively(Xml_node const &node)
+	{
+		unsigned long count = 1;
+		node.for_each_sub_node([&] (Xml_node const &sub_node) {
+			count += _count_recursively(sub_node); });
+		return count;
+	}
+
+	static unsigned long _count_by_index(Xml_node const &node)
+	{
+		unsigned long count = 0;
+		for (unsigned i = 0; i < node.num_sub_nodes(); i++)
+			count += node.sub_node(i).num_sub_nodes();
+		return count;
+	}
+
+	template <typename FN>
+	void _measure(char const *what, FN const &fn)
+	{
+		uint64_t const start_us = _timer.elapsed_us();
+		unsigned long const result = fn();
+		uint64_t const end_us = _timer.elapsed_us();
+
+		log("  ", what, ": ", result, " nodes in ", (end_us - start_us)/1000, " ms");
+	}
+
+	void _benchmark(char const *name, unsigned depth, unsigned width)
+	{
+		_generate(depth, width);
+
+		log(name, " document (depth=", depth, ", width=", width, ", ",
+		    Xml_node(_xml()).size()/1024, " KiB)");
+
+		_measure("plain for_each_sub_node", [&] () {
+			return _count_recursively(Xml_node(_xml())); });
+
+		_measure("plain sub_node(idx)", [&] () {
+			return _count_by_index(Xml_node(_xml())); });
+
+		_measure("indexed for_each_sub_node", [&] () {
+			return _count_recursively(Xml_node(_index, _xml())); });
+
+		_measure("indexed sub_node(idx)", [&] () {
+			return _count_by_index(Xml_node(_index, _xml())); });
+
+		if (_index.num_nodes() == 0)
+			error("document could not be indexed");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- XML node benchmark ---");
+
+		_benchmark("deep",  12, 2);
+		_benchmark("wide",  1, 300);
+		_benchmark("large", 3, 16);
+
+		log("--- XML node benchmark finished ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Env &env) { static Main main(env); }
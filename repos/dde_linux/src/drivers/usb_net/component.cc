@@ -60,8 +60,7 @@ bool Session_component::_send()
 
 void Session_component::_handle_rx()
 {
-	while (_rx.source()->ack_avail())
-		_rx.source()->release_packet(_rx.source()->get_acked_packet());
+	_release_acked_rx_packets();
 }
 
 
@@ -16,11 +16,22 @@
 
 #include <base/output.h>
 #include <base/allocator.h>
+#include <util/construct_at.h>
+#include <util/misc_math.h>
 
 
 namespace Genode { template <typename, typename> class Lru_cache; }
 
 
+/**
+ * Cache with a least-recently-used eviction policy
+ *
+ * The elements are indexed by a hash table and ordered by their recency of
+ * use in a doubly-linked list. So looking up, touching, and evicting an
+ * element takes constant time. 'KEY' must have a 'value' member that can be
+ * compared via '==' and hashed. Unsigned integer values are hashed
+ * directly. Any other value type must provide a 'hash()' method.
+ */
 template <typename KEY, typename ELEM>
 class Genode::Lru_cache : Noncopyable
 {
@@ -28,22 +39,28 @@ class Genode::Lru_cache : Noncopyable
 
 		struct Stats
 		{
-			unsigned hits, evictions;
+			unsigned hits, misses, evictions;
 
 			void print(Output &out) const
 			{
-				Genode::print(out, "hits: ", hits, ", evictions: ", evictions);
+				Genode::print(out, "hits: ", hits, ", misses: ", misses,
+				                   ", evictions: ", evictions);
 			}
 		};
 
 	private:
 
-		struct Time { unsigned value; };
+		/*
+		 * Noncopyable
+		 */
+		Lru_cache(Lru_cache const &);
+		Lru_cache &operator = (Lru_cache const &);
+
+		class Element;
 
 		Allocator     &_alloc;
 		unsigned const _max_elements;
 		unsigned       _used_elements = 0;
-		Time           _now { 0 };
 		Stats          _stats { };
 
 		class Tag
@@ -52,80 +69,98 @@ class Genode::Lru_cache : Noncopyable
 
 				KEY const _key;
 
-				Time _last_used;
+				unsigned long const _hash;
+
+				/* chaining within the hash bucket */
+				Element *_bucket_next = nullptr;
+
+				/* neighbours in the recency list */
+				Element *_newer = nullptr;
+				Element *_older = nullptr;
 
-				Tag(KEY const &key, Time now) : _key(key), _last_used(now) { }
+				Tag(KEY const &key, unsigned long hash) : _key(key), _hash(hash) { }
 		};
 
 		/*
-		 * The '_key' and '_last_used' attributes are supplemented as the 'Tag'
-		 * base class to the 'Element'instead of being 'Element' member
-		 * variables to allow 'ELEM' to be at the trailing end of the object.
-		 * This way, 'ELEM' can be a variable-length type (using a flexible
-		 * array member).
+		 * The '_key', '_hash', and list-pointer attributes are supplemented
+		 * as the 'Tag' base class to the 'Element' instead of being 'Element'
+		 * member variables to allow 'ELEM' to be at the trailing end of the
+		 * object. This way, 'ELEM' can be a variable-length type (using a
+		 * flexible array member).
 		 */
 
-		class Element : private Tag, private Avl_node<Element>, public ELEM
+		class Element : private Tag, public ELEM
 		{
 			private:
 
-				friend class Avl_node<Element>;
-				friend class Avl_tree<Element>;
 				friend class Lru_cache;
 
-				bool _higher(KEY const &other) const
-				{
-					return Tag::_key.value > other.value;
-				}
-
-				unsigned _importance(Time now) const
-				{
-					return now.value - Tag::_last_used.value;
-				}
-
 			public:
 
 				template <typename... ARGS>
-				Element(KEY key, Time now, ARGS &&... args)
-				: Tag(key, now), ELEM(args...) { }
+				Element(KEY key, unsigned long hash, ARGS &&... args)
+				: Tag(key, hash), ELEM(args...) { }
+		};
 
-				/**
-				 * Avl_node interface
-				 */
-				bool higher(Element *e) { return _higher(e->_key); }
+		static unsigned long _hash(unsigned long v) { return v; }
+		static unsigned long _hash(unsigned      v) { return v; }
 
-				template <typename FN>
-				bool try_apply(KEY const &key, FN const &fn)
-				{
-					if (Tag::_key.value == key.value) {
-						fn(*this);
-						return true;
-					}
+		template <typename T>
+		static unsigned long _hash(T const &v) { return v.hash(); }
 
-					Element * const e = Avl_node<Element>::child(_higher(key));
+		/**
+		 * Return number of hash buckets, the power of two below 'max_elements'
+		 */
+		static unsigned _num_buckets(unsigned max_elements)
+		{
+			return 1U << log2(max(max_elements, 1U));
+		}
 
-					return e && e->try_apply(key, fn);
-				}
+		unsigned const _bucket_mask = _num_buckets(_max_elements) - 1;
 
-				template <typename FN>
-				void with_least_recently_used(Time now, FN const fn)
-				{
-					Element *result = this;
+		Element **_buckets =
+			(Element **)_alloc.alloc((_bucket_mask + 1)*sizeof(Element *));
 
-					for (unsigned i = 0; i < 2; i++) {
-						Element *e = Avl_node<Element>::child(i);
-						if (e && e->_importance(now) > result->_importance(now))
-							result = e;
-					}
+		/* most and least recently used elements */
+		Element *_newest = nullptr;
+		Element *_oldest = nullptr;
 
-					if (result)
-						fn(*result);
-				}
+		Element *&_bucket(unsigned long hash) { return _buckets[hash & _bucket_mask]; }
 
-				void mark_as_used(Time now) { Tag::_last_used = now; }
-		};
+		void _unlink(Element &e)
+		{
+			(e._newer ? e._newer->_older : _newest) = e._older;
+			(e._older ? e._older->_newer : _oldest) = e._newer;
+
+			e._newer = e._older = nullptr;
+		}
 
-		Avl_tree<Element> mutable _avl_tree { };
+		void _link_as_newest(Element &e)
+		{
+			e._older = _newest;
+			e._newer = nullptr;
+
+			(_newest ? _newest->_newer : _oldest) = &e;
+			_newest = &e;
+		}
+
+		void _mark_as_used(Element &e)
+		{
+			if (_newest == &e)
+				return;
+
+			_unlink(e);
+			_link_as_newest(e);
+		}
+
+		Element *_lookup(KEY const &key, unsigned long hash)
+		{
+			for (Element *e = _bucket(hash); e; e = e->_bucket_next)
+				if (e->_hash == hash && e->_key.value == key.value)
+					return e;
+
+			return nullptr;
+		}
 
 		/**
 		 * Add cache entry for the given key
@@ -142,33 +177,35 @@ class Genode::Lru_cache : Noncopyable
 
 			_used_elements++;
 
-			construct_at<Element>(element_ptr, key, _now, args...);
+			unsigned long const hash = _hash(key.value);
+
+			construct_at<Element>(element_ptr, key, hash, args...);
+
+			Element *&head = _bucket(hash);
+			element_ptr->_bucket_next = head;
+			head = element_ptr;
 
-			_avl_tree.insert(element_ptr);
+			_link_as_newest(*element_ptr);
 		}
 
 		/**
-		 * Evict element from cache
+		 * Release element from cache
 		 */
 		void _remove(Element &element)
 		{
-			_avl_tree.remove(&element);
+			Element **link = &_bucket(element._hash);
+			while (*link != &element)
+				link = &(*link)->_bucket_next;
+
+			*link = element._bucket_next;
+
+			_unlink(element);
 
 			element.~Element();
 
 			_alloc.free(&element, sizeof(Element));
 
 			_used_elements--;
-			_stats.evictions++;
-		}
-
-		template <typename FN>
-		bool _try_apply(KEY const &key, FN const &fn)
-		{
-			if (!_avl_tree.first())
-				return false;
-
-			return _avl_tree.first()->try_apply(key, fn);
 		}
 
 		/**
@@ -178,19 +215,19 @@ class Genode::Lru_cache : Noncopyable
 		 */
 		bool _remove_least_recently_used()
 		{
-			if (!_avl_tree.first())
+			if (!_oldest)
 				return false;
 
-			_avl_tree.first()->with_least_recently_used(_now, [&] (Element &e) {
-				_remove(e); });
+			_remove(*_oldest);
+			_stats.evictions++;
 
 			return true;
 		}
 
 		void _remove_all()
 		{
-			while (Element *element_ptr = _avl_tree.first())
-				_remove(*element_ptr);
+			while (_oldest)
+				_remove(*_oldest);
 		}
 
 	public:
@@ -204,16 +241,27 @@ class Genode::Lru_cache : Noncopyable
 		 * \param size   maximum number of cache elements
 		 */
 		Lru_cache(Allocator &alloc, Size size)
-		: _alloc(alloc), _max_elements(size.value) { }
+		:
+			_alloc(alloc), _max_elements((unsigned)size.value)
+		{
+			for (unsigned i = 0; i <= _bucket_mask; i++)
+				_buckets[i] = nullptr;
+		}
 
-		~Lru_cache() { _remove_all(); }
+		~Lru_cache()
+		{
+			_remove_all();
+			_alloc.free(_buckets, (_bucket_mask + 1)*sizeof(Element *));
+		}
 
 		/**
 		 * Return size of a single cache entry including the meta data
 		 *
 		 * The returned value is useful for cache-dimensioning calculations.
+		 * It includes the share of the hash table, which has at most one
+		 * bucket per element.
 		 */
-		static constexpr size_t element_size() { return sizeof(Element); }
+		static constexpr size_t element_size() { return sizeof(Element) + sizeof(Element *); }
 
 		/**
 		 * Return usage stats
@@ -265,7 +313,7 @@ class Genode::Lru_cache : Noncopyable
 		template <typename HIT_FN, typename MISS_FN>
 		bool try_apply(KEY key, HIT_FN const &hit_fn, MISS_FN const &miss_fn)
 		{
-			_now.value++;
+			unsigned long const hash = _hash(key.value);
 
 			/*
 			 * Try to look up element from the cache. If it is missing, fill
@@ -277,19 +325,20 @@ class Genode::Lru_cache : Noncopyable
 			/* retry once after handling a cache miss */
 			for (unsigned i = 0; i < 2; i++) {
 
-				bool const hit = _try_apply(key, [&] (Element &element) {
-					hit_fn(element);
-					element.mark_as_used(_now);
+				if (Element * const element_ptr = _lookup(key, hash)) {
+					hit_fn(*element_ptr);
+					_mark_as_used(*element_ptr);
 					_stats.hits += (i == 0);
-				});
-
-				if (hit)
 					return true;
+				}
 
 				/*
 				 * Handle cache miss
 				 */
 
+				if (i == 0)
+					_stats.misses++;
+
 				/* evict element if the cache is fully populated */
 				while (_used_elements >= _max_elements)
 					if (!_remove_least_recently_used())
@@ -35,6 +35,17 @@ namespace Depot_query {
 	struct Rom_query;
 	class  Cached_rom_query;
 	struct Main;
+
+	/**
+	 * Return hash value of string, used for indexing the caches
+	 */
+	static inline unsigned long string_hash(char const *s, unsigned long hash = 5381)
+	{
+		for (; *s; s++)
+			hash = hash*33 + (unsigned char)*s;
+
+		return hash;
+	}
 }
 
 
@@ -165,10 +176,7 @@ class Depot_query::Stat_cache
 			{
 				Archive::Path path;
 
-				bool operator > (Value const &other) const
-				{
-					return strcmp(path.string(), other.path.string()) > 0;
-				}
+				unsigned long hash() const { return string_hash(path.string()); }
 
 				bool operator == (Value const &other) const
 				{
@@ -259,10 +267,9 @@ class Depot_query::Cached_rom_query : public Rom_query
 				Archive::Path pkg;
 				Rom_label     rom;
 
-				bool operator > (Value const &other) const
+				unsigned long hash() const
 				{
-					return strcmp(pkg.string(), other.pkg.string()) > 0
-					    && strcmp(rom.string(), other.rom.string()) > 0;
+					return string_hash(rom.string(), string_hash(pkg.string()));
 				}
 
 				bool operator == (Value const &other) const
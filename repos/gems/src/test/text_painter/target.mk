@@ -1,6 +1,6 @@
 TARGET = test-text_painter
 SRC_CC = main.cc
-LIBS   = base ttf_font vfs
+LIBS   = base ttf_font vfs blit
 
 SRC_BIN += droidsansb10.tff default.tff
 
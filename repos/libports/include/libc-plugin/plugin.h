@@ -26,6 +26,7 @@
 #include <sys/poll.h>   /* for 'struct pollfd' */
 
 namespace Genode { class Env; }
+namespace Vfs    { struct Io_response_handler; }
 
 namespace Libc {
 
@@ -81,6 +82,17 @@ namespace Libc {
 			 */
 			virtual void init(Genode::Env &env) { }
 
+			/**
+			 * Direct the I/O responses concerning 'fd' to 'handler'
+			 *
+			 * A nullptr restores the default handler. The return value is
+			 * false if the plugin cannot attribute I/O responses to the
+			 * individual file descriptor or if they are directed to another
+			 * handler already.
+			 */
+			virtual bool io_response_handler(File_descriptor &fd,
+			                                 Vfs::Io_response_handler *handler);
+
 			virtual File_descriptor *accept(File_descriptor *,
 			                                struct ::sockaddr *addr,
 			                                socklen_t *addrlen);
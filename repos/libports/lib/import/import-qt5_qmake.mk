@@ -60,6 +60,7 @@ GENODE_QMAKE_LFLAGS_APP = \
 	$(addprefix $(LD_OPT_PREFIX),$(LD_MARCH)) \
 	$(addprefix $(LD_OPT_PREFIX),$(LD_OPT_GC_SECTIONS)) \
 	$(addprefix $(LD_OPT_PREFIX),$(LD_OPT_ALIGN_SANE)) \
+	$(addprefix $(LD_OPT_PREFIX),$(LD_OPT_HASH_STYLE)) \
 	$(addprefix $(LD_OPT_PREFIX),--dynamic-list=$(BASE_DIR)/src/ld/genode_dyn.dl) \
 	$(LD_OPT_NOSTDLIB) \
 	-Wl,-Ttext=0x01000000 \
@@ -82,6 +83,7 @@ GENODE_QMAKE_LFLAGS_SHLIB = \
 	$(addprefix $(LD_OPT_PREFIX),$(LD_MARCH)) \
 	$(addprefix $(LD_OPT_PREFIX),$(LD_OPT_GC_SECTIONS)) \
 	$(addprefix $(LD_OPT_PREFIX),$(LD_OPT_ALIGN_SANE)) \
+	$(addprefix $(LD_OPT_PREFIX),$(LD_OPT_HASH_STYLE)) \
 	-Wl,-T -Wl,$(LD_SCRIPT_SO) \
 	$(addprefix $(LD_OPT_PREFIX),--entry=0x0) \
 	-L$(CURDIR)/qmake_root/lib \
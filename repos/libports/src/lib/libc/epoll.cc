@@ -0,0 +1,540 @@
+/*
+ * \brief  epoll() implementation
+ * \author agent
+ * \date   2026-10-16
+ *
+ * An epoll instance keeps its interest set in an ID space keyed by the libc
+ * file descriptor. When a file descriptor is added, its plugin is asked to
+ * direct the I/O responses of the underlying VFS handles to the epoll item.
+ * The item then schedules itself in the ready queue of the instance before
+ * passing the response on to the libc kernel. 'epoll_wait' examines only
+ * the scheduled items. An item that turns out to be not ready is dropped
+ * from the queue until the next I/O response. Items reported
+ * level-triggered stay scheduled. Hence, the costs of 'epoll_wait' depend
+ * on the number of ready file descriptors, not on the size of the interest
+ * set. File descriptors whose plugin cannot attribute I/O responses to
+ * them individually stay scheduled all the time.
+ *
+ * All operations on the epoll state are executed in the context of the
+ * libc kernel, which is also the context of the I/O responses.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/id_space.h>
+#include <base/registry.h>
+#include <util/fifo.h>
+#include <vfs/vfs_handle.h>
+
+/* libc plugin interface */
+#include <libc-plugin/fd_alloc.h>
+#include <libc-plugin/plugin.h>
+
+/* libc includes */
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/poll.h>
+
+/* libc-internal includes */
+#include <internal/kernel.h>
+#include <internal/init.h>
+#include <internal/epoll.h>
+#include <internal/errno.h>
+#include <internal/monitor.h>
+#include <internal/signal.h>
+
+namespace Libc {
+	struct Epoll_item;
+	struct Epoll;
+	struct Epoll_plugin;
+}
+
+using namespace Libc;
+
+namespace { using Fn = Libc::Monitor::Function_result; }
+
+
+static Monitor                  *_monitor_ptr;
+static Libc::Signal             *_signal_ptr;
+static Vfs::Io_response_handler *_kernel_handler_ptr;
+static Genode::Allocator        *_alloc_ptr;
+
+
+void Libc::init_epoll(Monitor &monitor, Signal &signal,
+                      Vfs::Io_response_handler &kernel_handler,
+                      Genode::Allocator &alloc)
+{
+	_monitor_ptr        = &monitor;
+	_signal_ptr         = &signal;
+	_kernel_handler_ptr = &kernel_handler;
+	_alloc_ptr          = &alloc;
+}
+
+
+/**
+ * Execute 'fn' in the context of the libc kernel
+ */
+template <typename FN>
+static void with_kernel_context(FN const &fn)
+{
+	if (Libc::Kernel::kernel().main_context()
+	 && Libc::Kernel::kernel().main_suspended()) {
+		fn();
+		return;
+	}
+
+	struct Missing_call_of_init_epoll : Exception { };
+	if (!_monitor_ptr)
+		throw Missing_call_of_init_epoll();
+
+	_monitor_ptr->monitor([&] {
+		fn();
+		return Fn::COMPLETE;
+	});
+}
+
+
+static short poll_events(uint32_t events)
+{
+	short result = 0;
+	if (events & EPOLLIN)     result |= POLLIN;
+	if (events & EPOLLPRI)    result |= POLLPRI;
+	if (events & EPOLLOUT)    result |= POLLOUT;
+	if (events & EPOLLRDNORM) result |= POLLRDNORM;
+	if (events & EPOLLRDBAND) result |= POLLRDBAND;
+	if (events & EPOLLWRNORM) result |= POLLWRNORM;
+	if (events & EPOLLWRBAND) result |= POLLWRBAND;
+	return result;
+}
+
+
+static uint32_t epoll_events(short revents)
+{
+	uint32_t result = 0;
+	if (revents & POLLIN)     result |= EPOLLIN;
+	if (revents & POLLPRI)    result |= EPOLLPRI;
+	if (revents & POLLOUT)    result |= EPOLLOUT;
+	if (revents & POLLRDNORM) result |= EPOLLRDNORM;
+	if (revents & POLLRDBAND) result |= EPOLLRDBAND;
+	if (revents & POLLWRNORM) result |= EPOLLWRNORM;
+	if (revents & POLLWRBAND) result |= EPOLLWRBAND;
+	if (revents & POLLERR)    result |= EPOLLERR;
+	if (revents & POLLHUP)    result |= EPOLLHUP;
+	if (revents & POLLNVAL)   result |= EPOLLERR;
+	return result;
+}
+
+
+struct Libc::Epoll_item : Vfs::Io_response_handler
+{
+	typedef Genode::Id_space<Epoll_item>     Id_space;
+	typedef Genode::Fifo_element<Epoll_item> Ready_element;
+
+	Epoll             &_epoll;
+	File_descriptor   &fd;
+	Id_space::Element  _elem;
+	Ready_element      ready_elem { *this };
+	uint32_t           events;
+	epoll_data_t       data;
+	bool               disabled { false };
+
+	/* readiness changes of the file descriptor trigger I/O responses */
+	bool notified;
+
+	Epoll_item(Epoll &epoll, Id_space &id_space, File_descriptor &fd,
+	           epoll_event const &event)
+	:
+		_epoll(epoll), fd(fd),
+		_elem(*this, id_space, Id_space::Id { (unsigned long)fd.libc_fd }),
+		events(event.events), data(event.data),
+		notified(fd.plugin->io_response_handler(fd, this))
+	{ }
+
+	~Epoll_item()
+	{
+		if (notified)
+			fd.plugin->io_response_handler(fd, nullptr);
+	}
+
+	/**
+	 * Return the subset of the requested events that are pending
+	 */
+	uint32_t pending_events()
+	{
+		struct pollfd pfd { fd.libc_fd, poll_events(events), 0 };
+
+		fd.plugin->poll(fd, pfd);
+
+		return epoll_events(pfd.revents) & (events | EPOLLERR | EPOLLHUP);
+	}
+
+	inline void _schedule();
+
+
+	/*************************
+	 ** Io_response_handler **
+	 *************************/
+
+	void read_ready_response() override
+	{
+		_schedule();
+		_kernel_handler_ptr->read_ready_response();
+	}
+
+	void io_progress_response() override
+	{
+		_schedule();
+		_kernel_handler_ptr->io_progress_response();
+	}
+};
+
+
+struct Libc::Epoll : Plugin_context
+{
+	private:
+
+		Genode::Allocator         &_alloc;
+		Registry<Epoll>::Element   _elem;
+		Epoll_item::Id_space       _items { };
+		Fifo<Epoll_item::Ready_element> _ready { };
+
+		template <typename FN>
+		int _with_item(File_descriptor &fd, FN const &fn)
+		{
+			int result = ENOENT;
+			try {
+				_items.apply<Epoll_item>(Epoll_item::Id_space::Id { (unsigned long)fd.libc_fd },
+				                         [&] (Epoll_item &item) {
+					if (&item.fd == &fd)
+						result = fn(item); });
+			} catch (Epoll_item::Id_space::Unknown_id) { }
+			return result;
+		}
+
+		void _destroy(Epoll_item &item)
+		{
+			_ready.remove(item.ready_elem);
+			destroy(_alloc, &item);
+		}
+
+	public:
+
+		Epoll(Genode::Allocator &alloc, Registry<Epoll> &registry)
+		: _alloc(alloc), _elem(registry, *this) { }
+
+		~Epoll()
+		{
+			while (_items.apply_any<Epoll_item>([&] (Epoll_item &item) {
+				_destroy(item); }));
+		}
+
+		void schedule(Epoll_item &item)
+		{
+			if (!item.ready_elem.enqueued())
+				_ready.enqueue(item.ready_elem);
+		}
+
+		/**
+		 * Apply epoll_ctl operation, return 0 or errno value
+		 */
+		int ctl(int op, File_descriptor &fd, epoll_event const *event)
+		{
+			switch (op) {
+
+			case EPOLL_CTL_ADD:
+				try {
+					schedule(*new (_alloc) Epoll_item(*this, _items, fd, *event));
+					return 0;
+				}
+				catch (Epoll_item::Id_space::Conflicting_id) { return EEXIST; }
+				catch (Out_of_ram)                           { return ENOMEM; }
+				catch (Out_of_caps)                          { return ENOMEM; }
+
+			case EPOLL_CTL_MOD:
+				return _with_item(fd, [&] (Epoll_item &item) {
+					item.events   = event->events;
+					item.data     = event->data;
+					item.disabled = false;
+					schedule(item);
+					return 0;
+				});
+
+			case EPOLL_CTL_DEL:
+				return _with_item(fd, [&] (Epoll_item &item) {
+					_destroy(item);
+					return 0;
+				});
+			}
+			return EINVAL;
+		}
+
+		/**
+		 * Forget file descriptor whose file is closed already
+		 */
+		void release(File_descriptor &fd)
+		{
+			_with_item(fd, [&] (Epoll_item &item) {
+				item.notified = false;
+				_destroy(item);
+				return 0;
+			});
+		}
+
+		/**
+		 * Store up to 'max' pending events in 'out', return number of events
+		 */
+		int collect(epoll_event *out, int max)
+		{
+			/*
+			 * Items that get scheduled while we examine the ready queue
+			 * end up behind the items examined, and are reported by the
+			 * next call at the latest.
+			 */
+			using Element = Epoll_item::Ready_element;
+
+			Fifo<Element> examine { };
+			Fifo<Element> keep    { };
+			_ready.dequeue_all([&] (Element &e) { examine.enqueue(e); });
+
+			int n = 0;
+			while (n < max && !examine.empty()) {
+
+				Epoll_item *item_ptr = nullptr;
+				examine.dequeue([&] (Element &e) { item_ptr = &e.object(); });
+				Epoll_item &item = *item_ptr;
+
+				if (item.disabled)
+					continue;
+
+				uint32_t const revents = item.pending_events();
+				if (revents) {
+					out[n].events = revents;
+					out[n].data   = item.data;
+					n++;
+
+					if (item.events & EPOLLONESHOT) {
+						item.disabled = true;
+						continue;
+					}
+				}
+				/*
+				 * Level-triggered items stay scheduled while they are ready,
+				 * items without I/O responses stay scheduled all the time.
+				 */
+				bool const level = revents && !(item.events & EPOLLET);
+				if (level || !item.notified)
+					keep.enqueue(item.ready_elem);
+			}
+
+			/* restore order: unexamined, kept, newly scheduled items */
+			Fifo<Element> ready { };
+			auto move_to_ready = [&] (Element &e) { ready.enqueue(e); };
+			examine.dequeue_all(move_to_ready);
+			keep   .dequeue_all(move_to_ready);
+			_ready .dequeue_all(move_to_ready);
+			ready  .dequeue_all([&] (Element &e) { _ready.enqueue(e); });
+
+			return n;
+		}
+};
+
+
+void Libc::Epoll_item::_schedule() { _epoll.schedule(*this); }
+
+
+static Registry<Epoll> &epolls()
+{
+	static Registry<Epoll> inst { };
+	return inst;
+}
+
+
+struct Libc::Epoll_plugin : Plugin
+{
+	int close(File_descriptor *fd) override
+	{
+		Epoll *epoll = dynamic_cast<Epoll *>(fd->context);
+		if (!epoll)
+			return Errno(EBADF);
+
+		with_kernel_context([&] { destroy(*_alloc_ptr, epoll); });
+		file_descriptor_allocator()->free(fd);
+		return 0;
+	}
+
+	int fcntl(File_descriptor *fd, int cmd, long arg) override
+	{
+		switch (cmd) {
+		case F_GETFD: return fd->cloexec ? FD_CLOEXEC : 0;
+		case F_SETFD: fd->cloexec = arg == FD_CLOEXEC; return 0;
+		case F_GETFL: return fd->flags;
+		case F_SETFL: fd->flags = (int)arg; return 0;
+		}
+		return Errno(EINVAL);
+	}
+};
+
+
+static Epoll_plugin &epoll_plugin()
+{
+	static Epoll_plugin inst { };
+	return inst;
+}
+
+
+static Epoll *epoll_by_fd(int libc_fd)
+{
+	File_descriptor *fd = file_descriptor_allocator()->find_by_libc_fd(libc_fd);
+	if (!fd || fd->plugin != &epoll_plugin())
+		return nullptr;
+
+	return dynamic_cast<Epoll *>(fd->context);
+}
+
+
+void Libc::epoll_release_fd(File_descriptor &fd)
+{
+	if (!_alloc_ptr || fd.plugin == &epoll_plugin())
+		return;
+
+	bool any_epoll = false;
+	epolls().for_each([&] (Epoll &) { any_epoll = true; });
+	if (!any_epoll)
+		return;
+
+	with_kernel_context([&] {
+		epolls().for_each([&] (Epoll &epoll) { epoll.release(fd); }); });
+}
+
+
+extern "C" int epoll_create1(int flags)
+{
+	if (flags & ~EPOLL_CLOEXEC)
+		return Errno(EINVAL);
+
+	struct Missing_call_of_init_epoll : Exception { };
+	if (!_alloc_ptr)
+		throw Missing_call_of_init_epoll();
+
+	Epoll *epoll = nullptr;
+	try { epoll = new (*_alloc_ptr) Epoll(*_alloc_ptr, epolls()); }
+	catch (...) { return Errno(ENOMEM); }
+
+	File_descriptor *fd =
+		file_descriptor_allocator()->alloc(&epoll_plugin(), epoll);
+
+	if (!fd) {
+		destroy(*_alloc_ptr, epoll);
+		return Errno(EMFILE);
+	}
+
+	fd->cloexec = (flags & EPOLL_CLOEXEC) != 0;
+	return fd->libc_fd;
+}
+
+
+extern "C" int epoll_create(int size)
+{
+	if (size <= 0)
+		return Errno(EINVAL);
+
+	return epoll_create1(0);
+}
+
+
+extern "C" int epoll_ctl(int epfd, int op, int libc_fd, struct epoll_event *event)
+{
+	Epoll *epoll = epoll_by_fd(epfd);
+	if (!epoll)
+		return Errno(file_descriptor_allocator()->find_by_libc_fd(epfd) ? EINVAL : EBADF);
+
+	File_descriptor *fd = file_descriptor_allocator()->find_by_libc_fd(libc_fd);
+	if (!fd || !fd->plugin)
+		return Errno(EBADF);
+
+	if (libc_fd == epfd)
+		return Errno(EINVAL);
+
+	/* the readiness of the file descriptor must be observable */
+	if (!fd->plugin->supports_poll())
+		return Errno(EPERM);
+
+	if (op != EPOLL_CTL_DEL && !event)
+		return Errno(EFAULT);
+
+	int error = 0;
+	with_kernel_context([&] { error = epoll->ctl(op, *fd, event); });
+
+	return error ? Errno(error) : 0;
+}
+
+
+extern "C" int epoll_wait(int epfd, struct epoll_event *events,
+                          int maxevents, int timeout_ms)
+{
+	Epoll *epoll = epoll_by_fd(epfd);
+	if (!epoll)
+		return Errno(file_descriptor_allocator()->find_by_libc_fd(epfd) ? EINVAL : EBADF);
+
+	if (!events || maxevents <= 0)
+		return Errno(EINVAL);
+
+	struct Missing_call_of_init_epoll : Exception { };
+	if (!_monitor_ptr || !_signal_ptr)
+		throw Missing_call_of_init_epoll();
+
+	unsigned const orig_signal_count = _signal_ptr->count();
+
+	auto signal_occurred_during_wait = [&] ()
+	{
+		return (_signal_ptr->count() != orig_signal_count);
+	};
+
+	int nready = 0;
+
+	auto monitor_fn = [&] ()
+	{
+		nready = epoll->collect(events, maxevents);
+
+		if (nready || timeout_ms == 0 || signal_occurred_during_wait())
+			return Fn::COMPLETE;
+
+		return Fn::INCOMPLETE;
+	};
+
+	Monitor::Result const monitor_result =
+		_monitor_ptr->monitor(monitor_fn, timeout_ms > 0 ? timeout_ms : 0);
+
+	if (monitor_result == Monitor::Result::TIMEOUT)
+		return 0;
+
+	if (!nready && signal_occurred_during_wait())
+		return Errno(EINTR);
+
+	return nready;
+}
+
+
+extern "C" int epoll_pwait(int epfd, struct epoll_event *events,
+                           int maxevents, int timeout_ms,
+                           const sigset_t *sigmask)
+{
+	sigset_t origmask;
+
+	if (sigmask)
+		sigprocmask(SIG_SETMASK, sigmask, &origmask);
+
+	int const nready = epoll_wait(epfd, events, maxevents, timeout_ms);
+
+	if (sigmask)
+		sigprocmask(SIG_SETMASK, &origmask, NULL);
+
+	return nready;
+}
@@ -29,6 +29,7 @@
 
 /* libc-internal includes */
 #include <internal/init.h>
+#include <internal/epoll.h>
 
 using namespace Libc;
 
@@ -77,6 +78,9 @@ File_descriptor *File_descriptor_allocator::alloc(Plugin *plugin,
 
 void File_descriptor_allocator::free(File_descriptor *fdo)
 {
+	/* may have to wait for the libc kernel, so do not hold the mutex */
+	epoll_release_fd(*fdo);
+
 	Mutex::Guard guard(_mutex);
 
 	if (fdo->fd_path)
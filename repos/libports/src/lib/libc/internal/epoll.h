@@ -0,0 +1,33 @@
+/*
+ * \brief  Interface between the epoll implementation and the libc
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _LIBC__INTERNAL__EPOLL_H_
+#define _LIBC__INTERNAL__EPOLL_H_
+
+/* libc-internal includes */
+#include <internal/types.h>
+
+namespace Libc {
+
+	struct File_descriptor;
+
+	/**
+	 * Remove file descriptor from the interest sets of all epoll instances
+	 *
+	 * Called when the file descriptor is released. At this point, the
+	 * plugin has closed the file already.
+	 */
+	void epoll_release_fd(File_descriptor &);
+}
+
+#endif /* _LIBC__INTERNAL__EPOLL_H_ */
@@ -26,6 +26,8 @@
 /* libc-internal includes */
 #include <internal/types.h>
 
+namespace Vfs { struct Io_response_handler; }
+
 namespace Libc {
 
 	struct Resume;
@@ -42,6 +44,7 @@ namespace Libc {
 	struct Cwd;
 	struct Atexit;
 	struct Config_accessor;
+	struct Pthread;
 
 	/**
 	 * Support for shared libraries
@@ -74,6 +77,12 @@ namespace Libc {
 	 */
 	void init_select(Select &, Signal &, Monitor &);
 
+	/**
+	 * Epoll support
+	 */
+	void init_epoll(Monitor &, Signal &, Vfs::Io_response_handler &,
+	                Genode::Allocator &);
+
 	/**
 	 * Support for querying available RAM quota in sysctl functions
 	 */
@@ -92,10 +101,17 @@ namespace Libc {
 	/**
 	 * Malloc allocator
 	 */
-	void init_malloc(Genode::Allocator &);
+	void init_malloc(Genode::Allocator &, Xml_node const &);
 	void init_malloc_cloned(Clone_connection &);
 	void reinit_malloc(Genode::Allocator &);
 
+	/**
+	 * Hand the objects that malloc caches for 'pthread' back to the pool
+	 *
+	 * Must be called by the thread itself before it exits.
+	 */
+	void release_malloc_cache(Pthread &pthread);
+
 	typedef String<Vfs::MAX_PATH_LEN> Rtc_path;
 
 	/**
@@ -178,6 +178,13 @@ struct Libc::Kernel final : Vfs::Io_response_handler,
 			     : Xml_node("<pthread/>");
 		}
 
+		Xml_node _malloc_config()
+		{
+			return _libc_env.libc_config().has_sub_node("malloc")
+			     ? _libc_env.libc_config().sub_node("malloc")
+			     : Xml_node("<malloc/>");
+		}
+
 		typedef String<Vfs::MAX_PATH_LEN> Config_attr;
 
 		Config_attr const _rtc_path = _libc_env.libc_config().attribute_value("rtc", Config_attr());
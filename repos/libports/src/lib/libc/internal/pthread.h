@@ -38,6 +38,7 @@ namespace Libc {
 	struct Pthread_cleanup;
 	struct Pthread_job;
 	struct Pthread_mutex;
+	struct Malloc_cache;
 }
 
 
@@ -186,6 +187,9 @@ struct Libc::Pthread : Noncopyable
 
 		int thread_local_errno = 0;
 
+		/* objects kept by malloc for this thread, see 'malloc.cc' */
+		Malloc_cache *malloc_cache = nullptr;
+
 		/**
 		 * Constructor for threads created via 'pthread_create'
 		 */
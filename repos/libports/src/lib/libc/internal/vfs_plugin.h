@@ -73,15 +73,23 @@ class Libc::Vfs_plugin final : public Plugin
 
 	private:
 
+		/**
+		 * Mapping of a dataspace obtained from the VFS
+		 *
+		 * The dataspace is handed back to the file system on 'munmap'.
+		 */
 		struct Mmap_entry : Registry<Mmap_entry>::Element
 		{
-			void            * const start;
-			Vfs::Vfs_handle * const reference_handle;
+			void                 * const start;
+			Vfs::Vfs_handle      * const reference_handle;
+			Absolute_path          const path;
+			Dataspace_capability   const ds;
 
 			Mmap_entry(Registry<Mmap_entry> &registry, void *start,
-			           Vfs::Vfs_handle *reference_handle)
+			           Vfs::Vfs_handle *reference_handle,
+			           char const *path, Dataspace_capability ds)
 			: Registry<Mmap_entry>::Element(registry, *this), start(start),
-			  reference_handle(reference_handle) { }
+			  reference_handle(reference_handle), path(path), ds(ds) { }
 		};
 
 		Genode::Allocator               &_alloc;
@@ -93,6 +101,14 @@ class Libc::Vfs_plugin final : public Plugin
 		bool                       const _pipe_configured;
 		Registry<Mmap_entry>             _mmap_registry;
 
+		/**
+		 * Attach the dataspace of the file referred to by 'fd'
+		 *
+		 * \return  0 on success or errno value
+		 */
+		int _attach_vfs_dataspace(File_descriptor &fd, ::size_t length,
+		                          ::off_t offset, bool writeable, void *&addr);
+
 		/**
 		 * Sync a handle
 		 */
@@ -211,6 +227,7 @@ class Libc::Vfs_plugin final : public Plugin
 		int     ftruncate(File_descriptor *, ::off_t) override;
 		ssize_t getdirentries(File_descriptor *, char *, ::size_t , ::off_t *) override;
 		int     ioctl(File_descriptor *, unsigned long, char *) override;
+		bool    io_response_handler(File_descriptor &, Vfs::Io_response_handler *) override;
 		::off_t lseek(File_descriptor *fd, ::off_t offset, int whence) override;
 		int     mkdir(const char *, mode_t) override;
 		File_descriptor *open(const char *path, int flags) override;
@@ -470,7 +470,7 @@ Libc::Kernel::Kernel(Genode::Env &env, Genode::Allocator &heap)
 
 	} else {
 		_malloc_heap.construct(*_malloc_ram, _env.rm());
-		init_malloc(*_malloc_heap);
+		init_malloc(*_malloc_heap, _malloc_config());
 	}
 
 	init_fork(_env, _libc_env, _heap, *_malloc_heap, _pid, *this, _signal,
@@ -483,6 +483,7 @@ Libc::Kernel::Kernel(Genode::Env &env, Genode::Allocator &heap)
 	init_file_operations(*this, _libc_env);
 	init_time(*this, *this);
 	init_select(*this, _signal, *this);
+	init_epoll(*this, _signal, *this, _heap);
 	init_socket_fs(*this, *this);
 	init_passwd(_passwd_config());
 	init_signal(_signal);
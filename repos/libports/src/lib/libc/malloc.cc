@@ -33,6 +33,7 @@ extern "C" {
 #include <internal/init.h>
 #include <internal/clone_session.h>
 #include <internal/errno.h>
+#include <internal/pthread.h>
 
 
 namespace Libc {
@@ -55,7 +56,7 @@ class Libc::Slab_alloc : public Slab
 
 	public:
 
-		Slab_alloc(size_t object_size, Allocator &backing_store)
+		Slab_alloc(size_t object_size, Genode::Allocator &backing_store)
 		:
 			Slab(object_size, _calculate_block_size(object_size), 0, &backing_store),
 			_object_size(object_size)
@@ -121,12 +122,27 @@ class Libc::Malloc
 			return sizeof(Metadata) + (align - 1);
 		}
 
-		Allocator &_backing_store; /* back-end allocator */
+		Genode::Allocator &_backing_store; /* back-end allocator */
 
 		Constructible<Slab_alloc> _slabs[NUM_SLABS]; /* slab allocators */
 
 		Mutex _mutex;
 
+		bool const _thread_cache;
+
+		Malloc_cache *_cache_of_myself();
+
+		void *_slab_alloc(unsigned slab);
+
+		void _slab_free(void *addr, unsigned slab);
+
+		void _flush_cache(Malloc_cache &cache);
+
+		static size_t _slab_object_size(unsigned slab)
+		{
+			return 1UL << (slab + SLAB_START);
+		}
+
 		unsigned _slab_log2(size_t size) const
 		{
 			unsigned msb = Genode::log2(size);
@@ -144,7 +160,9 @@ class Libc::Malloc
 
 	public:
 
-		Malloc(Allocator &backing_store) : _backing_store(backing_store)
+		Malloc(Genode::Allocator &backing_store, bool thread_cache)
+		:
+			_backing_store(backing_store), _thread_cache(thread_cache)
 		{
 			for (unsigned i = SLAB_START; i <= SLAB_STOP; i++)
 				_slabs[i - SLAB_START].construct(1U << i, backing_store);
@@ -158,8 +176,6 @@ class Libc::Malloc
 
 		void * alloc(size_t size, size_t align = DEFAULT_ALIGN)
 		{
-			Mutex::Guard guard(_mutex);
-
 			size_t   const real_size = size + _room(align);
 			unsigned const msb       = _slab_log2(real_size);
 
@@ -169,7 +185,7 @@ class Libc::Malloc
 			if (msb > SLAB_STOP)
 				_backing_store.alloc(real_size, &alloc_addr);
 			else
-				alloc_addr = _slabs[msb - SLAB_START]->alloc();
+				alloc_addr = _slab_alloc(msb - SLAB_START);
 
 			if (!alloc_addr) return nullptr;
 
@@ -209,8 +225,6 @@ class Libc::Malloc
 
 		void free(void *ptr)
 		{
-			Mutex::Guard lock_guard(_mutex);
-
 			Metadata *md = (Metadata *)ptr - 1;
 
 			size_t   const  real_size  = md->size;
@@ -221,12 +235,156 @@ class Libc::Malloc
 			if (msb > SLAB_STOP) {
 				_backing_store.free(alloc_addr, real_size);
 			} else {
-				_slabs[msb - SLAB_START]->free(alloc_addr);
+				_slab_free(alloc_addr, msb - SLAB_START);
 			}
 		}
+
+		void release_cache(Pthread &pthread);
+
+		bool thread_cache() const { return _thread_cache; }
 };
 
 
+/**
+ * Free slab objects that malloc keeps for one thread
+ *
+ * With the thread cache enabled, each pthread owns one magazine of free
+ * objects per slab size. Allocations and deallocations of slab-sized
+ * objects are served from the magazine without taking the mutex of the
+ * shared slabs. An empty magazine is refilled and a full magazine is
+ * drained by 'BATCH' objects at once, so a thread takes the mutex at most
+ * once per 'BATCH' operations. Once the cached objects of a thread add up
+ * to more than 'HIGH_WATER' bytes, all magazines are handed back to the
+ * shared slabs. This way, a thread that freed many objects does not keep
+ * the memory from the other threads until it exits.
+ */
+struct Libc::Malloc_cache
+{
+	enum { CAPACITY = 32, BATCH = CAPACITY / 2, NUM_SLABS = 7,
+	       HIGH_WATER = 64*1024 };
+
+	struct Magazine
+	{
+		unsigned  count { 0 };
+		void     *objects[CAPACITY] { };
+	};
+
+	Magazine magazines[NUM_SLABS] { };
+
+	size_t bytes { 0 }; /* size of all cached objects */
+};
+
+
+/*
+ * Marks the cache of a thread that released it, such that objects freed
+ * during the remainder of its exit bypass the cache
+ */
+static Libc::Malloc_cache released_malloc_cache;
+
+
+Libc::Malloc_cache *Libc::Malloc::_cache_of_myself()
+{
+	static_assert((unsigned)Malloc_cache::NUM_SLABS == (unsigned)NUM_SLABS,
+	              "number of magazines does not match number of slabs");
+
+	if (!_thread_cache)
+		return nullptr;
+
+	/* threads without pthread object, e.g., alien threads, are not cached */
+	Pthread *const pthread = Pthread::myself();
+	if (!pthread)
+		return nullptr;
+
+	if (pthread->malloc_cache == &released_malloc_cache)
+		return nullptr;
+
+	if (!pthread->malloc_cache) {
+		void *addr = nullptr;
+		if (!_backing_store.alloc(sizeof(Malloc_cache), &addr))
+			return nullptr;
+
+		pthread->malloc_cache = construct_at<Malloc_cache>(addr);
+	}
+	return pthread->malloc_cache;
+}
+
+
+void *Libc::Malloc::_slab_alloc(unsigned slab)
+{
+	Malloc_cache *const cache = _cache_of_myself();
+	if (!cache) {
+		Mutex::Guard guard(_mutex);
+		return _slabs[slab]->alloc();
+	}
+	Malloc_cache::Magazine &mag = cache->magazines[slab];
+	if (!mag.count) {
+		Mutex::Guard guard(_mutex);
+		while (mag.count < Malloc_cache::BATCH) {
+			void *const obj = _slabs[slab]->alloc();
+			if (!obj)
+				break;
+
+			mag.objects[mag.count++] = obj;
+			cache->bytes += _slab_object_size(slab);
+		}
+	}
+	if (!mag.count)
+		return nullptr;
+
+	cache->bytes -= _slab_object_size(slab);
+	return mag.objects[--mag.count];
+}
+
+
+void Libc::Malloc::_slab_free(void *addr, unsigned slab)
+{
+	Malloc_cache *const cache = _cache_of_myself();
+	if (!cache) {
+		Mutex::Guard guard(_mutex);
+		_slabs[slab]->free(addr);
+		return;
+	}
+	Malloc_cache::Magazine &mag = cache->magazines[slab];
+	if (mag.count == Malloc_cache::CAPACITY) {
+		Mutex::Guard guard(_mutex);
+		for (unsigned i = 0; i < Malloc_cache::BATCH; i++)
+			_slabs[slab]->free(mag.objects[--mag.count]);
+
+		cache->bytes -= Malloc_cache::BATCH*_slab_object_size(slab);
+	}
+	mag.objects[mag.count++] = addr;
+	cache->bytes += _slab_object_size(slab);
+
+	if (cache->bytes > Malloc_cache::HIGH_WATER)
+		_flush_cache(*cache);
+}
+
+
+void Libc::Malloc::_flush_cache(Malloc_cache &cache)
+{
+	Mutex::Guard guard(_mutex);
+	for (unsigned slab = 0; slab < NUM_SLABS; slab++) {
+		Malloc_cache::Magazine &mag = cache.magazines[slab];
+		while (mag.count)
+			_slabs[slab]->free(mag.objects[--mag.count]);
+	}
+	cache.bytes = 0;
+}
+
+
+void Libc::Malloc::release_cache(Pthread &pthread)
+{
+	Malloc_cache *const cache = pthread.malloc_cache;
+	pthread.malloc_cache = &released_malloc_cache;
+
+	if (!cache || cache == &released_malloc_cache)
+		return;
+
+	_flush_cache(*cache);
+	_backing_store.free(cache, sizeof(Malloc_cache));
+}
+
+
 using namespace Libc;
 
 
@@ -284,12 +442,12 @@ static Genode::Constructible<Malloc> &constructible_malloc()
 }
 
 
-void Libc::init_malloc(Genode::Allocator &heap)
+void Libc::init_malloc(Genode::Allocator &heap, Xml_node const &config)
 {
 
 	Constructible<Malloc> &_malloc = constructible_malloc();
 
-	_malloc.construct(heap);
+	_malloc.construct(heap, config.attribute_value("thread_cache", false));
 
 	mallocator = _malloc.operator->();
 }
@@ -307,5 +465,16 @@ void Libc::reinit_malloc(Genode::Allocator &heap)
 {
 	Malloc &malloc = *constructible_malloc();
 
-	construct_at<Malloc>(&malloc, heap);
+	/* the cache of the calling thread refers to the former heap */
+	if (Pthread *pthread = Pthread::myself())
+		pthread->malloc_cache = nullptr;
+
+	construct_at<Malloc>(&malloc, heap, malloc.thread_cache());
+}
+
+
+void Libc::release_malloc_cache(Pthread &pthread)
+{
+	if (mallocator)
+		mallocator->release_cache(pthread);
 }
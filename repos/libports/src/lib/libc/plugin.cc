@@ -94,6 +94,12 @@ bool Plugin::supports_poll()
 }
 
 
+bool Plugin::io_response_handler(File_descriptor &, Vfs::Io_response_handler *)
+{
+	return false;
+}
+
+
 bool Plugin::supports_readlink(const char *path, char *buf, ::size_t bufsiz)
 {
 	return false;
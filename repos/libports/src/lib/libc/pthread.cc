@@ -705,6 +705,8 @@ extern "C" {
 			}
 		} while (at_least_one_destructor_called);
 
+		release_malloc_cache(*pthread_self());
+
 		pthread_self()->exit(value_ptr);
 	}
 
@@ -265,6 +265,42 @@ struct Libc::Socket_fs::Context : Plugin_context
 			return true;
 		}
 
+		/*
+		 * Direct the I/O responses of the files that determine the
+		 * readiness of the socket to 'handler'
+		 *
+		 * Files that are not open are skipped. The redirection fails only
+		 * if no file is open or if the plugin of an open file does not
+		 * support it.
+		 */
+		bool io_response_handler(Vfs::Io_response_handler *handler)
+		{
+			Fd const types[] = { Fd::DATA, Fd::CONNECT, Fd::ACCEPT };
+			unsigned const num = sizeof(types)/sizeof(types[0]);
+
+			unsigned i = 0, registered = 0;
+			for (; i < num; ++i) {
+				File_descriptor *file = _fd[types[i]].file;
+				if (!file)
+					continue;
+
+				if (!file->plugin->io_response_handler(*file, handler))
+					break;
+
+				registered++;
+			}
+			if (i == num && registered)
+				return true;
+
+			/* revert partial redirection */
+			if (handler)
+				while (i--)
+					if (File_descriptor *file = _fd[types[i]].file)
+						file->plugin->io_response_handler(*file, nullptr);
+
+			return false;
+		}
+
 		/*
 		 * Read the connect status from the connect file and return 0 if connected
 		 * or -1 with errno set to the error code.
@@ -343,6 +379,7 @@ struct Libc::Socket_fs::Plugin : Libc::Plugin
 	bool poll(File_descriptor &fd, struct pollfd &pfd) override;
 	int select(int, fd_set *, fd_set *, fd_set *, timeval *) override;
 	int ioctl(File_descriptor *, unsigned long, char *) override;
+	bool io_response_handler(File_descriptor &, Vfs::Io_response_handler *) override;
 };
 
 
@@ -1210,6 +1247,19 @@ bool Socket_fs::Plugin::poll(File_descriptor &fdo, struct pollfd &pfd)
 }
 
 
+bool Socket_fs::Plugin::io_response_handler(File_descriptor          &fdo,
+                                            Vfs::Io_response_handler *handler)
+{
+	try {
+		Socket_fs::Context *context = dynamic_cast<Socket_fs::Context *>(fdo.context);
+
+		return context && context->io_response_handler(handler);
+	} catch (Socket_fs::Context::Inaccessible) { }
+
+	return false;
+}
+
+
 bool Socket_fs::Plugin::supports_select(int nfds,
                                         fd_set *readfds, fd_set *writefds, fd_set *exceptfds,
                                         struct timeval *timeout)
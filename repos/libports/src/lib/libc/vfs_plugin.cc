@@ -2197,6 +2197,60 @@ int Libc::Vfs_plugin::rename(char const *from_path, char const *to_path)
 }
 
 
+int Libc::Vfs_plugin::_attach_vfs_dataspace(File_descriptor &fd,
+                                             ::size_t length, ::off_t offset,
+                                             bool writeable, void *&addr)
+{
+	/* create another VFS handle to keep the file open as long as the mapping exists */
+
+	Vfs::Vfs_handle *reference_handle = nullptr;
+	typedef Vfs::Directory_service::Open_result Result;
+	Result vfs_open_result;
+	monitor().monitor([&] {
+		vfs_open_result = _root_fs.open(fd.fd_path, fd.flags,
+		                                &reference_handle, _alloc);
+		return Fn::COMPLETE;
+	});
+
+	if (vfs_open_result != Result::OPEN_OK)
+		return ENFILE;
+
+	Genode::Dataspace_capability ds_cap;
+
+	monitor().monitor([&] {
+		ds_cap = writeable ? _root_fs.dataspace(fd.fd_path)
+		                   : _root_fs.read_only_dataspace(fd.fd_path);
+		return Fn::COMPLETE;
+	});
+
+	auto release_and_close = [&] {
+		monitor().monitor([&] {
+			if (ds_cap.valid())
+				_root_fs.release(fd.fd_path, ds_cap);
+			reference_handle->close();
+			return Fn::COMPLETE;
+		});
+	};
+
+	if (!ds_cap.valid()) {
+		release_and_close();
+		return ENODEV;
+	}
+
+	try {
+		addr = region_map().attach(ds_cap, length, offset, false, (void *)0,
+		                           false, writeable);
+	} catch (...) {
+		release_and_close();
+		return ENOMEM;
+	}
+
+	new (_alloc) Mmap_entry(_mmap_registry, addr, reference_handle,
+	                        fd.fd_path, ds_cap);
+	return 0;
+}
+
+
 void *Libc::Vfs_plugin::mmap(void *addr_in, ::size_t length, int prot, int flags,
                              File_descriptor *fd, ::off_t offset)
 {
@@ -2217,9 +2271,13 @@ void *Libc::Vfs_plugin::mmap(void *addr_in, ::size_t length, int prot, int flags
 	if (flags & MAP_PRIVATE) {
 
 		/*
-		 * XXX attempt to obtain memory mapping via
-		 *     'Vfs::Directory_service::dataspace'.
+		 * A read-only private mapping cannot be told apart from a shared
+		 * one. If the file system provides the file content as dataspace,
+		 * map it directly instead of copying the whole file up front.
 		 */
+		if (prot == PROT_READ
+		 && _attach_vfs_dataspace(*fd, length, offset, false, addr) == 0)
+			return addr;
 
 		addr = mem_alloc()->alloc(length, PAGE_SHIFT);
 		if (addr == (void *)-1) {
@@ -2247,54 +2305,18 @@ void *Libc::Vfs_plugin::mmap(void *addr_in, ::size_t length, int prot, int flags
 			read_addr += length_read;
 		}
 
-	} else if (flags & MAP_SHARED) {
-
-		/* create another VFS handle to keep the file open as long as the mapping exists */
-
-		Vfs::Vfs_handle *reference_handle = nullptr;
-		typedef Vfs::Directory_service::Open_result Result;
-		Result vfs_open_result;
-		monitor().monitor([&] {
-			vfs_open_result = _root_fs.open(fd->fd_path, fd->flags,
-			                                &reference_handle, _alloc);
-			return Fn::COMPLETE;
-		});
-
-		if (vfs_open_result != Result::OPEN_OK) {
-			error("mmap could not create reference VFS handle");
-			errno = ENFILE;
-			return MAP_FAILED;
-		}
-
-		Genode::Dataspace_capability ds_cap;
+		/* the part of the mapping beyond the end of the file reads as zero */
+		::memset(read_addr, 0, read_remain);
 
-		monitor().monitor([&] {
-			ds_cap = _root_fs.dataspace(fd->fd_path);
-			return Fn::COMPLETE;
-		});
+	} else if (flags & MAP_SHARED) {
 
-		if (!ds_cap.valid()) {
-			Genode::error("mmap got invalid dataspace capability");
-			monitor().monitor([&] {
-				reference_handle->close();
-				return Fn::COMPLETE;
-			});
-			errno = ENODEV;
+		int const result = _attach_vfs_dataspace(*fd, length, offset,
+		                                         prot & PROT_WRITE, addr);
+		if (result) {
+			error("mmap could not attach dataspace of ", fd->fd_path);
+			errno = result;
 			return MAP_FAILED;
 		}
-
-		try {
-			addr = region_map().attach(ds_cap, length, offset);
-		} catch (...) {
-			monitor().monitor([&] {
-				reference_handle->close();
-				return Fn::COMPLETE;
-			});
-			errno = ENOMEM;
-			return MAP_FAILED;
-		}
-
-		new (_alloc) Mmap_entry(_mmap_registry, addr, reference_handle);
 	}
 
 	return addr;
@@ -2309,26 +2331,29 @@ int Libc::Vfs_plugin::munmap(void *addr, ::size_t)
 		return 0;
 	}
 
-	/* shared mapping */
+	/* mapping of VFS dataspace */
 
-	Vfs::Vfs_handle *reference_handle = nullptr;
+	Mmap_entry *entry_ptr = nullptr;
 
 	_mmap_registry.for_each([&] (Mmap_entry &entry) {
-		if (entry.start == addr) {
-			reference_handle = entry.reference_handle;
-			destroy(_alloc, &entry);
-			region_map().detach(addr);
-		}
-	});
+		if (entry.start == addr)
+			entry_ptr = &entry; });
 
-	if (!reference_handle)
+	if (!entry_ptr)
 		return Errno(EINVAL);
 
+	Mmap_entry &entry = *entry_ptr;
+
+	region_map().detach(addr);
+
 	monitor().monitor([&] {
-		reference_handle->close();
+		_root_fs.release(entry.path.string(), entry.ds);
+		entry.reference_handle->close();
 		return Fn::COMPLETE;
 	});
 
+	destroy(_alloc, &entry);
+
 	return 0;
 }
 
@@ -2392,10 +2417,51 @@ int Libc::Vfs_plugin::pipe(Libc::File_descriptor *pipefdo[2])
 }
 
 
-bool Libc::Vfs_plugin::poll(File_descriptor &fd, struct pollfd &pfd)
+bool Libc::Vfs_plugin::poll(File_descriptor &fdo, struct pollfd &pfd)
 {
-	error("Plugin::poll() is deprecated");
-	return false;
+	enum {
+		POLLIN_MASK  = POLLIN  | POLLRDNORM | POLLRDBAND | POLLPRI,
+		POLLOUT_MASK = POLLOUT | POLLWRNORM | POLLWRBAND,
+	};
+
+	if (!vfs_handle(&fdo)) {
+		pfd.revents |= POLLNVAL;
+		return true;
+	}
+
+	bool res { false };
+
+	if ((pfd.events & POLLIN_MASK) && read_ready_from_kernel(&fdo)) {
+		pfd.revents |= pfd.events & POLLIN_MASK;
+		res = true;
+	}
+
+	/* XXX always writeable, as with 'select' */
+	if (pfd.events & POLLOUT_MASK) {
+		pfd.revents |= pfd.events & POLLOUT_MASK;
+		res = true;
+	}
+
+	return res;
+}
+
+
+bool Libc::Vfs_plugin::io_response_handler(File_descriptor          &fd,
+                                           Vfs::Io_response_handler *handler)
+{
+	Vfs::Vfs_handle *handle = vfs_handle(&fd);
+	if (!handle)
+		return false;
+
+	bool redirected = false;
+	handle->apply_handler([&] (Vfs::Io_response_handler &curr) {
+		redirected = (&curr != &_response_handler); });
+
+	if (handler && redirected)
+		return false;
+
+	handle->handler(handler ? handler : &_response_handler);
+	return true;
 }
 
 
@@ -0,0 +1,217 @@
+/*
+ * \brief  Test for the epoll interface of the libc
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* libc includes */
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <unistd.h>
+
+
+static void check(bool condition, char const *what)
+{
+	if (condition) return;
+
+	fprintf(stderr, "Error: %s (errno=%d)\n", what, errno);
+	exit(1);
+}
+
+
+static void consume(int fd)
+{
+	char buf[16];
+	check(read(fd, buf, sizeof(buf)) > 0, "read from pipe");
+}
+
+
+static void test_interest_set()
+{
+	int const epfd = epoll_create1(EPOLL_CLOEXEC);
+	check(epfd >= 0, "epoll_create1");
+
+	int pipefd[2];
+	check(pipe(pipefd) == 0, "pipe");
+
+	epoll_event ev { };
+	ev.events  = EPOLLIN;
+	ev.data.fd = pipefd[0];
+
+	check(epoll_ctl(epfd, EPOLL_CTL_ADD, pipefd[0], &ev) == 0, "EPOLL_CTL_ADD");
+	check(epoll_ctl(epfd, EPOLL_CTL_ADD, pipefd[0], &ev) == -1 && errno == EEXIST,
+	      "EPOLL_CTL_ADD twice yields EEXIST");
+	check(epoll_ctl(epfd, EPOLL_CTL_MOD, pipefd[1], &ev) == -1 && errno == ENOENT,
+	      "EPOLL_CTL_MOD of unknown fd yields ENOENT");
+	check(epoll_ctl(epfd, EPOLL_CTL_ADD, epfd, &ev) == -1 && errno == EINVAL,
+	      "EPOLL_CTL_ADD of epoll fd itself yields EINVAL");
+	check(epoll_ctl(pipefd[0], EPOLL_CTL_ADD, pipefd[1], &ev) == -1 && errno == EINVAL,
+	      "epoll_ctl on non-epoll fd yields EINVAL");
+
+	epoll_event out[4];
+	check(epoll_wait(epfd, out, 4, 0) == 0, "nothing ready initially");
+
+	check(write(pipefd[1], "x", 1) == 1, "write to pipe");
+	int n = epoll_wait(epfd, out, 4, 1000);
+	check(n == 1 && out[0].data.fd == pipefd[0] && (out[0].events & EPOLLIN),
+	      "read end reported ready");
+
+	/* level-triggered: still ready until consumed */
+	check(epoll_wait(epfd, out, 4, 0) == 1, "level-triggered stays ready");
+	consume(pipefd[0]);
+	check(epoll_wait(epfd, out, 4, 0) == 0, "not ready after read");
+
+	/* edge-triggered: reported once per write */
+	ev.events = EPOLLIN | EPOLLET;
+	check(epoll_ctl(epfd, EPOLL_CTL_MOD, pipefd[0], &ev) == 0, "EPOLL_CTL_MOD");
+	check(write(pipefd[1], "x", 1) == 1, "write to pipe");
+	check(epoll_wait(epfd, out, 4, 1000) == 1, "edge reported");
+	check(epoll_wait(epfd, out, 4, 0) == 0, "edge not reported twice");
+	consume(pipefd[0]);
+
+	/* one-shot: disabled after the first report until re-armed */
+	ev.events = EPOLLIN | EPOLLONESHOT;
+	check(epoll_ctl(epfd, EPOLL_CTL_MOD, pipefd[0], &ev) == 0, "EPOLL_CTL_MOD");
+	check(write(pipefd[1], "x", 1) == 1, "write to pipe");
+	check(epoll_wait(epfd, out, 4, 1000) == 1, "one-shot reported");
+	check(epoll_wait(epfd, out, 4, 0) == 0, "one-shot disabled");
+	check(epoll_ctl(epfd, EPOLL_CTL_MOD, pipefd[0], &ev) == 0, "re-arm one-shot");
+	check(epoll_wait(epfd, out, 4, 0) == 1, "re-armed one-shot reported");
+	consume(pipefd[0]);
+
+	check(epoll_ctl(epfd, EPOLL_CTL_DEL, pipefd[0], nullptr) == 0, "EPOLL_CTL_DEL");
+	check(epoll_ctl(epfd, EPOLL_CTL_DEL, pipefd[0], nullptr) == -1 && errno == ENOENT,
+	      "EPOLL_CTL_DEL twice yields ENOENT");
+
+	/* closing a watched fd removes it from the interest set */
+	check(epoll_ctl(epfd, EPOLL_CTL_ADD, pipefd[0], &ev) == 0, "EPOLL_CTL_ADD");
+	close(pipefd[0]);
+	close(pipefd[1]);
+	check(epoll_wait(epfd, out, 4, 0) == 0, "closed fd not reported");
+
+	close(epfd);
+
+	printf("interest set: ok\n");
+}
+
+
+static int wakeup_fd;
+
+static void *delayed_write(void *)
+{
+	timespec const ts { 0, 200*1000*1000 };
+	nanosleep(&ts, nullptr);
+	check(write(wakeup_fd, "x", 1) == 1, "delayed write");
+	return nullptr;
+}
+
+
+static void test_blocking_wait()
+{
+	int const epfd = epoll_create(1);
+	check(epfd >= 0, "epoll_create");
+
+	int pipefd[2];
+	check(pipe(pipefd) == 0, "pipe");
+	wakeup_fd = pipefd[1];
+
+	epoll_event ev { };
+	ev.events  = EPOLLIN;
+	ev.data.u64 = 0x1234567890ull;
+	check(epoll_ctl(epfd, EPOLL_CTL_ADD, pipefd[0], &ev) == 0, "EPOLL_CTL_ADD");
+
+	epoll_event out[1];
+	check(epoll_wait(epfd, out, 1, 100) == 0, "timeout");
+
+	pthread_t writer;
+	check(pthread_create(&writer, nullptr, delayed_write, nullptr) == 0,
+	      "pthread_create");
+
+	check(epoll_wait(epfd, out, 1, -1) == 1 && out[0].data.u64 == 0x1234567890ull,
+	      "blocking wait woken up by writer");
+
+	pthread_join(writer, nullptr);
+
+	close(pipefd[0]);
+	close(pipefd[1]);
+	close(epfd);
+
+	printf("blocking wait: ok\n");
+}
+
+
+static void test_large_interest_set()
+{
+	enum { NUM_PIPES = 200 };
+
+	static int pipefd[NUM_PIPES][2];
+
+	int const epfd = epoll_create1(0);
+	check(epfd >= 0, "epoll_create1");
+
+	for (unsigned i = 0; i < NUM_PIPES; i++) {
+		check(pipe(pipefd[i]) == 0, "pipe");
+
+		epoll_event ev { };
+		ev.events  = EPOLLIN | EPOLLET;
+		ev.data.u32 = i;
+		check(epoll_ctl(epfd, EPOLL_CTL_ADD, pipefd[i][0], &ev) == 0,
+		      "EPOLL_CTL_ADD");
+	}
+
+	epoll_event out[NUM_PIPES];
+	check(epoll_wait(epfd, out, NUM_PIPES, 0) == 0, "nothing ready initially");
+
+	enum { ROUNDS = 1000 };
+
+	timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (unsigned round = 0; round < ROUNDS; round++) {
+		unsigned const i = (round * 7) % NUM_PIPES;
+
+		check(write(pipefd[i][1], "x", 1) == 1, "write to pipe");
+
+		int const n = epoll_wait(epfd, out, NUM_PIPES, 1000);
+		check(n == 1 && out[0].data.u32 == i, "exactly the written pipe is ready");
+
+		consume(pipefd[i][0]);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	long const ms = (end.tv_sec - start.tv_sec)*1000
+	              + (end.tv_nsec - start.tv_nsec)/1000000;
+
+	printf("large interest set: ok (%u fds, %u rounds in %ld ms)\n",
+	       (unsigned)NUM_PIPES, (unsigned)ROUNDS, ms);
+
+	for (unsigned i = 0; i < NUM_PIPES; i++) {
+		close(pipefd[i][0]);
+		close(pipefd[i][1]);
+	}
+	close(epfd);
+}
+
+
+int main(int, char **)
+{
+	test_interest_set();
+	test_blocking_wait();
+	test_large_interest_set();
+
+	printf("--- test succeeded ---\n");
+	return 0;
+}
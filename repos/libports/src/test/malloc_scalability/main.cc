@@ -0,0 +1,97 @@
+/*
+ * \brief  Scalability benchmark for malloc and free
+ * \author agent
+ * \date   2026-10-16
+ *
+ * For 1 to MAX_THREADS concurrent pthreads, each thread repeatedly
+ * allocates and frees small objects of varying sizes from a per-thread
+ * working set. The benchmark reports the total number of malloc/free
+ * operations per second. Comparing runs with and without the malloc
+ * thread cache ('<libc> <malloc thread_cache="yes"/> </libc>') shows the
+ * contention on the shared malloc pool.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* libc includes */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum {
+	MAX_THREADS      = 8,
+	WORKING_SET      = 64,
+	OPS_PER_THREAD   = 1000000,
+};
+
+
+static unsigned long long now_us()
+{
+	struct timespec ts { };
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1000000ULL + ts.tv_nsec/1000;
+}
+
+
+static void *thread_entry(void *arg)
+{
+	unsigned seed = (unsigned)(unsigned long)arg;
+	void *objects[WORKING_SET] { };
+
+	for (unsigned op = 0; op < OPS_PER_THREAD; op += 2) {
+
+		seed = seed*1103515245 + 12345;
+		unsigned const idx  = (seed >> 8) % WORKING_SET;
+		size_t   const size = 16 + ((seed >> 16) % 1000);
+
+		free(objects[idx]);
+		objects[idx] = malloc(size);
+		if (!objects[idx]) {
+			printf("Error: malloc of %zu bytes failed\n", size);
+			exit(-1);
+		}
+	}
+	for (unsigned idx = 0; idx < WORKING_SET; idx++)
+		free(objects[idx]);
+
+	return nullptr;
+}
+
+
+int main(int, char **)
+{
+	printf("--- malloc scalability benchmark ---\n");
+
+	for (unsigned num_threads = 1; num_threads <= MAX_THREADS; num_threads++) {
+
+		pthread_t threads[MAX_THREADS];
+
+		unsigned long long const start_us = now_us();
+
+		for (unsigned i = 0; i < num_threads; i++) {
+			if (pthread_create(&threads[i], nullptr, thread_entry,
+			                   (void *)(unsigned long)(i + 1))) {
+				printf("Error: could not create thread %u\n", i);
+				return -1;
+			}
+		}
+		for (unsigned i = 0; i < num_threads; i++)
+			pthread_join(threads[i], nullptr);
+
+		unsigned long long const duration_us = now_us() - start_us;
+		unsigned long long const ops = (unsigned long long)OPS_PER_THREAD * num_threads;
+
+		printf("threads=%u ops=%llu duration=%llu ms ops/s=%llu\n",
+		       num_threads, ops, duration_us/1000,
+		       duration_us ? ops*1000000ULL/duration_us : 0ULL);
+	}
+
+	printf("--- malloc scalability benchmark finished ---\n");
+	return 0;
+}
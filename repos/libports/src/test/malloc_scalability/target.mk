@@ -0,0 +1,3 @@
+TARGET = test-malloc_scalability
+SRC_CC = main.cc
+LIBS   = posix
@@ -14,6 +14,8 @@
 #ifndef _INCLUDE__BLIT__BLIT_H_
 #define _INCLUDE__BLIT__BLIT_H_
 
+#include <base/stdint.h>
+
 /**
  * Blit memory from source buffer to destination buffer
  *
@@ -31,4 +33,47 @@
 extern "C" void blit(void const *src, unsigned src_w,
                      void *dst, unsigned dst_w, int w, int h);
 
+
+/*
+ * Pixel operations on a line of pixels
+ *
+ * The operations use the SIMD extensions of the CPU, which are detected
+ * at runtime. The pixel buffers are passed as untyped pointers like for
+ * 'blit' because the pixel types of the 'os' API are packed.
+ */
+namespace Blit {
+
+	using Genode::uint32_t;
+
+	/**
+	 * Return name of the SIMD kernels used, e.g., "sse2"
+	 */
+	char const *kernels_name();
+
+	/**
+	 * Set 'n' 32-bit pixels to 'value'
+	 */
+	void fill_32bit(void *dst, uint32_t value, unsigned n);
+
+	/**
+	 * Alpha-blend 'n' RGB888 pixels onto 'dst'
+	 *
+	 * Each destination pixel with a non-zero 'alpha' value is replaced by
+	 * 'Pixel_rgb888::mix(dst[i], src[i], alpha[i] + 1)'.
+	 */
+	void blend_rgb888(void *dst, void const *src,
+	                  unsigned char const *alpha, unsigned n);
+
+	/**
+	 * Convert 'n' RGB888 pixels to RGB565 while applying a dither matrix
+	 *
+	 * \param x,y  position of the first pixel within the destination,
+	 *             which selects the values of the dither matrix
+	 *
+	 * The result equals the one of the generic 'Dither_painter'.
+	 */
+	void dither_rgb888_to_rgb565(void *dst, void const *src,
+	                             unsigned n, unsigned x, unsigned y);
+}
+
 #endif /* _INCLUDE__BLIT__BLIT_H_ */
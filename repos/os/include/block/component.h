@@ -160,7 +160,14 @@ class Block::Session_component : public Block::Session_component_base,
 
 				case Block::Packet_descriptor::TRIM:
 
-					/* trim is a nop */
+					if (!_writeable) {
+						_ack_packet(_p_to_handle);
+						break;
+					}
+
+					/* perform (blocking) trim */
+					_driver.trim(packet.block_number(), packet.block_count());
+
 					_p_to_handle.succeeded(true);
 					_ack_packet(_p_to_handle);
 					_p_to_handle = Packet_descriptor();
@@ -212,6 +212,20 @@ class Block::Driver : Genode::Interface
 		 */
 		virtual void sync() {}
 
+		/**
+		 * Discard blocks
+		 *
+		 * \param block_number  number of first block to discard
+		 * \param block_count   number of blocks to discard
+		 *
+		 * \throw Io_error
+		 *
+		 * Note: the content of the discarded blocks is undefined afterwards.
+		 *       The default implementation ignores the request.
+		 */
+		virtual void trim(sector_t       /* block_number */,
+		                  Genode::size_t /* block_count */) { }
+
 		/**
 		 * Informs the driver that the client session was closed
 		 *
@@ -241,20 +241,61 @@ class Block::Request_stream : Genode::Noncopyable
 			}
 		}
 
+	private:
+
+		/**
+		 * Acknowledgements collected by 'try_acknowledge'
+		 *
+		 * The acknowledgements are handed over to the packet stream in
+		 * batches to update the acknowledgement queue only once per batch.
+		 */
+		struct Ack_batch : Noncopyable
+		{
+			enum { CAPACITY = 32 };
+
+			Tx_sink &_tx_sink;
+
+			Block::Packet_descriptor _packets[CAPACITY] { };
+
+			unsigned _count = 0;
+
+			Ack_batch(Tx_sink &tx_sink) : _tx_sink(tx_sink) { }
+
+			~Ack_batch() { flush(); }
+
+			void flush()
+			{
+				if (_count)
+					(void)_tx_sink.try_ack_packets(_packets, _count);
+
+				_count = 0;
+			}
+
+			void add(Block::Packet_descriptor const &packet)
+			{
+				_packets[_count++] = packet;
+
+				if (_count == CAPACITY)
+					flush();
+			}
+		};
+
+	public:
+
 		class Ack : Noncopyable
 		{
 			private:
 
 				friend class Request_stream;
 
-				Tx_sink &_tx_sink;
+				Ack_batch &_batch;
 
 				bool _submitted = false;
 
 				Genode::size_t const _block_size;
 
-				Ack(Tx_sink &tx_sink, Genode::size_t block_size)
-				: _tx_sink(tx_sink), _block_size(block_size) { }
+				Ack(Ack_batch &batch, Genode::size_t block_size)
+				: _batch(batch), _block_size(block_size) { }
 
 			public:
 
@@ -274,7 +315,7 @@ class Block::Request_stream : Genode::Noncopyable
 
 					packet.succeeded(request.success);
 
-					_tx_sink.try_ack_packet(packet);
+					_batch.add(packet);
 					_submitted = true;
 				}
 		};
@@ -285,16 +326,20 @@ class Block::Request_stream : Genode::Noncopyable
 		 * The method repeatedly calls the functor 'fn' with an 'Ack' reference,
 		 * which provides an interface to 'submit' one acknowledgement. The
 		 * iteration stops when the acknowledgement queue is fully populated or if
-		 * the functor does not call 'Ack::submit'.
+		 * the functor does not call 'Ack::submit'. The submitted
+		 * acknowledgements are placed into the acknowledgement queue in
+		 * batches.
 		 */
 		template <typename FN>
 		void try_acknowledge(FN const &fn)
 		{
 			Tx_sink &tx_sink = *_tx.sink();
 
-			while (tx_sink.ack_slots_free()) {
+			Ack_batch batch(tx_sink);
+
+			for (unsigned slots = tx_sink.ack_slots_free(); slots; slots--) {
 
-				Ack ack(tx_sink, _payload._info.block_size);
+				Ack ack(batch, _payload._info.block_size);
 
 				fn(ack);
 
@@ -58,6 +58,41 @@ struct Capture::Session : Genode::Session
 		return bytes_per_pixel*size.count();
 	}
 
+	/**
+	 * Damage information of a frame captured via 'capture_frame'
+	 *
+	 * The damage list is located in the shared dataspace after the two
+	 * pixel buffers, at the offset 'Damage::offset'. The geometry is
+	 * relative to the viewport specified for the 'capture_frame' call.
+	 */
+	struct Damage
+	{
+		enum { MAX_RECTS = 256U };
+
+		Rect rects[MAX_RECTS];
+
+		static size_t offset(Area size) { return 2*buffer_bytes(size); }
+	};
+
+	/**
+	 * Return number of bytes needed for the double-buffered frames
+	 */
+	static size_t frames_bytes(Area size)
+	{
+		return Damage::offset(size) + sizeof(Damage);
+	}
+
+	/**
+	 * Result type of 'capture_frame'
+	 */
+	struct Frame
+	{
+		unsigned buffer;     /* index of pixel buffer holding the frame */
+		unsigned num_rects;  /* number of valid 'Damage::rects' */
+
+		bool valid() const { return num_rects > 0; }
+	};
+
 	/**
 	 * Request current screen size
 	 */
@@ -81,8 +116,22 @@ struct Capture::Session : Genode::Session
 	 */
 	virtual void buffer(Area size) = 0;
 
+	/**
+	 * Define dimensions of double-buffered frames for 'capture_frame'
+	 *
+	 * In contrast to 'buffer', the shared dataspace holds two pixel
+	 * buffers of the specified 'size' followed by the 'Damage' list. The
+	 * size of the dataspace is 'frames_bytes(size)'.
+	 *
+	 * \throw Out_of_ram  session quota does not suffice for specified
+	 *                    buffer dimensions
+	 * \throw Out_of_caps
+	 */
+	virtual void frames(Area size) = 0;
+
 	/**
 	 * Request dataspace of the shared pixel buffer defined via 'buffer'
+	 * or 'frames'
 	 */
 	virtual Dataspace_capability dataspace() = 0;
 
@@ -110,11 +159,31 @@ struct Capture::Session : Genode::Session
 	/**
 	 * Update the pixel-buffer with content at the specified screen position
 	 *
+	 * This method is available if the pixel buffer was defined via 'buffer'.
+	 *
 	 * \return  geometry information about the content that changed since the
 	 *          previous call of 'capture_at'
 	 */
 	virtual Affected_rects capture_at(Point) = 0;
 
+	/**
+	 * Update the pixel buffer not used by the previous frame
+	 *
+	 * This method is available if the dataspace was defined via 'frames'.
+	 * The server brings the pixel buffer up to date by redrawing only the
+	 * parts changed since it was used the last time. It records the areas
+	 * changed since the previous frame in the damage list. If the damage
+	 * exceeds 'Damage::MAX_RECTS', the surplus rectangles are merged into
+	 * the last one.
+	 *
+	 * While processing a frame, the client may keep reading the pixels of
+	 * the previous frame, which reside in the other pixel buffer.
+	 *
+	 * \return  index of the pixel buffer and number of damage rectangles,
+	 *          which is zero if nothing changed
+	 */
+	virtual Frame capture_frame(Point) = 0;
+
 
 	/*********************
 	 ** RPC declaration **
@@ -124,11 +193,15 @@ struct Capture::Session : Genode::Session
 	GENODE_RPC(Rpc_screen_size_sigh, void, screen_size_sigh, Signal_context_capability);
 	GENODE_RPC_THROW(Rpc_buffer, void, buffer,
 	                 GENODE_TYPE_LIST(Out_of_ram, Out_of_caps), Area);
+	GENODE_RPC_THROW(Rpc_frames, void, frames,
+	                 GENODE_TYPE_LIST(Out_of_ram, Out_of_caps), Area);
 	GENODE_RPC(Rpc_dataspace, Dataspace_capability, dataspace);
 	GENODE_RPC(Rpc_capture_at, Affected_rects, capture_at, Point);
+	GENODE_RPC(Rpc_capture_frame, Frame, capture_frame, Point);
 
 	GENODE_RPC_INTERFACE(Rpc_screen_size, Rpc_screen_size_sigh, Rpc_buffer,
-	                     Rpc_dataspace, Rpc_capture_at);
+	                     Rpc_frames, Rpc_dataspace, Rpc_capture_at,
+	                     Rpc_capture_frame);
 };
 
 #endif /* _INCLUDE__CAPTURE_SESSION__CAPTURE_SESSION_H_ */
@@ -36,12 +36,19 @@ struct Capture::Session_client : public Genode::Rpc_client<Session>
 
 	void buffer(Area size) override { call<Rpc_buffer>(size); }
 
+	void frames(Area size) override { call<Rpc_frames>(size); }
+
 	Dataspace_capability dataspace() override { return call<Rpc_dataspace>(); }
 
 	Affected_rects capture_at(Point pos) override
 	{
 		return call<Rpc_capture_at>(pos);
 	}
+
+	Frame capture_frame(Point pos) override
+	{
+		return call<Rpc_capture_frame>(pos);
+	}
 };
 
 #endif /* _INCLUDE__CAPTURE_SESSION__CLIENT_H_ */
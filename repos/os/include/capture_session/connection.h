@@ -34,6 +34,17 @@ class Capture::Connection : public Genode::Connection<Session>,
 
 		size_t _session_quota = 0;
 
+		void _upgrade_for(size_t needed)
+		{
+			size_t const upgrade = needed > _session_quota
+			                     ? needed - _session_quota
+			                     : 0;
+			if (upgrade > 0) {
+				this->upgrade_ram(upgrade);
+				_session_quota += upgrade;
+			}
+		}
+
 	public:
 
 		/**
@@ -50,18 +61,18 @@ class Capture::Connection : public Genode::Connection<Session>,
 
 		void buffer(Area size) override
 		{
-			size_t const needed  = buffer_bytes(size);
-			size_t const upgrade = needed > _session_quota
-			                     ? needed - _session_quota
-			                     : 0;
-			if (upgrade > 0) {
-				this->upgrade_ram(upgrade);
-				_session_quota += upgrade;
-			}
+			_upgrade_for(buffer_bytes(size));
 
 			Session_client::buffer(size);
 		}
 
+		void frames(Area size) override
+		{
+			_upgrade_for(frames_bytes(size));
+
+			Session_client::frames(size);
+		}
+
 		struct Screen;
 };
 
@@ -42,6 +42,8 @@ namespace Net {
 
 	} __attribute__((packed));
 
+	class Internet_checksum_diff;
+
 	Genode::uint16_t internet_checksum(Packed_uint16 const *addr,
 	                                   Genode::size_t       size,
 	                                   Genode::addr_t       init_sum = 0);
@@ -54,4 +56,41 @@ namespace Net {
 	                                             Ipv4_address          &ip_dst);
 }
 
+
+/**
+ * Accumulated change of data that is covered by an internet checksum
+ *
+ * Instead of summing up all covered data again, a checksum can be adapted to
+ * the modification of single header fields by applying the difference
+ * between their old and new values as described in RFC 1624.
+ */
+class Net::Internet_checksum_diff
+{
+	private:
+
+		Genode::addr_t _value { 0 };
+
+	public:
+
+		/**
+		 * Add up the difference between two equally-sized data chunks
+		 *
+		 * \param size  size of each chunk in bytes, must be even
+		 */
+		void add_up_diff(Packed_uint16 const *new_data,
+		                 Packed_uint16 const *old_data,
+		                 Genode::size_t       size);
+
+		void add_up_diff(Internet_checksum_diff const &other) {
+			_value += other._value; }
+
+		/**
+		 * Return 'checksum' adapted to the accumulated difference
+		 *
+		 * The checksum is expected in the byte order in which it is stored
+		 * in the packet.
+		 */
+		Genode::uint16_t apply_to(Genode::uint16_t checksum) const;
+};
+
 #endif /* _NET__INTERNET_CHECKSUM_H_ */
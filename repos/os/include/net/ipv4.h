@@ -31,6 +31,7 @@ namespace Net {
 
 	class Ipv4_address;
 	class Ipv4_packet;
+	class Internet_checksum_diff;
 
 	static inline Genode::size_t ascii_to(char const *, Net::Ipv4_address &);
 }
@@ -94,6 +95,8 @@ class Net::Ipv4_packet
 
 		void update_checksum();
 
+		void update_checksum(Internet_checksum_diff const &icd);
+
 		bool checksum_error() const;
 
 	private:
@@ -199,6 +202,9 @@ class Net::Ipv4_packet
 		void src(Ipv4_address v)                 { v.copy(&_src); }
 		void dst(Ipv4_address v)                 { v.copy(&_dst); }
 
+		void src(Ipv4_address v, Internet_checksum_diff &icd);
+		void dst(Ipv4_address v, Internet_checksum_diff &icd);
+
 		void flags(Genode::uint8_t v)
 		{
 			Genode::uint16_t be = host_to_big_endian(_offset_6_u16);
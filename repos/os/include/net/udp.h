@@ -22,7 +22,11 @@
 #include <net/ethernet.h>
 #include <net/ipv4.h>
 
-namespace Net { class Udp_packet; }
+namespace Net {
+
+	class Udp_packet;
+	class Internet_checksum_diff;
+}
 
 
 /**
@@ -75,6 +79,14 @@ class Net::Udp_packet
 		void update_checksum(Ipv4_address ip_src,
 		                     Ipv4_address ip_dst);
 
+		/**
+		 * Adapt checksum to modified header fields
+		 *
+		 * A checksum of zero, which means that the sender did not compute
+		 * a checksum, is left untouched.
+		 */
+		void update_checksum(Internet_checksum_diff const &icd);
+
 		bool checksum_error(Ipv4_address ip_src,
 		                    Ipv4_address ip_dst) const;
 
@@ -92,6 +104,9 @@ class Net::Udp_packet
 		void src_port(Port p)           { _src_port = host_to_big_endian(p.value); }
 		void dst_port(Port p)           { _dst_port = host_to_big_endian(p.value); }
 
+		void src_port(Port p, Internet_checksum_diff &icd);
+		void dst_port(Port p, Internet_checksum_diff &icd);
+
 
 		/*********
 		 ** log **
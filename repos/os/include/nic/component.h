@@ -73,6 +73,31 @@ class Nic::Session_component : Communication_buffers, public Session_rpc_object
 
 		void _dispatch() { _handle_packet_stream(); }
 
+		/**
+		 * Release the rx packets acknowledged by the client
+		 *
+		 * The acknowledgements are fetched from the ack queue in batches
+		 * and the client is woken up at most once.
+		 */
+		void _release_acked_rx_packets()
+		{
+			enum { BATCH_SIZE = 64 };
+
+			Packet_descriptor acked[BATCH_SIZE];
+
+			for (;;) {
+				unsigned const num =
+					_rx.source()->try_get_acked_packets(acked, BATCH_SIZE);
+
+				for (unsigned i = 0; i < num; i++)
+					_rx.source()->release_packet(acked[i]);
+
+				if (num < BATCH_SIZE)
+					break;
+			}
+			_rx.source()->wakeup();
+		}
+
 		Genode::Signal_handler<Session_component> _packet_stream_dispatcher {
 			_ep, *this, &Session_component::_dispatch };
 
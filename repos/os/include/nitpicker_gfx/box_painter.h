@@ -14,6 +14,7 @@
 #ifndef _INCLUDE__NITPICKER_GFX__BOX_PAINTER_H_
 #define _INCLUDE__NITPICKER_GFX__BOX_PAINTER_H_
 
+#include <blit/blit.h>
 #include <os/surface.h>
 
 
@@ -41,7 +42,16 @@ struct Box_painter
 
 		int const alpha = color.a;
 
-		if (color.opaque())
+		/*
+		 * Use the SIMD kernel of the blit library for the most common
+		 * pixel format
+		 */
+		if (color.opaque() && PT::format() == Genode::Surface_base::RGB888
+		                   && sizeof(PT) == sizeof(Genode::uint32_t))
+			for (int h = clipped.h() ; h--; dst_line += surface.size().w())
+				Blit::fill_32bit(dst_line, pix.pixel, clipped.w());
+
+		else if (color.opaque())
 			for (int w, h = clipped.h() ; h--; dst_line += surface.size().w())
 				for (dst = dst_line, w = clipped.w(); w--; dst++)
 					*dst = pix;
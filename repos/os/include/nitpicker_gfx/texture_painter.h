@@ -94,6 +94,17 @@ struct Texture_painter
 				break;
 			}
 
+			/*
+			 * Use the SIMD kernel of the blit library for the most
+			 * common pixel format
+			 */
+			if (PT::format() == Genode::Surface_base::RGB888
+			 && sizeof(PT) == sizeof(Genode::uint32_t)) {
+				for (j = clipped.h(); j--; src += src_w, alpha += src_w, dst += dst_w)
+					Blit::blend_rgb888(dst, src, alpha, clipped.w());
+				break;
+			}
+
 			/*
 			 * Copy texture with alpha blending
 			 */
@@ -18,6 +18,7 @@
 #include <util/dither_matrix.h>
 #include <os/surface.h>
 #include <os/texture.h>
+#include <blit/blit.h>
 
 
 struct Dither_painter
@@ -54,6 +55,26 @@ struct Dither_painter
 		unsigned const x_max = min((unsigned)clipped.x2(), dst_x + texture.size().w() - 1);
 		unsigned const y_max = min((unsigned)clipped.y2(), dst_y + texture.size().h() - 1);
 
+		/*
+		 * Use the SIMD kernel of the blit library for converting RGB888
+		 * to RGB565, which has no alpha channel
+		 */
+		if (SRC_PT::format() == Genode::Surface_base::RGB888
+		 && DST_PT::format() == Genode::Surface_base::RGB565
+		 && sizeof(SRC_PT) == sizeof(Genode::uint32_t)
+		 && sizeof(DST_PT) == sizeof(Genode::uint16_t)) {
+
+			if (x_max < dst_x) return;
+
+			for (unsigned y = dst_y; y <= y_max; y++) {
+				Blit::dither_rgb888_to_rgb565(dst_line, src_pixel_line,
+				                              x_max - dst_x + 1, dst_x, y);
+				src_pixel_line += src_line_len;
+				dst_line       += dst_line_len;
+			}
+			return;
+		}
+
 		for (unsigned y = dst_y; y <= y_max; y++) {
 
 			src_pixel = src_pixel_line;
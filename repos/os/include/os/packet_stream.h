@@ -61,6 +61,12 @@
  * acknowledge buffers using the methods 'packet_avail',
  * 'ready_to_submit', 'ready_to_ack', and 'ack_avail'.
  *
+ * Besides the single-packet operations, both sides can transfer a batch of
+ * packet descriptors at once via 'try_submit_packets', 'try_get_packets',
+ * 'try_ack_packets', and 'try_get_acked_packets'. A batch updates the
+ * respective queue index only once and defers the wakeup of the other side
+ * to the next call of 'wakeup', which submits at most one signal.
+ *
  * If bidirectional data exchange between two processes is desired, two pairs
  * of 'Packet_stream_source' and 'Packet_stream_sink' should be instantiated.
  */
@@ -82,6 +88,7 @@
 #include <dataspace/client.h>
 #include <util/string.h>
 #include <util/construct_at.h>
+#include <util/misc_math.h>
 
 namespace Genode {
 
@@ -173,6 +180,17 @@ class Genode::Packet_descriptor_queue
 			PACKET_DESCRIPTOR _queue[QUEUE_SIZE];
 		};
 
+		/*
+		 * The indices reside in memory shared with the peer and may thereby
+		 * hold any value. They are therefore reduced before being used.
+		 */
+		static unsigned _slots_free(unsigned head, unsigned tail)
+		{
+			head %= QUEUE_SIZE;
+			tail %= QUEUE_SIZE;
+			return ((tail > head) ? tail - head : QUEUE_SIZE - head + tail) - 1;
+		}
+
 	public:
 
 		typedef PACKET_DESCRIPTOR Packet_descriptor;
@@ -211,6 +229,29 @@ class Genode::Packet_descriptor_queue
 			return true;
 		}
 
+		/**
+		 * Place up to 'count' packet descriptors into queue
+		 *
+		 * The head index is updated only once after all descriptors are
+		 * stored.
+		 *
+		 * \return number of packet descriptors added, which is less than
+		 *         'count' if the queue becomes full
+		 */
+		unsigned add(PACKET_DESCRIPTOR const *packets, unsigned count)
+		{
+			unsigned head = _head%QUEUE_SIZE;
+
+			unsigned const num = Genode::min(count, _slots_free(head, _tail));
+
+			for (unsigned i = 0; i < num; i++) {
+				_queue[head] = packets[i];
+				head = (head + 1)%QUEUE_SIZE;
+			}
+			_head = head;
+			return num;
+		}
+
 		/**
 		 * Take packet descriptor from queue
 		 *
@@ -223,6 +264,29 @@ class Genode::Packet_descriptor_queue
 			return packet;
 		}
 
+		/**
+		 * Take up to 'max_count' packet descriptors from queue
+		 *
+		 * The tail index is updated only once after all descriptors are
+		 * fetched.
+		 *
+		 * \return number of packet descriptors stored at 'out'
+		 */
+		unsigned get(PACKET_DESCRIPTOR *out, unsigned max_count)
+		{
+			unsigned tail = _tail%QUEUE_SIZE;
+
+			unsigned const num = Genode::min(max_count,
+			                                 QUEUE_SIZE - 1 - _slots_free(_head, tail));
+
+			for (unsigned i = 0; i < num; i++) {
+				out[i] = _queue[tail];
+				tail = (tail + 1)%QUEUE_SIZE;
+			}
+			_tail = tail;
+			return num;
+		}
+
 		/**
 		 * Return current packet descriptor
 		 */
@@ -255,9 +319,12 @@ class Genode::Packet_descriptor_queue
 		/**
 		 * Return number of slots left to be put into the queue
 		 */
-		unsigned slots_free() {
-			return ((_tail > _head) ? _tail - _head
-			                        : QUEUE_SIZE - _head + _tail) - 1; }
+		unsigned slots_free() { return _slots_free(_head, _tail); }
+
+		/**
+		 * Return number of packet descriptors stored in the queue
+		 */
+		unsigned slots_used() { return QUEUE_SIZE - 1 - slots_free(); }
 };
 
 
@@ -365,6 +432,29 @@ class Genode::Packet_descriptor_transmitter
 			return true;
 		}
 
+		/**
+		 * Put as many of the 'count' packets into the tx queue as possible
+		 *
+		 * \return number of transmitted packets
+		 *
+		 * This method never blocks. The wakeup of the receiver is deferred
+		 * to the next call of 'tx_wakeup'.
+		 */
+		unsigned try_tx(typename TX_QUEUE::Packet_descriptor const *packets,
+		                unsigned count)
+		{
+			Genode::Mutex::Guard mutex_guard(_tx_queue_mutex);
+
+			bool const was_empty = _tx_queue->empty();
+
+			unsigned const num = _tx_queue->add(packets, count);
+
+			if (num && was_empty)
+				_tx_wakeup_needed = true;
+
+			return num;
+		}
+
 		bool tx_wakeup()
 		{
 			Genode::Mutex::Guard mutex_guard(_tx_queue_mutex);
@@ -483,6 +573,29 @@ class Genode::Packet_descriptor_receiver
 			return packet;
 		}
 
+		/**
+		 * Take up to 'max_count' packets from the rx queue
+		 *
+		 * \return number of packets stored at 'out'
+		 *
+		 * This method never blocks. The wakeup of the transmitter is
+		 * deferred to the next call of 'rx_wakeup'.
+		 */
+		unsigned try_rx(typename RX_QUEUE::Packet_descriptor *out,
+		                unsigned max_count)
+		{
+			Genode::Mutex::Guard mutex_guard(_rx_queue_mutex);
+
+			bool const was_full = _rx_queue->full();
+
+			unsigned const num = _rx_queue->get(out, max_count);
+
+			if (num && was_full)
+				_rx_wakeup_needed = true;
+
+			return num;
+		}
+
 		bool rx_wakeup()
 		{
 			Genode::Mutex::Guard mutex_guard(_rx_queue_mutex);
@@ -813,6 +926,21 @@ class Genode::Packet_stream_source : private Packet_stream_base
 			return _submit_transmitter.try_tx(packet);
 		}
 
+		/**
+		 * Submit a batch of packets to the sink if possible
+		 *
+		 * \param packets  array of 'count' packet descriptors
+		 * \return         number of submitted packets, which is less than
+		 *                 'count' if the submit queue became congested
+		 *
+		 * This method never blocks. The sink is notified by the next call
+		 * of 'wakeup'.
+		 */
+		unsigned try_submit_packets(Packet_descriptor const *packets, unsigned count)
+		{
+			return _submit_transmitter.try_tx(packets, count);
+		}
+
 		/**
 		 * Wake up the packet sink if needed
 		 *
@@ -850,6 +978,19 @@ class Genode::Packet_stream_source : private Packet_stream_base
 			return _ack_receiver.try_rx();
 		}
 
+		/**
+		 * Fetch up to 'max_count' acknowledgements from the sink
+		 *
+		 * \return number of packet descriptors stored at 'out'
+		 *
+		 * This method never blocks. The sink is notified about the freed
+		 * acknowledgement slots by the next call of 'wakeup'.
+		 */
+		unsigned try_get_acked_packets(Packet_descriptor *out, unsigned max_count)
+		{
+			return _ack_receiver.try_rx(out, max_count);
+		}
+
 		/**
 		 * Release bulk-buffer space consumed by the packet
 		 */
@@ -973,6 +1114,19 @@ class Genode::Packet_stream_sink : private Packet_stream_base
 			return _submit_receiver.try_rx();
 		}
 
+		/**
+		 * Fetch up to 'max_count' packets from source
+		 *
+		 * \return number of packet descriptors stored at 'out'
+		 *
+		 * This method never blocks. The source is notified about the freed
+		 * submit slots by the next call of 'wakeup'.
+		 */
+		unsigned try_get_packets(Packet_descriptor *out, unsigned max_count)
+		{
+			return _submit_receiver.try_rx(out, max_count);
+		}
+
 		/**
 		 * Wake up the packet source if needed
 		 *
@@ -1037,6 +1191,21 @@ class Genode::Packet_stream_sink : private Packet_stream_base
 			return _ack_transmitter.try_tx(packet);
 		}
 
+		/**
+		 * Acknowledge a batch of packets to the client if possible
+		 *
+		 * \param packets  array of 'count' packet descriptors
+		 * \return         number of acknowledged packets, which is less than
+		 *                 'count' if the acknowledgement queue became congested
+		 *
+		 * This method never blocks. The source is notified by the next call
+		 * of 'wakeup'.
+		 */
+		unsigned try_ack_packets(Packet_descriptor const *packets, unsigned count)
+		{
+			return _ack_transmitter.try_tx(packets, count);
+		}
+
 		void debug_print_buffers() {
 			Packet_stream_base::_debug_print_buffers(); }
 
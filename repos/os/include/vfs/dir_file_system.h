@@ -30,6 +30,11 @@ class Vfs::Dir_file_system : public File_system
 
 		enum { MAX_NAME_LEN = 128 };
 
+		/**
+		 * Hit and miss counters of the lookup cache
+		 */
+		struct Lookup_stats { unsigned long hits, misses; };
+
 	private:
 
 		/*
@@ -111,8 +116,27 @@ class Vfs::Dir_file_system : public File_system
 
 			Watch_handle_registry  handle_registry { };
 
-			Dir_watch_handle(File_system &fs, Genode::Allocator &alloc)
-			: Vfs_watch_handle(fs, alloc) { }
+			Dir_file_system &dir_fs;
+
+			/**
+			 * Handler of the sub-handles, flushes the lookup cache before
+			 * notifying the application
+			 */
+			struct Response_handler : Watch_response_handler
+			{
+				Dir_watch_handle &handle;
+
+				Response_handler(Dir_watch_handle &handle) : handle(handle) { }
+
+				void watch_response() override
+				{
+					handle.dir_fs._flush_lookup_cache();
+					handle.watch_response();
+				}
+			} response_handler { *this };
+
+			Dir_watch_handle(Dir_file_system &fs, Genode::Allocator &alloc)
+			: Vfs_watch_handle(fs, alloc), dir_fs(fs) { }
 
 			~Dir_watch_handle()
 			{
@@ -129,8 +153,12 @@ class Vfs::Dir_file_system : public File_system
 			 */
 			void handler(Watch_response_handler *h) override
 			{
+				Vfs_watch_handle::handler(h);
+
+				Watch_response_handler * const sub_h = h ? &response_handler : nullptr;
+
 				handle_registry.for_each( [&] (Watch_handle_element &elem) {
-					elem.watch_handle.handler(h); } );
+					elem.watch_handle.handler(sub_h); } );
 			}
 		};
 
@@ -138,6 +166,239 @@ class Vfs::Dir_file_system : public File_system
 		/* pointer to first child file system */
 		File_system *_first_file_system = nullptr;
 
+		/* true if any child file system is a '<dir>' node */
+		bool _dir_children = false;
+
+		/* true if any child file system is no '<dir>' node */
+		bool _leaf_children = false;
+
+		/*
+		 * Only the VFS root caches lookups. A leaf file system at the root is
+		 * a candidate for any path so that the root has to decide among its
+		 * children anyway.
+		 */
+		bool _lookup_caching = false;
+
+		/**
+		 * Return 'fs' as '<dir>' node, or nullptr if 'fs' is no '<dir>' node
+		 *
+		 * A file system derived from 'Dir_file_system' in root mode is not
+		 * considered as '<dir>' node.
+		 */
+		static Dir_file_system *_dir_node(File_system &fs)
+		{
+			Dir_file_system * const dir = dynamic_cast<Dir_file_system *>(&fs);
+
+			return (dir && !dir->_vfs_root) ? dir : nullptr;
+		}
+
+		/**
+		 * Return true if 'fs' is a '<dir>' node that cannot resolve a path
+		 * starting with the 'len' characters at 'element'
+		 */
+		static bool _skipped(File_system &fs, char const *element, Genode::size_t len)
+		{
+			Dir_file_system const * const dir = _dir_node(fs);
+
+			if (!dir)
+				return false;
+
+			return strlen(dir->_name.string()) != len
+			    || strcmp(dir->_name.string(), element, len) != 0;
+		}
+
+		/**
+		 * File system that serves a path, and the path local to it
+		 *
+		 * A resolution without file system denotes a path that cannot exist
+		 * according to the configuration.
+		 */
+		struct Resolution
+		{
+			File_system *fs;
+			char const  *path;
+		};
+
+		/*
+		 * Cache of path resolutions at the VFS root
+		 *
+		 * An entry is keyed by the directory part of a path, e.g., '/dev' for
+		 * '/dev/log', and refers to the file system that serves all paths
+		 * within this directory. This file system is either a leaf file
+		 * system reached via a chain of '<dir>' nodes, or the innermost
+		 * '<dir>' node that has to decide among several children. An entry
+		 * without file system is a negative entry.
+		 *
+		 * The entries depend on the configuration only and are flushed on
+		 * 'apply_config'. A watch notification flushes the cache as well so
+		 * that no resolution outlives a change of a watched directory.
+		 */
+		struct Lookup_cache
+		{
+			enum { SLOTS_LOG2 = 6, SLOTS = 1 << SLOTS_LOG2 };
+
+			enum { MAX_PREFIX_LEN = 128 };
+
+			struct Entry
+			{
+				char           prefix[MAX_PREFIX_LEN] { };
+				Genode::size_t len    = 0;
+				bool           valid  = false;
+				File_system   *fs     = nullptr;
+				Genode::size_t offset = 0;   /* of the path local to 'fs' */
+
+				bool matches(char const *path, Genode::size_t prefix_len) const
+				{
+					return valid && len == prefix_len
+					    && strcmp(prefix, path, len) == 0;
+				}
+			};
+
+			Entry entries[SLOTS];
+
+			Lookup_stats stats { };
+
+			enum : Genode::uint32_t { FNV_BASIS = 2166136261u, FNV_PRIME = 16777619u };
+
+			Entry &entry(Genode::uint32_t hash)
+			{
+				return entries[(hash ^ (hash >> 16)) & (SLOTS - 1)];
+			}
+
+			void flush()
+			{
+				for (unsigned i = 0; i < SLOTS; i++)
+					entries[i].valid = false;
+			}
+		};
+
+		Lookup_cache *_lookup_cache = nullptr;
+
+		Genode::Mutex _lookup_cache_mutex { };
+
+		void _flush_lookup_cache()
+		{
+			Genode::Mutex::Guard guard(_lookup_cache_mutex);
+
+			if (_lookup_cache)
+				_lookup_cache->flush();
+		}
+
+		/**
+		 * Resolve the directory denoted by the first 'dir_len' characters of
+		 * 'path' through the chain of '<dir>' nodes
+		 *
+		 * The returned file system serves all paths within the directory.
+		 */
+		Resolution _resolve_dir(char const *path, Genode::size_t dir_len)
+		{
+			char const * const end = path + dir_len;
+
+			Dir_file_system *dir      = this;
+			char const      *dir_path = path;   /* path as passed to 'dir' */
+
+			for (;;) {
+
+				/* path local to 'dir', starting with '/' */
+				char const * const local = dir->_sub_path(dir_path);
+
+				/* the last path element decides among '<dir>' nodes */
+				bool const last = (local == end);
+				if (last && dir->_dir_children)
+					return { dir, dir_path };
+
+				Genode::size_t len = 0;
+				for (; !last && local[1 + len] != '/'; len++);
+
+				if (len >= MAX_NAME_LEN)
+					return { dir, dir_path };
+
+				File_system *match = nullptr;
+				unsigned     count = 0;
+				for (File_system *fs = dir->_first_file_system; fs; fs = fs->next) {
+					if (!last && _skipped(*fs, local + 1, len))
+						continue;
+					match = fs;
+					count++;
+				}
+
+				if (count == 0)
+					return { nullptr, path };
+
+				if (count > 1)
+					return { dir, dir_path };
+
+				Dir_file_system * const sub_dir = _dir_node(*match);
+				if (!sub_dir)
+					return { match, local };
+
+				dir      = sub_dir;
+				dir_path = local;
+			}
+		}
+
+		Resolution _cached_resolution(char const *path)
+		{
+			Resolution const self { this, path };
+
+			/*
+			 * Only normalized paths with at least one element are cached,
+			 * the directory part of the path is the key. Its FNV-1a hash is
+			 * computed while scanning the path.
+			 */
+			Genode::uint32_t h = Lookup_cache::FNV_BASIS, dir_h = h;
+			Genode::size_t   dir_len = 0, len = 0;
+			for (; path[len]; len++) {
+				if (path[len] == '/') {
+					if (len && path[len - 1] == '/')
+						return self;
+					dir_len = len;
+					dir_h   = h;
+				}
+				h = (h ^ (unsigned char)path[len]) * Lookup_cache::FNV_PRIME;
+			}
+
+			if (path[len - 1] == '/' || dir_len >= Lookup_cache::MAX_PREFIX_LEN)
+				return self;
+
+			Genode::Mutex::Guard guard(_lookup_cache_mutex);
+
+			if (!_lookup_cache)
+				_lookup_cache = new (_env.alloc()) Lookup_cache();
+
+			Lookup_cache::Entry &entry = _lookup_cache->entry(dir_h);
+
+			if (entry.matches(path, dir_len)) {
+				_lookup_cache->stats.hits++;
+			} else {
+				_lookup_cache->stats.misses++;
+
+				Resolution const r = _resolve_dir(path, dir_len);
+
+				Genode::memcpy(entry.prefix, path, dir_len);
+				entry.len    = dir_len;
+				entry.valid  = true;
+				entry.fs     = r.fs;
+				entry.offset = r.path - path;
+			}
+
+			return { entry.fs, path + entry.offset };
+		}
+
+		/**
+		 * Look up the file system that serves 'path'
+		 *
+		 * If the path must be resolved by this instance, the returned
+		 * resolution refers to this instance and the unmodified path.
+		 */
+		Resolution _resolution(char const *path)
+		{
+			if (!_lookup_caching || path[0] != '/')
+				return { this, path };
+
+			return _cached_resolution(path);
+		}
+
 		/* add new file system to the list of children */
 		void _append_file_system(File_system *fs)
 		{
@@ -174,6 +435,10 @@ class Vfs::Dir_file_system : public File_system
 		RES _dir_op(RES const no_entry, RES const no_perm, RES const ok,
 		            char const *path, FN const &fn)
 		{
+			Resolution const r = _resolution(path);
+			if (r.fs != this)
+				return r.fs ? fn(*r.fs, r.path) : no_entry;
+
 			path = _sub_path(path);
 
 			/* path does not match directory name */
@@ -383,6 +648,7 @@ class Vfs::Dir_file_system : public File_system
 				if (sub_node.has_type("dir")) {
 					_append_file_system(new (_env.alloc())
 						Dir_file_system(_env, sub_node, fs_factory));
+					_dir_children = true;
 					continue;
 				}
 
@@ -391,6 +657,7 @@ class Vfs::Dir_file_system : public File_system
 
 				if (fs) {
 					_append_file_system(fs);
+					_leaf_children = true;
 					continue;
 				}
 
@@ -407,6 +674,26 @@ class Vfs::Dir_file_system : public File_system
 					}
 				} catch (Xml_node::Nonexistent_attribute) { }
 			}
+
+			_lookup_caching = _vfs_root && _dir_children && !_leaf_children;
+		}
+
+		~Dir_file_system()
+		{
+			if (_lookup_cache)
+				destroy(_env.alloc(), _lookup_cache);
+		}
+
+		/**
+		 * Return statistics of the lookup cache for tuning
+		 *
+		 * Only the VFS root caches lookups.
+		 */
+		Lookup_stats lookup_stats()
+		{
+			Genode::Mutex::Guard guard(_lookup_cache_mutex);
+
+			return _lookup_cache ? _lookup_cache->stats : Lookup_stats { 0, 0 };
 		}
 
 		/*********************************
@@ -415,6 +702,10 @@ class Vfs::Dir_file_system : public File_system
 
 		Dataspace_capability dataspace(char const *path) override
 		{
+			Resolution const r = _resolution(path);
+			if (r.fs != this)
+				return r.fs ? r.fs->dataspace(r.path) : Dataspace_capability();
+
 			path = _sub_path(path);
 			if (!path)
 				return Dataspace_capability();
@@ -433,8 +724,35 @@ class Vfs::Dir_file_system : public File_system
 			return Dataspace_capability();
 		}
 
+		Dataspace_capability read_only_dataspace(char const *path) override
+		{
+			Resolution const r = _resolution(path);
+			if (r.fs != this)
+				return r.fs ? r.fs->read_only_dataspace(r.path)
+				            : Dataspace_capability();
+
+			path = _sub_path(path);
+			if (!path)
+				return Dataspace_capability();
+
+			for (File_system *fs = _first_file_system; fs; fs = fs->next) {
+				Dataspace_capability ds = fs->read_only_dataspace(path);
+				if (ds.valid())
+					return ds;
+			}
+
+			return Dataspace_capability();
+		}
+
 		void release(char const *path, Dataspace_capability ds_cap) override
 		{
+			Resolution const r = _resolution(path);
+			if (r.fs != this) {
+				if (r.fs)
+					r.fs->release(r.path, ds_cap);
+				return;
+			}
+
 			path = _sub_path(path);
 			if (!path)
 				return;
@@ -445,6 +763,10 @@ class Vfs::Dir_file_system : public File_system
 
 		Stat_result stat(char const *path, Stat &out) override
 		{
+			Resolution const r = _resolution(path);
+			if (r.fs != this)
+				return r.fs ? r.fs->stat(r.path, out) : STAT_ERR_NO_ENTRY;
+
 			path = _sub_path(path);
 
 			/* path does not match directory name */
@@ -520,6 +842,10 @@ class Vfs::Dir_file_system : public File_system
 			if (_top_dir(path))
 				return true;
 
+			Resolution const r = _resolution(path);
+			if (r.fs != this)
+				return r.fs ? r.fs->directory(r.path) : false;
+
 			path = _sub_path(path);
 
 			if (!path)
@@ -537,6 +863,10 @@ class Vfs::Dir_file_system : public File_system
 
 		char const *leaf_path(char const *path) override
 		{
+			Resolution const r = _resolution(path);
+			if (r.fs != this)
+				return r.fs ? r.fs->leaf_path(r.path) : nullptr;
+
 			path = _sub_path(path);
 			if (!path)
 				return nullptr;
@@ -578,6 +908,11 @@ class Vfs::Dir_file_system : public File_system
 			 * file.
 			 */
 
+			Resolution const r = _resolution(path);
+			if (r.fs != this)
+				return r.fs ? r.fs->open(r.path, mode, out_handle, alloc)
+				            : OPEN_ERR_UNACCESSIBLE;
+
 			path = _sub_path(path);
 
 			/* check if path does not match directory name */
@@ -873,6 +1208,8 @@ class Vfs::Dir_file_system : public File_system
 		{
 			using namespace Genode;
 
+			_flush_lookup_cache();
+
 			File_system *curr = _first_file_system;
 			for (unsigned i = 0; i < node.num_sub_nodes(); i++, curr = curr->next) {
 				Xml_node const &sub_node = node.sub_node(i);
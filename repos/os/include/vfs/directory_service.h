@@ -30,6 +30,18 @@ struct Vfs::Directory_service : Interface
 	virtual Dataspace_capability dataspace(char const *path) = 0;
 	virtual void release(char const *path, Dataspace_capability) = 0;
 
+	/**
+	 * Return dataspace with the file content for read-only use
+	 *
+	 * A file system may hand out a read-only dataspace that refers to
+	 * its backing store instead of a copy. The dataspace is released via
+	 * 'release' like one obtained by 'dataspace'.
+	 */
+	virtual Dataspace_capability read_only_dataspace(char const *path)
+	{
+		return dataspace(path);
+	}
+
 
 	enum General_error { ERR_FD_INVALID, NUM_GENERAL_ERRORS };
 
@@ -1,5 +1,7 @@
-SRC_CC   = blit.cc
+SRC_CC   = blit.cc kernels.cc kernels_generic.cc kernels_neon.cc
 REQUIRES = arm_64
-INC_DIR += $(REP_DIR)/src/lib/blit/spec/arm_64
+INC_DIR += $(REP_DIR)/src/lib/blit/spec/arm_64 \
+           $(REP_DIR)/src/lib/blit
 
-vpath blit.cc $(REP_DIR)/src/lib/blit
+vpath kernels.cc $(REP_DIR)/src/lib/blit/spec/arm_64
+vpath %.cc       $(REP_DIR)/src/lib/blit
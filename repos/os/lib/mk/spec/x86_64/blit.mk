@@ -1,6 +1,8 @@
-SRC_CC  = blit.cc
+SRC_CC  = blit.cc kernels.cc kernels_generic.cc kernels_sse2.cc kernels_avx2.cc
 REQUIRES = x86 64bit
 INC_DIR += $(REP_DIR)/src/lib/blit/spec/x86_64 \
-           $(REP_DIR)/src/lib/blit/spec/x86
+           $(REP_DIR)/src/lib/blit/spec/x86 \
+           $(REP_DIR)/src/lib/blit
 
-vpath blit.cc $(REP_DIR)/src/lib/blit
+vpath kernels.cc $(REP_DIR)/src/lib/blit/spec/x86
+vpath %.cc       $(REP_DIR)/src/lib/blit
@@ -403,8 +403,7 @@ class Lan9118 : public Nic::Session_component,
 
 		void _handle_packet_stream() override
 		{
-			while (_rx.source()->ack_avail())
-				_rx.source()->release_packet(_rx.source()->get_acked_packet());
+			_release_acked_rx_packets();
 
 			while (_send()) ;
 		}
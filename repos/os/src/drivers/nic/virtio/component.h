@@ -505,8 +505,7 @@ class Virtio_nic::Session_component : public Nic::Session_component,
 
 		void _handle_packet_stream() override
 		{
-			while (_rx.source()->ack_avail())
-				_rx.source()->release_packet(_rx.source()->get_acked_packet());
+			_release_acked_rx_packets();
 
 			rx_vq_ack_pkts();
 
@@ -14,6 +14,9 @@
 #include <blit/blit.h>
 #include <blit_helper.h>
 
+/* local includes */
+#include "kernels.h"
+
 
 extern "C" void blit(void const *s, unsigned src_w,
                      void *d, unsigned dst_w,
@@ -37,7 +40,15 @@ extern "C" void blit(void const *s, unsigned src_w,
 
 	/* copy 32byte chunks */
 	if (w >> 5) {
-		copy_block_32byte(src, src_w, dst, dst_w, w >> 5, h);
+		auto const copy = Blit::kernels().copy;
+		if (copy) {
+			char const *src_line = src;
+			char       *dst_line = dst;
+			for (int i = h; i--; src_line += src_w, dst_line += dst_w)
+				copy(dst_line, src_line, w & ~31);
+		} else {
+			copy_block_32byte(src, src_w, dst, dst_w, w >> 5, h);
+		}
 		src += w & ~31;
 		dst += w & ~31;
 		w    = w &  31;
@@ -54,3 +65,27 @@ extern "C" void blit(void const *s, unsigned src_w,
 	/* handle trailing row */
 	if (w >> 1) copy_16bit_column(src, src_w, dst, dst_w, h);
 }
+
+
+char const *Blit::kernels_name() { return kernels().name; }
+
+
+void Blit::fill_32bit(void *dst, uint32_t value, unsigned n)
+{
+	kernels().fill_32bit((uint32_t *)dst, value, n);
+}
+
+
+void Blit::blend_rgb888(void *dst, void const *src,
+                        unsigned char const *alpha, unsigned n)
+{
+	kernels().blend_rgb888((uint32_t *)dst, (uint32_t const *)src, alpha, n);
+}
+
+
+void Blit::dither_rgb888_to_rgb565(void *dst, void const *src,
+                                   unsigned n, unsigned x, unsigned y)
+{
+	kernels().dither_rgb888_to_rgb565((uint16_t *)dst, (uint32_t const *)src,
+	                                  n, x, y);
+}
@@ -0,0 +1,18 @@
+/*
+ * \brief  Selection of the generic pixel kernels
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include "kernels.h"
+
+
+Blit::Kernels const &Blit::kernels() { return generic_kernels; }
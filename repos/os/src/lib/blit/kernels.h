@@ -0,0 +1,106 @@
+/*
+ * \brief  Pixel kernels of the blit library
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _LIB__BLIT__KERNELS_H_
+#define _LIB__BLIT__KERNELS_H_
+
+/* Genode includes */
+#include <blit/blit.h>
+#include <util/dither_matrix.h>
+
+namespace Blit {
+
+	using Genode::uint16_t;
+
+	struct Kernels;
+
+	/**
+	 * Return kernels selected for the CPU
+	 */
+	Kernels const &kernels();
+
+	/*
+	 * Kernel variants, defined only for the architectures supporting them
+	 */
+	extern Kernels const generic_kernels;
+	extern Kernels const sse2_kernels;
+	extern Kernels const avx2_kernels;
+	extern Kernels const neon_kernels;
+
+	/**
+	 * Scalar 'Pixel_rgb888::mix', used for remaining pixels of a line
+	 */
+	static inline uint32_t blend_pixel(uint32_t p, uint32_t alpha)
+	{
+		return ((alpha * ((p & 0xff00) >> 8)) & 0xff00)
+		     | (((alpha * (p & 0xff00ff)) >> 8) & 0xff00ff);
+	}
+
+	static inline uint32_t mix_pixel(uint32_t p1, uint32_t p2, uint32_t alpha)
+	{
+		return blend_pixel(p1, 256 - alpha) + blend_pixel(p2, alpha);
+	}
+
+	/**
+	 * Scalar dithering of one RGB888 pixel to RGB565
+	 *
+	 * \param v  dither value in the range of 0..15
+	 */
+	static inline uint16_t dither_pixel(uint32_t p, uint32_t v)
+	{
+		auto sub = [] (uint32_t c, uint32_t v) { return c > v ? c - v : 0; };
+
+		uint32_t const r = sub((p >> 16) & 0xff, v),
+		               g = sub((p >>  8) & 0xff, v),
+		               b = sub( p        & 0xff, v);
+
+		return (uint16_t)(((r << 8) & 0xf800) | ((g << 3) & 0x07e0) | (b >> 3));
+	}
+
+	/**
+	 * Dither values of row 'y' for the columns 0..31
+	 *
+	 * The 16 values of the matrix row are repeated, which allows for
+	 * reading the values of consecutive columns starting at any 'x & 15'.
+	 */
+	static inline void dither_row(uint32_t (&values)[32], unsigned y)
+	{
+		Genode::Dither_matrix::Row const row = Genode::Dither_matrix::row(y);
+		for (unsigned i = 0; i < 32; i++)
+			values[i] = row.value(i) >> 4;
+	}
+}
+
+
+struct Blit::Kernels
+{
+	char const *name;
+
+	/**
+	 * Copy a line of 'bytes', which is a multiple of 32
+	 *
+	 * The pointer is invalid for the generic kernels, which leave the
+	 * copying to the architecture-specific 'copy_block_32byte'.
+	 */
+	void (*copy)(char *dst, char const *src, unsigned long bytes);
+
+	void (*fill_32bit)(uint32_t *dst, uint32_t value, unsigned n);
+
+	void (*blend_rgb888)(uint32_t *dst, uint32_t const *src,
+	                     unsigned char const *alpha, unsigned n);
+
+	void (*dither_rgb888_to_rgb565)(uint16_t *dst, uint32_t const *src,
+	                                unsigned n, unsigned x, unsigned y);
+};
+
+#endif /* _LIB__BLIT__KERNELS_H_ */
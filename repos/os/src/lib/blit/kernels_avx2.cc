@@ -0,0 +1,30 @@
+/*
+ * \brief  Pixel kernels using AVX2
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include "kernels.h"
+
+#define VECTOR_SIZE  32
+#define KERNELS      avx2_kernels
+#define KERNELS_NAME "avx2"
+
+/*
+ * The kernels are used only if the CPU and the kernel support AVX2,
+ * see 'spec/x86/kernels.cc'
+ */
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+#include "vector_kernels.h"
+
+#pragma GCC pop_options
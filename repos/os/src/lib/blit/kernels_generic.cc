@@ -0,0 +1,19 @@
+/*
+ * \brief  Pixel kernels using plain 32-bit words
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#define VECTOR_SIZE  4
+#define KERNELS      generic_kernels
+#define KERNELS_NAME "generic"
+
+/* local includes */
+#include "vector_kernels.h"
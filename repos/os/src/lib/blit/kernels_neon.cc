@@ -0,0 +1,20 @@
+/*
+ * \brief  Pixel kernels using NEON
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* NEON is part of the baseline of arm_64 */
+#define VECTOR_SIZE  16
+#define KERNELS      neon_kernels
+#define KERNELS_NAME "neon"
+
+/* local includes */
+#include "vector_kernels.h"
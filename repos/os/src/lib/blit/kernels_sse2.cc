@@ -0,0 +1,27 @@
+/*
+ * \brief  Pixel kernels using SSE2
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include "kernels.h"
+
+#define VECTOR_SIZE  16
+#define KERNELS      sse2_kernels
+#define KERNELS_NAME "sse2"
+
+/* SSE2 is not part of the baseline of x86_32 */
+#pragma GCC push_options
+#pragma GCC target("sse2")
+
+#include "vector_kernels.h"
+
+#pragma GCC pop_options
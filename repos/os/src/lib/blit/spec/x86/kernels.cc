@@ -0,0 +1,68 @@
+/*
+ * \brief  Selection of the pixel kernels depending on the x86 CPU features
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include "kernels.h"
+
+using namespace Blit;
+
+
+namespace {
+
+	struct Cpuid { uint32_t eax, ebx, ecx, edx; };
+
+	Cpuid cpuid(uint32_t leaf)
+	{
+		Cpuid r { };
+		asm volatile ("cpuid"
+		              : "=a" (r.eax), "=b" (r.ebx), "=c" (r.ecx), "=d" (r.edx)
+		              : "a" (leaf), "c" (0));
+		return r;
+	}
+
+	bool avx2_supported()
+	{
+		if (cpuid(0).eax < 7)
+			return false;
+
+		enum { OSXSAVE = 1u << 27, AVX = 1u << 28 };
+
+		uint32_t const ecx = cpuid(1).ecx;
+		if ((ecx & OSXSAVE) == 0 || (ecx & AVX) == 0)
+			return false;
+
+		/* the kernel must save the SSE and AVX state on context switches */
+		uint32_t xcr0_lo = 0, xcr0_hi = 0;
+		asm volatile ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+		if ((xcr0_lo & 6) != 6)
+			return false;
+
+		enum { AVX2 = 1u << 5 };
+		return cpuid(7).ebx & AVX2;
+	}
+
+	bool sse2_supported()
+	{
+		enum { SSE2 = 1u << 26 };
+		return cpuid(1).edx & SSE2;
+	}
+}
+
+
+Blit::Kernels const &Blit::kernels()
+{
+	static Kernels const &selected = avx2_supported() ? avx2_kernels
+	                               : sse2_supported() ? sse2_kernels
+	                               :                    generic_kernels;
+	return selected;
+}
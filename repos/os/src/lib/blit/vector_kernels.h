@@ -0,0 +1,158 @@
+/*
+ * \brief  Pixel kernels based on the vector extension of the compiler
+ * \author agent
+ * \date   2026-10-16
+ *
+ * This file is included by the kernel variants for the different SIMD
+ * extensions. Each variant defines
+ *
+ *   VECTOR_SIZE  size of one vector in bytes
+ *   KERNELS      name of the 'Blit::Kernels' object to define
+ *   KERNELS_NAME name of the variant as string
+ *
+ * If the instruction set is not part of the baseline of the architecture,
+ * the variant includes 'kernels.h' first and enables the instruction set
+ * via '#pragma GCC target' around the inclusion of this file only. So the
+ * inline functions of the Genode headers are never compiled for the
+ * extended instruction set.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _LIB__BLIT__VECTOR_KERNELS_H_
+#define _LIB__BLIT__VECTOR_KERNELS_H_
+
+#if !defined(VECTOR_SIZE) || !defined(KERNELS) || !defined(KERNELS_NAME)
+#error "VECTOR_SIZE, KERNELS, and KERNELS_NAME must be defined"
+#endif
+
+/* local includes */
+#include "kernels.h"
+
+namespace {
+
+	using namespace Blit;
+
+	enum { LANES = VECTOR_SIZE / 4 };
+
+	/*
+	 * The vectors are accessed at the alignment of their elements
+	 */
+	typedef uint32_t      V32   __attribute__((vector_size(VECTOR_SIZE),     aligned(4), may_alias));
+	typedef uint16_t      V16   __attribute__((vector_size(VECTOR_SIZE / 2), aligned(2), may_alias));
+	typedef unsigned char V8    __attribute__((vector_size(VECTOR_SIZE / 4), aligned(1), may_alias));
+	typedef unsigned char Bytes __attribute__((vector_size(VECTOR_SIZE),     aligned(1), may_alias));
+
+	inline V32 blend(V32 p, V32 alpha)
+	{
+		return ((alpha * ((p & 0xff00) >> 8)) & 0xff00)
+		     | (((alpha * (p & 0xff00ff)) >> 8) & 0xff00ff);
+	}
+
+	/**
+	 * Subtract with saturation at zero
+	 */
+	inline V32 sub(V32 c, V32 v) { return (c - v) & (V32)(c > v); }
+
+#if VECTOR_SIZE > 4
+	void copy_line(char *dst, char const *src, unsigned long bytes)
+	{
+		for (; bytes >= 4*VECTOR_SIZE; bytes -= 4*VECTOR_SIZE,
+		                               src   += 4*VECTOR_SIZE,
+		                               dst   += 4*VECTOR_SIZE) {
+
+			Bytes const v0 = ((Bytes const *)src)[0], v1 = ((Bytes const *)src)[1],
+			            v2 = ((Bytes const *)src)[2], v3 = ((Bytes const *)src)[3];
+
+			((Bytes *)dst)[0] = v0; ((Bytes *)dst)[1] = v1;
+			((Bytes *)dst)[2] = v2; ((Bytes *)dst)[3] = v3;
+		}
+
+		for (; bytes >= VECTOR_SIZE; bytes -= VECTOR_SIZE, src += VECTOR_SIZE,
+		                                                   dst += VECTOR_SIZE)
+			*(Bytes *)dst = *(Bytes const *)src;
+
+		for (; bytes; bytes--)
+			*dst++ = *src++;
+	}
+#endif
+
+	void fill_line(uint32_t *dst, uint32_t value, unsigned n)
+	{
+		V32 v { };
+		v += value;
+
+		for (; n >= LANES; n -= LANES, dst += LANES)
+			*(V32 *)dst = v;
+
+		for (; n; n--)
+			*dst++ = value;
+	}
+
+	void blend_line(uint32_t *dst, uint32_t const *src,
+	                unsigned char const *alpha, unsigned n)
+	{
+		for (; n >= LANES; n -= LANES, dst += LANES, src += LANES, alpha += LANES) {
+
+			V32 const d = *(V32 const *)dst;
+			V32 const s = *(V32 const *)src;
+			V32 const a = __builtin_convertvector(*(V8 const *)alpha, V32);
+
+			/* pixels with zero alpha stay untouched */
+			V32 const keep = (V32)(a == 0);
+
+			V32 const mixed = blend(d, 255 - a) + blend(s, a + 1);
+
+			*(V32 *)dst = (mixed & ~keep) | (d & keep);
+		}
+
+		for (; n; n--, dst++, src++, alpha++)
+			if (*alpha)
+				*dst = mix_pixel(*dst, *src, *alpha + 1);
+	}
+
+	void dither_line(uint16_t *dst, uint32_t const *src,
+	                 unsigned n, unsigned x, unsigned y)
+	{
+		uint32_t values[32];
+		dither_row(values, y);
+
+		for (; n >= LANES; n -= LANES, dst += LANES, src += LANES, x += LANES) {
+
+			V32 const p = *(V32 const *)src;
+			V32 const v = *(V32 const *)&values[x & 15];
+
+			V32 const r = sub((p >> 16) & 0xff, v),
+			          g = sub((p >>  8) & 0xff, v),
+			          b = sub( p        & 0xff, v);
+
+			V32 const rgb565 = ((r << 8) & 0xf800) | ((g << 3) & 0x07e0) | (b >> 3);
+
+			*(V16 *)dst = __builtin_convertvector(rgb565, V16);
+		}
+
+		for (; n; n--, x++)
+			*dst++ = dither_pixel(*src++, values[x & 15]);
+	}
+}
+
+
+Blit::Kernels const Blit::KERNELS = {
+	.name                    = KERNELS_NAME,
+#if VECTOR_SIZE > 4
+	.copy                    = copy_line,
+#else
+	/* the architecture-specific 'copy_block_32byte' is used instead */
+	.copy                    = nullptr,
+#endif
+	.fill_32bit              = fill_line,
+	.blend_rgb888            = blend_line,
+	.dither_rgb888_to_rgb565 = dither_line,
+};
+
+#endif /* _LIB__BLIT__VECTOR_KERNELS_H_ */
@@ -24,27 +24,96 @@ struct Packed_uint8
 } __attribute__((packed));
 
 
+/*
+ * Vector of four 32-bit lanes
+ *
+ * The compiler maps operations on this type to SSE2 instructions on x86_64
+ * and to NEON instructions on arm_64, both of which are part of the base
+ * instruction set of the respective architecture. On other architectures,
+ * the operations are broken down into scalar ones.
+ */
+typedef uint32_t Vec_u32x4 __attribute__((vector_size(16)));
+
+
+static inline Vec_u32x4 load_vec(uint8_t const *addr)
+{
+	Vec_u32x4 vec;
+	__builtin_memcpy(&vec, addr, sizeof(vec));
+	return vec;
+}
+
+
+/**
+ * Add up all 64-byte blocks at 'addr' and advance 'addr' and 'size'
+ *
+ * Each 32-bit word is split into its two 16-bit halves that are summed up in
+ * separate lanes. A lane therefore grows by at most 4 * 0xffff per block and
+ * can absorb 'MAX_ROUND_BLOCKS' blocks before it is folded into the 64-bit
+ * scalar sum.
+ */
+static uint64_t add_up_blocks(uint8_t const *&addr, size_t &size)
+{
+	enum { BLOCK_SIZE = 64, MAX_ROUND_BLOCKS = 0x4000 };
+
+	Vec_u32x4 const mask = { 0xffff, 0xffff, 0xffff, 0xffff };
+	uint64_t sum = 0;
+	while (size >= BLOCK_SIZE) {
+
+		Vec_u32x4 lo = { 0, 0, 0, 0 };
+		Vec_u32x4 hi = { 0, 0, 0, 0 };
+		for (unsigned blocks = 0;
+		     blocks < MAX_ROUND_BLOCKS && size >= BLOCK_SIZE;
+		     blocks++, addr += BLOCK_SIZE, size -= BLOCK_SIZE)
+		{
+			Vec_u32x4 const v0 = load_vec(addr);
+			Vec_u32x4 const v1 = load_vec(addr + 16);
+			Vec_u32x4 const v2 = load_vec(addr + 32);
+			Vec_u32x4 const v3 = load_vec(addr + 48);
+			lo += (v0 & mask) + (v1 & mask) + (v2 & mask) + (v3 & mask);
+			hi += (v0 >> 16) + (v1 >> 16) + (v2 >> 16) + (v3 >> 16);
+		}
+		for (unsigned lane = 0; lane < 4; lane++)
+			sum += (uint64_t)lo[lane] + hi[lane];
+	}
+	return sum;
+}
+
+
 uint16_t Net::internet_checksum(Packed_uint16 const *addr,
                                 size_t               size,
                                 addr_t               init_sum)
 {
-	/* add up bytes in pairs */
-	addr_t sum = init_sum;
+	uint8_t const *byte = (uint8_t const *)addr;
+
+	/*
+	 * As 2^16 equals 1 modulo 2^16 - 1, the one's complement sum of 16-bit
+	 * words can be computed by summing up wider words and folding the
+	 * result in the end.
+	 */
+	uint64_t sum = init_sum + add_up_blocks(byte, size);
+
+	/* add up remaining bytes in 32-bit words */
+	for (; size >= sizeof(uint32_t); size -= sizeof(uint32_t)) {
+		uint32_t word;
+		__builtin_memcpy(&word, byte, sizeof(word));
+		sum  += word;
+		byte += sizeof(word);
+	}
+	/* add up remaining bytes in pairs */
 	for (; size > 1; size -= sizeof(Packed_uint16)) {
-		sum += addr->value;
-		addr++;
+		sum  += ((Packed_uint16 const *)byte)->value;
+		byte += sizeof(Packed_uint16);
 	}
-
 	/* add left-over byte, if any */
 	if (size > 0)
-		sum += ((Packed_uint8 const *)addr)->value;
+		sum += ((Packed_uint8 const *)byte)->value;
 
 	/* fold sum to 16-bit value */
-	while (addr_t const sum_rsh = sum >> 16)
+	while (uint64_t const sum_rsh = sum >> 16)
 		sum = (sum & 0xffff) + sum_rsh;
 
 	/* return one's complement */
-	return ~sum;
+	return (uint16_t)~sum;
 }
 
 
@@ -70,3 +139,30 @@ uint16_t Net::internet_checksum_pseudo_ip(Packed_uint16   const *ip_data,
 	/* add up IP data bytes */
 	return internet_checksum(ip_data, ip_data_sz, sum);
 }
+
+
+/****************************
+ ** Internet_checksum_diff **
+ ****************************/
+
+void Internet_checksum_diff::add_up_diff(Packed_uint16 const *new_data,
+                                         Packed_uint16 const *old_data,
+                                         size_t               size)
+{
+	/* RFC 1624, equation 3: add one's complement of old and new value */
+	for (size_t idx = 0; idx < size / sizeof(Packed_uint16); idx++)
+		_value += (uint16_t)~old_data[idx].value + new_data[idx].value;
+}
+
+
+uint16_t Internet_checksum_diff::apply_to(uint16_t checksum) const
+{
+	addr_t sum = (uint16_t)~checksum + _value;
+
+	/* fold sum to 16-bit value */
+	while (addr_t const sum_rsh = sum >> 16)
+		sum = (sum & 0xffff) + sum_rsh;
+
+	/* return one's complement */
+	return (uint16_t)~sum;
+}
@@ -38,6 +38,40 @@ void Net::Udp_packet::update_checksum(Ipv4_address ip_src,
 	_checksum = 0;
 	_checksum = internet_checksum_pseudo_ip((Packed_uint16 *)this, length(), _length,
 	                                        Ipv4_packet::Protocol::UDP, ip_src, ip_dst);
+
+	/* zero denotes the absence of a checksum, so send it as all ones */
+	if (!_checksum) {
+		_checksum = 0xffff; }
+}
+
+
+void Net::Udp_packet::update_checksum(Internet_checksum_diff const &icd)
+{
+	/* a zero checksum denotes its absence (RFC 768) */
+	if (!_checksum) {
+		return; }
+
+	_checksum = icd.apply_to(_checksum);
+
+	/* zero denotes the absence of a checksum, so send it as all ones */
+	if (!_checksum) {
+		_checksum = 0xffff; }
+}
+
+
+void Net::Udp_packet::src_port(Port p, Internet_checksum_diff &icd)
+{
+	uint16_t const p_be = host_to_big_endian(p.value);
+	icd.add_up_diff((Packed_uint16 *)&p_be, (Packed_uint16 *)&_src_port, 2);
+	_src_port = p_be;
+}
+
+
+void Net::Udp_packet::dst_port(Port p, Internet_checksum_diff &icd)
+{
+	uint16_t const p_be = host_to_big_endian(p.value);
+	icd.add_up_diff((Packed_uint16 *)&p_be, (Packed_uint16 *)&_dst_port, 2);
+	_dst_port = p_be;
 }
 
 
@@ -27,7 +27,7 @@ void Sandbox::Child::destroy_services()
 
 
 Sandbox::Child::Apply_config_result
-Sandbox::Child::apply_config(Xml_node start_node)
+Sandbox::Child::apply_config(Xml_node start_node, Changed_services &changed)
 {
 	if (abandoned() || stuck() || restart_scheduled() || _exited)
 		return NO_SIDE_EFFECTS;
@@ -62,21 +62,22 @@ Sandbox::Child::apply_config(Xml_node start_node)
 	 */
 	if (start_node.differs_from(_start_node->xml())) {
 
+		Xml_node const orig = _start_node->xml();
+
 		/*
 		 * The <route> node may affect the availability or unavailability
 		 * of dependencies.
 		 */
-		start_node.with_sub_node("route", [&] (Xml_node const &route) {
-			_start_node->xml().with_sub_node("route", [&] (Xml_node const &orig) {
-				if (route.differs_from(orig)) {
-					_construct_route_model_from_start_node(start_node);
-					_uncertain_dependencies = true; } }); });
+		if (sub_node_differs(start_node, orig, "route")) {
+			_construct_route_model_from_start_node(start_node);
+			_uncertain_dependencies = true;
+		}
 
 		/*
 		 * Determine how the inline config is affected.
 		 */
 		char const * const tag = "config";
-		bool const config_was_present = _start_node->xml().has_sub_node(tag);
+		bool const config_was_present = orig.has_sub_node(tag);
 		bool const config_is_present  = start_node.has_sub_node(tag);
 
 		if (config_was_present != config_is_present)
@@ -88,14 +89,9 @@ Sandbox::Child::apply_config(Xml_node start_node)
 		if (!config_was_present && config_is_present)
 			config_update = CONFIG_APPEARED;
 
-		if (config_was_present && config_is_present) {
-
-			Xml_node const old_config = _start_node->xml().sub_node(tag);
-			Xml_node const new_config = start_node.sub_node(tag);
-
-			if (new_config.differs_from(old_config))
-				config_update = CONFIG_CHANGED;
-		}
+		if (config_was_present && config_is_present
+		 && sub_node_differs(start_node, orig, tag))
+			config_update = CONFIG_CHANGED;
 
 		/*
 		 * Import updated <provides> node
@@ -103,34 +99,39 @@ Sandbox::Child::apply_config(Xml_node start_node)
 		 * First abandon services that are no longer present in the
 		 * <provides> node. Then add services that have newly appeared.
 		 */
-		_child_services.for_each([&] (Routed_service &service) {
+		if (sub_node_differs(start_node, orig, "provides")) {
+
+			Xml_node const provides = _provides_sub_node(start_node);
+
+			_child_services.for_each([&] (Routed_service &service) {
 
-			if (!_provided_by_this(service))
-				return;
+				if (!_provided_by_this(service))
+					return;
 
-			typedef Service::Name Name;
-			Name const name = service.name();
+				typedef Service::Name Name;
+				Name const name = service.name();
 
-			bool still_provided = false;
-			_provides_sub_node(start_node)
-				.for_each_sub_node("service", [&] (Xml_node node) {
+				bool still_provided = false;
+				provides.for_each_sub_node("service", [&] (Xml_node node) {
 					if (name == node.attribute_value("name", Name()))
 						still_provided = true; });
 
-			if (!still_provided) {
-				service.abandon();
-				provided_services_changed = true;
-			}
-		});
+				if (!still_provided) {
+					service.abandon();
+					changed.add(name);
+					provided_services_changed = true;
+				}
+			});
 
-		_provides_sub_node(start_node).for_each_sub_node("service",
-		                                                 [&] (Xml_node node) {
-			if (_service_exists(node))
-				return;
+			provides.for_each_sub_node("service", [&] (Xml_node node) {
+				if (_service_exists(node))
+					return;
 
-			_add_service(node);
-			provided_services_changed = true;
-		});
+				_add_service(node);
+				changed.add(node.attribute_value("name", Service::Name()));
+				provided_services_changed = true;
+			});
+		}
 
 		/*
 		 * Import new binary name. A change may affect the route for
@@ -427,6 +428,44 @@ void Sandbox::Child::report_state(Xml_generator &xml, Report_detail const &detai
 }
 
 
+void Sandbox::Child::report_state_delta(Xml_generator &xml,
+                                        Report_detail const &detail,
+                                        char *scratch, size_t scratch_size) const
+{
+	if (abandoned()) {
+		if (reported())
+			xml.node("child", [&] () {
+				xml.attribute("name",  _unique_name);
+				xml.attribute("state", "removed"); });
+
+		_reported_state_hash = 0;
+		return;
+	}
+
+	/*
+	 * Render the state into the scratch buffer for comparing it with the
+	 * previously reported state. If the state exceeds the buffer, it is
+	 * reported unconditionally.
+	 */
+	uint64_t hash = 0;
+	try {
+		Xml_generator state(scratch, scratch_size, "state", [&] () {
+			report_state(state, detail); });
+
+		hash = xml_hash(Xml_node(scratch, state.used()));
+	}
+	catch (Xml_generator::Buffer_exceeded) { }
+
+	if (hash && hash == _reported_state_hash)
+		return;
+
+	report_state(xml, detail);
+
+	/* mark child as reported even if its state could not be hashed */
+	_reported_state_hash = hash ? hash : 1;
+}
+
+
 Sandbox::Child::Sample_state_result Sandbox::Child::sample_state()
 {
 	if (!_pd_alive())
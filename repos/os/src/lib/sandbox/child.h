@@ -114,6 +114,12 @@ class Sandbox::Child : Child_policy, Routed_service::Wakeup
 
 		Reconstructible<Buffered_xml> _start_node;
 
+		/*
+		 * Hash of the state covered by the previous delta report, updated
+		 * while generating the report
+		 */
+		mutable uint64_t _reported_state_hash = 0;
+
 		Constructible<Route_model> _route_model { };
 
 		void _construct_route_model_from_start_node(Xml_node const &start)
@@ -618,13 +624,31 @@ class Sandbox::Child : Child_policy, Routed_service::Wakeup
 		/**
 		 * Apply new configuration to child
 		 *
+		 * \param changed  names of services that appeared or disappeared
+		 *
 		 * \throw Allocator::Out_of_memory  unable to allocate buffer for new
 		 *                                  config
 		 */
-		Apply_config_result apply_config(Xml_node start_node);
+		Apply_config_result apply_config(Xml_node start_node,
+		                                 Changed_services &changed);
 
 		bool uncertain_dependencies() const { return _uncertain_dependencies; }
 
+		/**
+		 * Return true if the child has a session of any of the given services
+		 *
+		 * Only such sessions may be routed differently after services
+		 * appeared or disappeared.
+		 */
+		bool uses_any(Changed_services const &changed) const
+		{
+			bool result = false;
+			_child.for_each_session([&] (Session_state const &session) {
+				result |= changed.includes(session.service().name()); });
+
+			return result;
+		}
+
 		/**
 		 * Validate that the routes of all existing sessions remain intact
 		 *
@@ -664,6 +688,24 @@ class Sandbox::Child : Child_policy, Routed_service::Wakeup
 
 		void report_state(Xml_generator &, Report_detail const &) const;
 
+		/**
+		 * Report state only if it changed since the previous delta report
+		 *
+		 * \param scratch  buffer for rendering the state for comparison
+		 *
+		 * An abandoned child that was reported before is reported as removed.
+		 */
+		void report_state_delta(Xml_generator &, Report_detail const &,
+		                        char *scratch, size_t scratch_size) const;
+
+		/**
+		 * Return true if the child appears in the recipient's view of the
+		 * delta reports
+		 */
+		bool reported() const { return _reported_state_hash != 0; }
+
+		void forget_reported_state() const { _reported_state_hash = 0; }
+
 		Sample_state_result sample_state();
 
 
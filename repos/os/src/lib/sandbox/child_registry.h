@@ -81,10 +81,8 @@ class Sandbox::Child_registry : public Name_registry, Child_list
 			}
 		}
 
-		void report_state(Xml_generator &xml, Report_detail const &detail) const
+		void report_aliases(Xml_generator &xml) const
 		{
-			for_each_child([&] (Child &child) { child.report_state(xml, detail); });
-
 			for (Alias const *a = _aliases.first(); a; a = a->next()) {
 				xml.node("alias", [&] () {
 					xml.attribute("name", a->name);
@@ -93,6 +91,13 @@ class Sandbox::Child_registry : public Name_registry, Child_list
 			}
 		}
 
+		void report_state(Xml_generator &xml, Report_detail const &detail) const
+		{
+			for_each_child([&] (Child &child) { child.report_state(xml, detail); });
+
+			report_aliases(xml);
+		}
+
 		Child::Sample_state_result sample_state()
 		{
 			auto result = Child::Sample_state_result::UNCHANGED;
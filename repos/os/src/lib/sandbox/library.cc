@@ -47,6 +47,7 @@ struct Genode::Sandbox::Library : ::Sandbox::State_reporter::Producer,
 	using Config_model   = ::Sandbox::Config_model;
 	using Start_model    = ::Sandbox::Start_model;
 	using Preservation   = ::Sandbox::Preservation;
+	using Changed_services = ::Sandbox::Changed_services;
 
 	Env  &_env;
 	Heap &_heap;
@@ -85,8 +86,8 @@ struct Genode::Sandbox::Library : ::Sandbox::State_reporter::Producer,
 	/*
 	 * Variables for tracking the side effects of updating the config model
 	 */
-	bool _server_appeared_or_disappeared = false;
-	bool _state_report_outdated          = false;
+	Changed_services _changed_services      { };
+	bool             _state_report_outdated = false;
 
 	unsigned _child_cnt = 0;
 
@@ -129,19 +130,69 @@ struct Genode::Sandbox::Library : ::Sandbox::State_reporter::Producer,
 	 */
 	Cap_quota resource_limit(Cap_quota const &) const override { return _avail_caps(); }
 
+	/*
+	 * Bookkeeping for delta reports, updated while generating a report
+	 */
+	struct Removed_child : Registry<Removed_child>::Element
+	{
+		Child_policy::Name const name;
+
+		Removed_child(Registry<Removed_child> &registry, Child_policy::Name const &name)
+		: Registry<Removed_child>::Element(registry, *this), name(name) { }
+	};
+
+	/* children destroyed since they appeared in the last delta report */
+	mutable Registry<Removed_child> _removed_children { };
+
+	enum { REPORT_SCRATCH_SIZE = 16*1024 };
+
+	mutable char _report_scratch[REPORT_SCRATCH_SIZE] { };
+
+	void _report_removed_children(Xml_generator &xml) const
+	{
+		_removed_children.for_each([&] (Removed_child &removed) {
+			xml.node("child", [&] () {
+				xml.attribute("name",  removed.name);
+				xml.attribute("state", "removed"); });
+			destroy(_heap, &removed);
+		});
+	}
+
 	/**
 	 * State_reporter::Producer interface
 	 */
 	void produce_state_report(Xml_generator &xml, Report_detail const &detail) const override
 	{
+		if (detail.delta())
+			xml.attribute("delta", "yes");
+
 		if (detail.init_ram())
 			xml.node("ram",  [&] () { Ram_info::from_pd(_env.pd()).generate(xml); });
 
 		if (detail.init_caps())
 			xml.node("caps", [&] () { Cap_info::from_pd(_env.pd()).generate(xml); });
 
-		if (detail.children())
+		if (!detail.children())
+			return;
+
+		if (!detail.delta()) {
+			_removed_children.for_each([&] (Removed_child &removed) {
+				destroy(_heap, &removed); });
+
+			_children.for_each_child([&] (Child const &child) {
+				child.forget_reported_state(); });
+
 			_children.report_state(xml, detail);
+			return;
+		}
+
+		_report_removed_children(xml);
+
+		_children.for_each_child([&] (Child const &child) {
+			child.report_state_delta(xml, detail, _report_scratch,
+			                         sizeof(_report_scratch)); });
+
+		_children.report_aliases(xml);
 	}
 
 	/**
@@ -255,6 +306,10 @@ void Genode::Sandbox::Library::_destroy_abandoned_children()
 
 		/* destroy child once all environment sessions are gone */
 		if (child.env_sessions_closed()) {
+
+			if (child.reported() && _state_reporter.delta())
+				new (_heap) Removed_child(_removed_children, child.name());
+
 			_children.remove(&child);
 			destroy(_heap, &child);
 		}
@@ -306,8 +361,9 @@ bool Genode::Sandbox::Library::ready_to_create_child(Start_model::Name    const
 			      _parent_services, _child_services, _local_services);
 		_children.insert(&child);
 
-		if (start_node.has_sub_node("provides"))
-			_server_appeared_or_disappeared = true;
+		start_node.with_sub_node("provides", [&] (Xml_node const &provides) {
+			provides.for_each_sub_node("service", [&] (Xml_node const &service) {
+				_changed_services.add(service.attribute_value("name", Service::Name())); }); });
 
 		_state_report_outdated = true;
 
@@ -343,12 +399,11 @@ void Genode::Sandbox::Library::update_child(Child &child, Xml_node const &start)
 	if (child.abandoned())
 		return;
 
-	switch (child.apply_config(start)) {
+	switch (child.apply_config(start, _changed_services)) {
 
 	case Child::NO_SIDE_EFFECTS: break;
 
 	case Child::PROVIDED_SERVICES_CHANGED:
-		_server_appeared_or_disappeared = true;
 		_state_report_outdated = true;
 		break;
 	};
@@ -357,8 +412,8 @@ void Genode::Sandbox::Library::update_child(Child &child, Xml_node const &start)
 
 void Genode::Sandbox::Library::apply_config(Xml_node const &config)
 {
-	_server_appeared_or_disappeared = false;
-	_state_report_outdated          = false;
+	_changed_services.clear();
+	_state_report_outdated = false;
 
 	_config_model.update_from_xml(config,
 	                              _heap,
@@ -377,7 +432,10 @@ void Genode::Sandbox::Library::apply_config(Xml_node const &config)
 	 * After importing the new configuration, servers may have disappeared
 	 * (STATE_ABANDONED) or become new available.
 	 *
-	 * Re-evaluate the dependencies of the existing children.
+	 * Re-evaluate the dependencies of the existing children. Only the
+	 * sessions of services that appeared or disappeared can be routed
+	 * differently. Hence, children without such sessions are skipped unless
+	 * their own start node changed their dependencies.
 	 *
 	 * - Stuck children (STATE_STUCK) may become alive.
 	 * - Children with broken dependencies may have become stuck.
@@ -402,7 +460,10 @@ void Genode::Sandbox::Library::apply_config(Xml_node const &config)
 				return;
 			}
 
-			if (_server_appeared_or_disappeared || child.uncertain_dependencies())
+			bool const affected_by_changed_services = _changed_services.any()
+			  && (child.stuck() || child.uses_any(_changed_services));
+
+			if (affected_by_changed_services || child.uncertain_dependencies())
 				child.evaluate_dependencies();
 
 			if (child.restart_scheduled())
@@ -36,6 +36,7 @@ class Sandbox::Report_detail : Genode::Noncopyable
 		bool _child_caps   = false;
 		bool _init_ram     = false;
 		bool _init_caps    = false;
+		bool _delta        = false;
 
 	public:
 
@@ -52,6 +53,7 @@ class Sandbox::Report_detail : Genode::Noncopyable
 			_child_caps   = report.attribute_value("child_caps",   false);
 			_init_ram     = report.attribute_value("init_ram",     false);
 			_init_caps    = report.attribute_value("init_caps",    false);
+			_delta        = report.attribute_value("delta",        false);
 		}
 
 		bool children()     const { return _children;     }
@@ -63,6 +65,7 @@ class Sandbox::Report_detail : Genode::Noncopyable
 		bool child_caps()   const { return _child_caps;   }
 		bool init_ram()     const { return _init_ram;     }
 		bool init_caps()    const { return _init_caps;    }
+		bool delta()        const { return _delta;        }
 };
 
 
@@ -23,6 +23,7 @@ namespace Sandbox {
 	class Parent_service;
 	class Routed_service;
 	class Forwarded_service;
+	class Changed_services;
 }
 
 
@@ -148,4 +149,56 @@ class Sandbox::Routed_service : public Async_service, public Abandonable
 		}
 };
 
+/**
+ * Names of the child services that appeared or disappeared
+ *
+ * Only clients with sessions of one of these services need to re-evaluate
+ * their routes. Once more names than the set can hold are recorded, all
+ * services are considered as changed.
+ */
+class Sandbox::Changed_services
+{
+	private:
+
+		enum { MAX = 16 };
+
+		Service::Name _names[MAX] { };
+
+		unsigned _count    = 0;
+		bool     _overflow = false;
+
+	public:
+
+		void add(Service::Name const &name)
+		{
+			if (includes(name))
+				return;
+
+			if (_count < MAX)
+				_names[_count++] = name;
+			else
+				_overflow = true;
+		}
+
+		bool includes(Service::Name const &name) const
+		{
+			if (_overflow)
+				return true;
+
+			for (unsigned i = 0; i < _count; i++)
+				if (_names[i] == name)
+					return true;
+
+			return false;
+		}
+
+		bool any() const { return _count > 0 || _overflow; }
+
+		void clear()
+		{
+			_count    = 0;
+			_overflow = false;
+		}
+};
+
 #endif /* _LIB__SANDBOX__SERVICE_H_ */
@@ -103,6 +103,15 @@ class Sandbox::State_reporter : public Report_update_trigger
 			_state_handler(state_handler)
 		{ }
 
+		/**
+		 * Return true if reports are limited to the changes since the
+		 * previous report
+		 */
+		bool delta() const
+		{
+			return _report_detail.constructed() && _report_detail->delta();
+		}
+
 		void generate(Xml_generator &xml) const
 		{
 			if (_version.valid())
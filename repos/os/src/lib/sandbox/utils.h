@@ -234,6 +234,43 @@ namespace Sandbox {
 		}
 		catch (...) { return Location(0, 0, space.width(), space.height()); }
 	}
+
+
+	/**
+	 * Return FNV-1a hash of the raw content of an XML node
+	 *
+	 * The hash is used to detect changes of a child's reported state
+	 * without keeping a copy of the previous report around.
+	 */
+	inline uint64_t xml_hash(Xml_node const &node)
+	{
+		uint64_t hash = 0xcbf29ce484222325ULL;
+
+		node.with_raw_node([&] (char const *start, size_t len) {
+			for (size_t i = 0; i < len; i++)
+				hash = (hash ^ (unsigned char)start[i]) * 0x100000001b3ULL; });
+
+		return hash;
+	}
+
+
+	/**
+	 * Return true if the first sub nodes of the specified type differ
+	 *
+	 * A sub node that is present in only one of both nodes counts as a
+	 * difference.
+	 */
+	inline bool sub_node_differs(Xml_node const &node, Xml_node const &orig,
+	                             char const *type)
+	{
+		bool differs = (node.has_sub_node(type) != orig.has_sub_node(type));
+
+		node.with_sub_node(type, [&] (Xml_node const &sub_node) {
+			orig.with_sub_node(type, [&] (Xml_node const &orig_sub_node) {
+				differs = sub_node.differs_from(orig_sub_node); }); });
+
+		return differs;
+	}
 }
 
 #endif /* _LIB__SANDBOX__UTILS_H_ */
@@ -56,6 +56,19 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 
 		char                 *_block_buffer;
 		unsigned              _block_buffer_count;
+		unsigned       const  _queue_depth;
+
+		struct Block_range { Block::sector_t nr, count; };
+
+		/*
+		 * Trailing blocks of a write that do not fill a whole packet
+		 *
+		 * They are kept back in '_pending_buffer' to be combined with a
+		 * directly following write. Any other access, a sync, or closing a
+		 * handle writes them out first.
+		 */
+		char        *_pending_buffer;
+		Block_range  _pending { 0, 0 };
 
 		Block::Connection<>        &_block;
 		Block::Session::Info const &_info;
@@ -77,6 +90,9 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 				Mutex                             &_mutex;
 				char                              *_block_buffer;
 				unsigned                          &_block_buffer_count;
+				unsigned                    const  _queue_depth;
+				char                       * const _pending_buffer;
+				Block_range                       &_pending;
 				Block::Connection<>               &_block;
 				Genode::size_t               const _block_size;
 				Block::sector_t              const _block_count;
@@ -92,61 +108,121 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 				Block_vfs_handle(Block_vfs_handle const &);
 				Block_vfs_handle &operator = (Block_vfs_handle const &);
 
-				file_size _block_io(file_size nr, void *buf, file_size sz,
-				                    bool write, bool bulk = false)
+				/**
+				 * Transfer 'count' blocks starting at block 'nr'
+				 *
+				 * The range is split into packets of up to
+				 * '_block_buffer_count' blocks, of which up to '_queue_depth'
+				 * are in flight at the same time. For writes, 'fn' fills the
+				 * content of each packet before its submission. For reads,
+				 * 'fn' consumes the content of each acknowledged packet, not
+				 * necessarily in the order of submission. The signature of
+				 * 'fn' is 'void (Block::sector_t nr, char *content,
+				 * Block::sector_t count)'.
+				 *
+				 * Must be called with '_mutex' held.
+				 *
+				 * \return false if any packet failed
+				 */
+				template <typename FN>
+				bool _block_io(Block::sector_t nr, Block::sector_t count,
+				               bool write, FN const &fn)
 				{
-					Block::Packet_descriptor::Opcode op;
-					op = write ? Block::Packet_descriptor::WRITE : Block::Packet_descriptor::READ;
+					typedef Block::Packet_descriptor Packet;
 
-					file_size packet_size  = bulk ? sz : _block_size;
-					file_size packet_count = bulk ? (sz / _block_size) : 1;
+					Packet::Opcode const op = write ? Packet::WRITE : Packet::READ;
 
-					Block::Packet_descriptor packet;
+					Block::sector_t max_packet_count = _block_buffer_count;
 
-					/* sanity check */
-					if (packet_count > _block_buffer_count) {
-						packet_size  = _block_buffer_count * _block_size;
-						packet_count = _block_buffer_count;
-					}
+					unsigned in_flight = 0;
+					bool     succeeded = true;
 
-					while (true) {
-						try {
-							Mutex::Guard guard(_mutex);
+					auto complete_one = [&] ()
+					{
+						Packet const p = _tx_source->get_acked_packet();
+						in_flight--;
 
-							packet = _block.alloc_packet(packet_size);
-							break;
+						if (!p.succeeded())
+							succeeded = false;
+						else if (!write)
+							fn(p.block_number(), _tx_source->packet_content(p),
+							   (Block::sector_t)p.block_count());
+
+						_tx_source->release_packet(p);
+					};
+
+					while (count > 0 || in_flight > 0) {
+
+						if (count == 0 || in_flight == _queue_depth) {
+							complete_one();
+							continue;
+						}
+
+						if (!_tx_source->ready_to_submit()) {
+							if (in_flight)
+								complete_one();
+							else
+								_signal_receiver.wait_for_signal();
+							continue;
+						}
+
+						Block::sector_t const packet_count =
+							Genode::min(count, max_packet_count);
+
+						Packet packet;
+						try {
+							packet = _block.alloc_packet(packet_count*_block_size);
 						} catch (Block::Session::Tx::Source::Packet_alloc_failed) {
-							if (!_tx_source->ready_to_submit())
+
+							/* wait for packets in flight to free buffer space */
+							if (in_flight)
+								complete_one();
+							else if (max_packet_count > 1)
+								max_packet_count /= 2;
+							else
 								_signal_receiver.wait_for_signal();
-							else {
-								if (packet_count > 1) {
-									packet_size  /= 2;
-									packet_count /= 2;
-								}
-							}
+							continue;
 						}
-					}
-					Mutex::Guard guard(_mutex);
 
-					Block::Packet_descriptor p(packet, op, nr, packet_count);
+						Packet const p(packet, op, nr, packet_count);
 
-					if (write)
-						Genode::memcpy(_tx_source->packet_content(p), buf, packet_size);
+						if (write)
+							fn(nr, _tx_source->packet_content(p), packet_count);
 
-					_tx_source->submit_packet(p);
-					p = _tx_source->get_acked_packet();
+						_tx_source->submit_packet(p);
+						in_flight++;
 
-					if (!p.succeeded()) {
-						Genode::error("Could not read block(s)");
-						_tx_source->release_packet(p);
-						return 0;
+						nr    += packet_count;
+						count -= packet_count;
 					}
+					return succeeded;
+				}
+
+				/**
+				 * Write out the blocks kept back from previous writes
+				 *
+				 * Must be called with '_mutex' held.
+				 *
+				 * \return false if writing failed
+				 */
+				bool _flush_pending()
+				{
+					if (!_pending.count)
+						return true;
 
-					if (!write)
-						Genode::memcpy(buf, _tx_source->packet_content(p), packet_size);
+					Block_range const pending = _pending;
+					_pending = Block_range { 0, 0 };
 
-					_tx_source->release_packet(p);
-					return packet_size;
+					bool const succeeded = _block_io(pending.nr, pending.count, true,
+						[&] (Block::sector_t nr, char *content, Block::sector_t n) {
+							Genode::memcpy(content,
+							               _pending_buffer + (nr - pending.nr)*_block_size,
+							               n*_block_size); });
+
+					if (!succeeded)
+						Genode::error("error while writing block:", pending.nr, " to block device");
+
+					return succeeded;
 				}
 
 			public:
@@ -157,6 +233,9 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 				                 Mutex                             &mutex,
 				                 char                              *block_buffer,
 				                 unsigned                          &block_buffer_count,
+				                 unsigned                           queue_depth,
+				                 char                              *pending_buffer,
+				                 Block_range                       &pending,
 				                 Block::Connection<>               &block,
 				                 Genode::size_t                     block_size,
 				                 Block::sector_t                    block_count,
@@ -170,6 +249,9 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 				  _mutex(mutex),
 				  _block_buffer(block_buffer),
 				  _block_buffer_count(block_buffer_count),
+				  _queue_depth(queue_depth),
+				  _pending_buffer(pending_buffer),
+				  _pending(pending),
 				  _block(block),
 				  _block_size(block_size),
 				  _block_count(block_count),
@@ -180,67 +262,59 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 				  _source_submit_cap(source_submit_cap)
 				{ }
 
+				~Block_vfs_handle()
+				{
+					Mutex::Guard guard(_mutex);
+
+					_flush_pending();
+				}
+
 				Read_result read(char *dst, file_size count,
 			                     file_size &out_count) override
 				{
-					file_size seek_offset = seek();
-
-					file_size read = 0;
-					while (count > 0) {
-						file_size displ   = 0;
-						file_size length  = 0;
-						file_size nbytes  = 0;
-						file_size blk_nr  = seek_offset / _block_size;
-
-						displ = seek_offset % _block_size;
-
-						if ((displ + count) > _block_size)
-							length = (_block_size - displ);
-						else
-							length = count;
-
-						/*
-						 * We take a shortcut and read the blocks all at once if the
-						 * offset is aligned on a block boundary and the count is a
-						 * multiple of the block size, e.g. 4K reads will be read at
-						 * once.
-						 *
-						 * XXX this is quite hackish because we have to omit partial
-						 * blocks at the end.
-						 */
-						if (displ == 0 && !(count < _block_size)) {
-							file_size bytes_left = count - (count % _block_size);
-
-							nbytes = _block_io(blk_nr, dst + read, bytes_left, false, true);
-							if (nbytes == 0) {
-								Genode::error("error while reading block:", blk_nr, " from block device");
-								return READ_ERR_INVALID;
-							}
-
-							read  += nbytes;
-							count -= nbytes;
-							seek_offset += nbytes;
+					file_size const device_size = _block_count*_block_size;
 
-							continue;
-						}
+					file_size const start = seek();
+					file_size const end   = Genode::min(start + count, device_size);
 
-						nbytes = _block_io(blk_nr, _block_buffer, _block_size, false);
-						if ((unsigned)nbytes != _block_size) {
-							Genode::error("error while reading block:", blk_nr, " from block device");
-							return READ_ERR_INVALID;
-						}
+					if (start >= end) {
+						out_count = 0;
+						return READ_OK;
+					}
+
+					Block::sector_t const first = start / _block_size;
+					Block::sector_t const last  = (end - 1) / _block_size;
+
+					Mutex::Guard guard(_mutex);
+
+					if (!_flush_pending())
+						return READ_ERR_INVALID;
+
+					/*
+					 * Partial blocks at both ends are read as a whole and
+					 * trimmed while copying the packet content.
+					 */
+					bool const succeeded = _block_io(first, last - first + 1, false,
+						[&] (Block::sector_t nr, char *content, Block::sector_t n) {
+
+							file_size const packet_start = nr*_block_size;
+							file_size const packet_end   = packet_start + n*_block_size;
+
+							file_size const from = Genode::max(start, packet_start);
+							file_size const to   = Genode::min(end,   packet_end);
 
-						Genode::memcpy(dst + read, _block_buffer + displ, length);
+							Genode::memcpy(dst + (from - start),
+							               content + (from - packet_start), to - from);
+						});
 
-						read  += length;
-						count -= length;
-						seek_offset += length;
+					if (!succeeded) {
+						Genode::error("error while reading block:", first, " from block device");
+						return READ_ERR_INVALID;
 					}
 
-					out_count = read;
+					out_count = end - start;
 
 					return READ_OK;
-
 				}
 
 				Write_result write(char const *buf, file_size count,
@@ -251,79 +325,119 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 						return WRITE_ERR_INVALID;
 					}
 
-					file_size seek_offset = seek();
-
-					file_size written = 0;
-					while (count > 0) {
-						file_size displ   = 0;
-						file_size length  = 0;
-						file_size nbytes  = 0;
-						file_size blk_nr  = seek_offset / _block_size;
-
-						displ = seek_offset % _block_size;
-
-						if ((displ + count) > _block_size)
-							length = (_block_size - displ);
-						else
-							length = count;
-
-						/*
-						 * We take a shortcut and write as much as possible without
-						 * using the block buffer if the offset is aligned on a block
-						 * boundary and the count is a multiple of the block size,
-						 * e.g. 4K writes will be written at once.
-						 *
-						 * XXX this is quite hackish because we have to omit partial
-						 * blocks at the end.
-						 */
-						if (displ == 0 && !(count < _block_size)) {
-							file_size bytes_left = count - (count % _block_size);
-
-							nbytes = _block_io(blk_nr, (void*)(buf + written),
-							                   bytes_left, true, true);
-							if (nbytes == 0) {
-								Genode::error("error while write block:", blk_nr, " to block device");
-								return WRITE_ERR_INVALID;
-							}
-
-							written     += nbytes;
-							count       -= nbytes;
-							seek_offset += nbytes;
+					if (count == 0) {
+						out_count = 0;
+						return WRITE_OK;
+					}
 
-							continue;
-						}
+					file_size const start = seek();
+					file_size const end   = start + count;
 
-						/*
-						 * The offset is not aligned on a block boundary. Therefore
-						 * we need to read the block to the block buffer first and
-						 * put the buffer content at the right offset before we can
-						 * write the whole block back. In addition if length is less
-						 * than block size, we also have to read the block first.
-						 */
-						if (displ > 0 || length < _block_size)
-							_block_io(blk_nr, _block_buffer, _block_size, false);
-
-						Genode::memcpy(_block_buffer + displ, buf + written, length);
-
-						nbytes = _block_io(blk_nr, _block_buffer, _block_size, true);
-						if ((unsigned)nbytes != _block_size) {
-							Genode::error("error while writing block:", blk_nr, " to block_device");
-							return WRITE_ERR_INVALID;
-						}
+					Block::sector_t const first = start / _block_size;
+					Block::sector_t const last  = (end - 1) / _block_size;
+
+					/*
+					 * Blocks only partially covered by the write are read to
+					 * the block buffer first and merged with the new content.
+					 * They are written back together with the blocks in between.
+					 */
+					bool const head_partial = (start % _block_size)
+					                       || (end < (first + 1)*_block_size);
+					bool const tail_partial = (last != first) && (end % _block_size);
+
+					char * const head = _block_buffer;
+					char * const tail = _block_buffer + _block_size;
 
-						written     += length;
-						count       -= length;
-						seek_offset += length;
+					Mutex::Guard guard(_mutex);
+
+					/*
+					 * A write that directly continues the pending blocks is
+					 * combined with them. Any other write flushes them first.
+					 */
+					bool const combine = _pending.count && !(start % _block_size)
+					                  && (first == _pending.nr + _pending.count);
+
+					if (!combine && !_flush_pending())
+						return WRITE_ERR_INVALID;
+
+					auto read_block = [&] (Block::sector_t nr, char *block)
+					{
+						return _block_io(nr, 1, false,
+							[&] (Block::sector_t, char *content, Block::sector_t) {
+								Genode::memcpy(block, content, _block_size); });
+					};
+
+					if ((head_partial && !read_block(first, head))
+					 || (tail_partial && !read_block(last,  tail))) {
+						Genode::error("error while reading block:", first, " from block_device");
+						return WRITE_ERR_INVALID;
 					}
 
-					out_count = written;
+					if (head_partial)
+						Genode::memcpy(head + (start - first*_block_size), buf,
+						               Genode::min(end, (first + 1)*_block_size) - start);
 
-					return WRITE_OK;
+					if (tail_partial)
+						Genode::memcpy(tail, buf + (last*_block_size - start),
+						               end - last*_block_size);
+
+					auto block_content = [&] (Block::sector_t nr) -> char const *
+					{
+						if (nr < first)
+							return _pending_buffer + (nr - _pending.nr)*_block_size;
+
+						return (nr == first && head_partial) ? head
+						     : (nr == last  && tail_partial) ? tail
+						     : buf + (nr*_block_size - start);
+					};
 
+					/*
+					 * If the write ends at a block boundary, the blocks beyond
+					 * the last full packet are kept back.
+					 */
+					Block::sector_t const io_first = combine ? _pending.nr : first;
+					Block::sector_t const io_count = last - io_first + 1;
+					Block::sector_t const keep     = (end % _block_size)
+					                               ? 0 : io_count % _block_buffer_count;
+
+					bool const succeeded = (io_count == keep)
+					                    || _block_io(io_first, io_count - keep, true,
+						[&] (Block::sector_t nr, char *content, Block::sector_t n) {
+							for (Block::sector_t i = 0; i < n; i++, nr++)
+								Genode::memcpy(content + i*_block_size,
+								               block_content(nr), _block_size); });
+
+					if (!succeeded) {
+						_pending = Block_range { 0, 0 };
+						Genode::error("error while writing block:", io_first, " to block_device");
+						return WRITE_ERR_INVALID;
+					}
+
+					/*
+					 * Blocks of a combined write that are kept back again
+					 * already reside at their place in the pending buffer.
+					 */
+					Block_range const kept { last + 1 - keep, keep };
+
+					for (Block::sector_t nr = Genode::max(kept.nr, first);
+					     nr < kept.nr + kept.count; nr++)
+						Genode::memcpy(_pending_buffer + (nr - kept.nr)*_block_size,
+						               block_content(nr), _block_size);
+
+					_pending = kept;
+
+					out_count = count;
+
+					return WRITE_OK;
 				}
 
 				Sync_result sync() override
 				{
+					Mutex::Guard guard(_mutex);
+
+					if (!_flush_pending())
+						return SYNC_ERR_INVALID;
+
 					/*
 					 * Just in case bail if we cannot submit the packet.
 					 * (Since the plugin operates in a synchronous fashion
@@ -359,7 +473,8 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 		                 Block::Connection<>        &block,
 		                 Block::Session::Info const &info,
 		                 Name                 const &name,
-		                 unsigned                    block_buffer_count)
+		                 unsigned                    block_buffer_count,
+		                 unsigned                    queue_depth)
 		:
 			Single_file_system { Node_type::CONTINUOUS_FILE, name.string(),
 			                     info.writeable ? Node_rwx::rw() : Node_rwx::ro(),
@@ -367,13 +482,19 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 			_env(env),
 			_block_buffer(0),
 			_block_buffer_count(block_buffer_count),
+			_queue_depth(queue_depth),
+			_pending_buffer(0),
 			_block(block),
 			_info(info),
 			_tx_source(_block.tx()),
 			_writeable(_info.writeable),
 			_source_submit_cap(_signal_receiver.manage(&_signal_context))
 		{
+			/* the buffer holds the two partial blocks of an unaligned write */
 			_block_buffer = new (_env.alloc())
+				char[Genode::max(_block_buffer_count, 2U) * _info.block_size];
+
+			_pending_buffer = new (_env.alloc())
 				char[_block_buffer_count * _info.block_size];
 
 			_block.tx_channel()->sigh_ready_to_submit(_source_submit_cap);
@@ -384,6 +505,7 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 			_signal_receiver.dissolve(&_signal_context);
 
 			destroy(_env.alloc(), _block_buffer);
+			destroy(_env.alloc(), _pending_buffer);
 		}
 
 		static char const *name()   { return "data"; }
@@ -405,6 +527,9 @@ class Vfs::Block_file_system::Data_file_system : public Single_file_system
 				                                           _mutex,
 				                                           _block_buffer,
 				                                           _block_buffer_count,
+				                                           _queue_depth,
+				                                           _pending_buffer,
+				                                           _pending,
 				                                           _block,
 				                                           _info.block_size,
 				                                           _info.block_count,
@@ -449,8 +574,10 @@ struct Vfs::Block_file_system::Local_factory : File_system_factory
 
 	Genode::Allocator_avl _tx_block_alloc { &_env.alloc() };
 
+	Genode::size_t const _tx_buffer_size;
+
 	Block::Connection<> _block {
-		_env.env(), &_tx_block_alloc, 128*1024, _label.string() };
+		_env.env(), &_tx_block_alloc, _tx_buffer_size, _label.string() };
 
 	Block::Session::Info const _info { _block.info() };
 
@@ -480,7 +607,25 @@ struct Vfs::Block_file_system::Local_factory : File_system_factory
 
 	static unsigned buffer_count(Xml_node config)
 	{
-		return config.attribute_value("block_buffer_count", 1UL);
+		return Genode::max(config.attribute_value("block_buffer_count", 1U), 1U);
+	}
+
+	/**
+	 * Number of packets kept in flight per read or write
+	 */
+	static unsigned queue_depth(Xml_node config)
+	{
+		return Genode::max(config.attribute_value("queue_depth", 8U), 1U);
+	}
+
+	/**
+	 * Size of the packet buffer, which must accommodate all packets in
+	 * flight, assuming blocks of up to 4 KiB
+	 */
+	static Genode::size_t tx_buffer_size(Xml_node config)
+	{
+		return Genode::max((Genode::size_t)128*1024,
+		                   (Genode::size_t)queue_depth(config)*buffer_count(config)*4096);
 	}
 
 	Local_factory(Vfs::Env &env, Xml_node config)
@@ -488,7 +633,9 @@ struct Vfs::Block_file_system::Local_factory : File_system_factory
 		_label   { config.attribute_value("label", Label("")) },
 		_name    { name(config) },
 		_env     { env },
-		_data_fs { _env, _block, _info, name(config), buffer_count(config) }
+		_tx_buffer_size { tx_buffer_size(config) },
+		_data_fs { _env, _block, _info, name(config), buffer_count(config),
+		           queue_depth(config) }
 	{
 		_info_fs       .value(Info { _info });
 		_block_count_fs.value(_info.block_count);
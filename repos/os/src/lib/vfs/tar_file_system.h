@@ -15,9 +15,13 @@
 #define _INCLUDE__VFS__TAR_FILE_SYSTEM_H_
 
 #include <rom_session/connection.h>
+#include <rm_session/connection.h>
+#include <region_map/client.h>
 #include <vfs/file_system.h>
 #include <vfs/vfs_handle.h>
 #include <base/attached_rom_dataspace.h>
+#include <base/registry.h>
+#include <util/reconstructible.h>
 
 namespace Vfs { class Tar_file_system; }
 
@@ -197,6 +201,25 @@ class Vfs::Tar_file_system : public File_system
 	{
 		using Tar_vfs_handle::Tar_vfs_handle;
 
+		/*
+		 * Most recently read entry, which turns the sequential reading of
+		 * a directory into a single walk over the list of children
+		 */
+		Node const  *_cursor       = nullptr;
+		file_offset  _cursor_index = 0;
+
+		Node const *_child(file_offset index)
+		{
+			if (_cursor && index == _cursor_index + 1)
+				_cursor = _cursor->next();
+
+			else if (!_cursor || index != _cursor_index)
+				_cursor = _node->lookup_child(index);
+
+			_cursor_index = index;
+			return _cursor;
+		}
+
 		Read_result read(char *dst, file_size count,
 		                 file_size &out_count) override
 		{
@@ -207,7 +230,7 @@ class Vfs::Tar_file_system : public File_system
 
 			file_offset const index = seek() / sizeof(Dirent);
 
-			Node const *node_ptr = _node->lookup_child(index);
+			Node const *node_ptr = _child(index);
 
 			if (!node_ptr) {
 				dirent = Dirent { };
@@ -301,67 +324,131 @@ class Vfs::Tar_file_system : public File_system
 
 	struct Node : List<Node>, List<Node>::Element
 	{
-		char const *name;
+		char   const *name;
 		Record const *record;
+		Node   const *parent;
+
+		file_size num_children = 0;
+
+		/* chaining within a bucket of the node table */
+		Node             *hash_next = nullptr;
+		Genode::uint64_t  hash      = 0;
 
-		Node(char const *name, Record const *record) : name(name), record(record) { }
+		Node(char const *name, Record const *record, Node const *parent)
+		: name(name), record(record), parent(parent) { }
 
-		Node *lookup(char const *name)
+		Node const *lookup_child(file_offset index) const
 		{
-			Absolute_path lookup_path(name);
+			for (Node const *child_node = first(); child_node; child_node = child_node->next(), index--) {
+				if (index == 0)
+					return child_node;
+			}
 
-			Node *parent_node = this;
-			Node *child_node;
+			return 0;
+		}
 
-			Path_element_token t(lookup_path.base());
+	} _root_node;
 
-			while (t) {
 
-				if (t.type() != Path_element_token::IDENT) {
-						t = t.next();
-						continue;
-				}
+	/**
+	 * Hash table of all nodes keyed by their parent node and name
+	 *
+	 * Each path element is resolved by a single table lookup instead of
+	 * scanning the siblings, which matters for archives with many entries
+	 * per directory.
+	 */
+	class Node_table
+	{
+		private:
+
+			Genode::Allocator &_alloc;
+
+			Node           **_buckets     = nullptr;
+			Genode::size_t   _num_buckets = 0;       /* power of two */
+			Genode::size_t   _num_nodes   = 0;
+
+			/*
+			 * Noncopyable
+			 */
+			Node_table(Node_table const &);
+			Node_table &operator = (Node_table const &);
+
+			static Genode::uint64_t _hash(Node const *parent,
+			                              char const *name, Genode::size_t len)
+			{
+				Genode::uint64_t h = 0xcbf29ce484222325ULL ^ (Genode::addr_t)parent;
+				for (Genode::size_t i = 0; i < len; i++)
+					h = (h ^ (unsigned char)name[i]) * 0x100000001b3ULL;
+				return h;
+			}
 
-				char path_element[MAX_PATH_LEN];
+			Node *&_bucket(Genode::uint64_t hash) const {
+				return _buckets[hash & (_num_buckets - 1)]; }
+
+			void _grow()
+			{
+				Genode::size_t const old_num_buckets = _num_buckets;
+				Node         ** const old_buckets     = _buckets;
 
-				t.string(path_element, sizeof(path_element));
+				_num_buckets = old_num_buckets ? 2*old_num_buckets : 64;
+				_buckets     = (Node **)_alloc.alloc(_num_buckets*sizeof(Node *));
 
-				for (child_node = parent_node->first(); child_node; child_node = child_node->next()) {
-					if (strcmp(child_node->name, path_element) == 0) {
-						parent_node = child_node;
-						break;
+				for (Genode::size_t i = 0; i < _num_buckets; i++)
+					_buckets[i] = nullptr;
+
+				for (Genode::size_t i = 0; i < old_num_buckets; i++) {
+					for (Node *node = old_buckets[i], *next; node; node = next) {
+						next = node->hash_next;
+						node->hash_next = _bucket(node->hash);
+						_bucket(node->hash) = node;
 					}
 				}
 
-				if (!child_node)
-					return 0;
-
-				t = t.next();
+				if (old_buckets)
+					_alloc.free(old_buckets, old_num_buckets*sizeof(Node *));
 			}
 
-			return parent_node;
-		}
+		public:
 
+			Node_table(Genode::Allocator &alloc) : _alloc(alloc) { }
 
-		Node const *lookup_child(int index) const
-		{
-			for (Node const *child_node = first(); child_node; child_node = child_node->next(), index--) {
-				if (index == 0)
-					return child_node;
+			~Node_table()
+			{
+				if (_buckets)
+					_alloc.free(_buckets, _num_buckets*sizeof(Node *));
 			}
 
-			return 0;
-		}
+			void insert(Node &node)
+			{
+				/* keep the load factor at most one */
+				if (_num_nodes >= _num_buckets)
+					_grow();
+
+				node.hash      = _hash(node.parent, node.name, strlen(node.name));
+				node.hash_next = _bucket(node.hash);
+				_bucket(node.hash) = &node;
+				_num_nodes++;
+			}
 
+			/**
+			 * Look up child of 'parent' named by the 'len' characters at 'name'
+			 */
+			Node *lookup(Node const *parent, char const *name, Genode::size_t len) const
+			{
+				if (!_num_buckets)
+					return nullptr;
 
-		file_size num_dirent()
-		{
-			file_size count = 0;
-			for (Node *child_node = first(); child_node; child_node = child_node->next(), count++) ;
-			return count;
-		}
+				Genode::uint64_t const hash = _hash(parent, name, len);
 
-	} _root_node;
+				for (Node *node = _bucket(hash); node; node = node->hash_next)
+					if (node->hash == hash && node->parent == parent
+					 && strcmp(node->name, name, len) == 0 && node->name[len] == 0)
+						return node;
+
+				return nullptr;
+			}
+
+	} _node_table { _alloc };
 
 
 	/*
@@ -375,18 +462,26 @@ class Vfs::Tar_file_system : public File_system
 
 			Node &_root_node;
 
+			Node_table &_node_table;
+
+			static Path_element_token _next_element(Path_element_token t)
+			{
+				while (t && t.type() != Path_element_token::IDENT)
+					t = t.next();
+				return t;
+			}
+
 		public:
 
 			Add_node_action(Genode::Allocator &alloc,
-			                Node              &root_node)
-			: _alloc(alloc), _root_node(root_node) { }
+			                Node              &root_node,
+			                Node_table        &node_table)
+			: _alloc(alloc), _root_node(root_node), _node_table(node_table) { }
 
 			void operator()(Record const *record)
 			{
 				Absolute_path current_path;
 
-				char path_element[MAX_PATH_LEN];
-
 				if (record->max_name_len() > 100 || record->name()[99] == 0)
 					current_path.import(record->name());
 
@@ -394,64 +489,53 @@ class Vfs::Tar_file_system : public File_system
 				 * GNU tar does not null terminate names of length 100
 				 */
 				else {
-					copy_cstring(path_element, record->name(), 101);
-					current_path.import(path_element);
+					char name[101];
+					copy_cstring(name, record->name(), sizeof(name));
+					current_path.import(name);
 				}
 
-				Path_element_token t(current_path.base());
-
 				Node *parent_node = &_root_node;
-				Node *child_node;
 
-				while(t) {
+				for (Path_element_token t = _next_element(Path_element_token(current_path.base())); t; ) {
 
-					if (t.type() != Path_element_token::IDENT) {
-							t = t.next();
-							continue;
-					}
+					Path_element_token const element = t;
 
-					Absolute_path remaining_path(t.start());
+					t = _next_element(t.next());
 
-					t.string(path_element, sizeof(path_element));
+					bool const last_element = !t;
 
-					for (child_node = parent_node->first(); child_node; child_node = child_node->next()) {
-						if (strcmp(child_node->name, path_element) == 0)
-							break;
-					}
+					Node *child_node =
+						_node_table.lookup(parent_node, element.start(), element.len());
 
 					if (child_node) {
 
-						if (remaining_path.has_single_element()) {
+						if (last_element) {
 							/* Found a node for the record to be inserted.
 							 * This is usually a directory node without
 							 * record. */
 							child_node->record = record;
 						}
 					} else {
-						if (remaining_path.has_single_element()) {
-
-							/*
-							 * TODO: find 'path_element' in 'record->name'
-							 * and use the location in the record as name
-							 * pointer to save some memory
-							 */
-							Genode::size_t name_size = strlen(path_element) + 1;
-							char *name = (char*)_alloc.alloc(name_size);
-							copy_cstring(name, path_element, name_size);
-							child_node = new (_alloc) Node(name, record);
-						} else {
-
-							/* create a directory node without record */
-							Genode::size_t name_size = strlen(path_element) + 1;
-							char *name = (char*)_alloc.alloc(name_size);
-							copy_cstring(name, path_element, name_size);
-							child_node = new (_alloc) Node(name, 0);
-						}
+
+						/*
+						 * TODO: find 'element' in 'record->name' and use
+						 * the location in the record as name pointer to
+						 * save some memory
+						 */
+						Genode::size_t name_size = element.len() + 1;
+						char *name = (char*)_alloc.alloc(name_size);
+						copy_cstring(name, element.start(), name_size);
+
+						/* intermediate elements are directories without record */
+						child_node = new (_alloc)
+							Node(name, last_element ? record : 0, parent_node);
+
 						parent_node->insert(child_node);
+						parent_node->num_children++;
+						_node_table.insert(*child_node);
 					}
 
 					parent_node = child_node;
-					t = t.next();
 				}
 			}
 	};
@@ -490,40 +574,126 @@ class Vfs::Tar_file_system : public File_system
 	}
 
 
-	struct Num_dirent_cache
+	Node *_lookup(char const *path)
 	{
-		Mutex            mutex { };
-		Node            &root_node;
-		bool             valid;              /* true after first lookup */
-		char             key[256];           /* key used for lookup */
-		file_size        cached_num_dirent;  /* cached value */
+		Absolute_path lookup_path(path);
 
-		Num_dirent_cache(Node &root_node)
-		: root_node(root_node), valid(false), cached_num_dirent(0) { }
+		Node *node = &_root_node;
 
-		file_size num_dirent(char const *path)
-		{
-			Mutex::Guard guard(mutex);
-
-			/* check for cache miss */
-			if (!valid || strcmp(path, key) != 0) {
-				Node *node = root_node.lookup(path);
-				if (!node)
-					return 0;
-				copy_cstring(key, path, sizeof(key));
-				cached_num_dirent = node->num_dirent();
-				valid = true;
+		for (Path_element_token t(lookup_path.base()); t && node; t = t.next())
+			if (t.type() == Path_element_token::IDENT)
+				node = _node_table.lookup(node, t.start(), t.len());
+
+		return node;
+	}
+
+	enum { PAGE_SHIFT = 12, PAGE_SIZE = 1UL << PAGE_SHIFT };
+
+	/*
+	 * Dataspace handed out by 'read_only_dataspace()' that refers to the
+	 * archive ROM
+	 *
+	 * The full pages of a file are attached from the ROM to a managed
+	 * dataspace. A partial last page is copied so that the mapping reads
+	 * as zero beyond the end of the file, like a copy of the content would.
+	 */
+	struct Zero_copy_dataspace
+	{
+		Genode::Capability<Genode::Region_map> rm;
+		Genode::Ram_dataspace_capability       last_page;
+		Dataspace_capability                   ds;
+
+		Zero_copy_dataspace(Genode::Capability<Genode::Region_map> rm,
+		                    Genode::Ram_dataspace_capability       last_page,
+		                    Dataspace_capability                   ds)
+		: rm(rm), last_page(last_page), ds(ds) { }
+	};
+
+	typedef Genode::Registered_no_delete<Zero_copy_dataspace> Registered_zero_copy_dataspace;
+
+	Mutex _zero_copy_mutex { };
+
+	Genode::Registry<Registered_zero_copy_dataspace> _zero_copy_dataspaces { };
+
+	Genode::Constructible<Genode::Rm_connection> _rm { };
+
+	bool _rm_unavailable = false;
+
+	/**
+	 * Hand out file content that starts at a page boundary of the ROM
+	 *
+	 * \return invalid capability if the content must be copied instead
+	 */
+	Dataspace_capability _zero_copy_dataspace(Record const &record)
+	{
+		Genode::addr_t const offset = (Genode::addr_t)record.data()
+		                            - (Genode::addr_t)_tar_base;
+		Genode::size_t const size = record.size();
+
+		if ((offset & (PAGE_SIZE - 1)) || size < PAGE_SIZE || _rm_unavailable)
+			return Dataspace_capability();
+
+		Mutex::Guard guard(_zero_copy_mutex);
+
+		if (!_rm.constructed()) {
+			try { _rm.construct(_env); }
+			catch (...) {
+				Genode::warning(_rom_name, ": RM session unavailable, "
+				                "copying file content");
+				_rm_unavailable = true;
+				return Dataspace_capability();
 			}
-			return cached_num_dirent;
 		}
-	} _cached_num_dirent;
+
+		Genode::size_t const full_pages_size = size & ~(PAGE_SIZE - 1);
+		Genode::size_t const last_page_size  = size - full_pages_size;
+
+		Genode::Capability<Genode::Region_map> rm_cap    { };
+		Genode::Ram_dataspace_capability       last_page { };
+
+		/*
+		 * On any failure, e.g., 'Out_of_ram' or 'Out_of_caps', the caller
+		 * falls back to copying the file content.
+		 */
+		try {
+			rm_cap = _rm->create(full_pages_size + (last_page_size ? PAGE_SIZE : 0));
+
+			Genode::Region_map_client rm(rm_cap);
+
+			rm.attach(_tar_ds.cap(), full_pages_size, offset,
+			          true, (Genode::addr_t)0, false, false);
+
+			if (last_page_size) {
+				last_page = _env.ram().alloc(PAGE_SIZE);
+
+				char *local_addr = _env.rm().attach(last_page);
+				memcpy(local_addr, (char const *)record.data() + full_pages_size,
+				       last_page_size);
+				_env.rm().detach(local_addr);
+
+				rm.attach(last_page, PAGE_SIZE, 0,
+				          true, (Genode::addr_t)full_pages_size, false, false);
+			}
+
+			return (new (_alloc)
+				Registered_zero_copy_dataspace(_zero_copy_dataspaces, rm_cap,
+				                               last_page, rm.dataspace()))->ds;
+		}
+		catch (...) {
+			if (last_page.valid())
+				_env.ram().free(last_page);
+			if (rm_cap.valid())
+				_rm->destroy(rm_cap);
+		}
+		return Dataspace_capability();
+	}
 
 	/**
 	 * Walk hardlinks until we reach a file
 	 */
 	Node const *dereference(char const *path)
 	{
-		Node const *node = _root_node.lookup(path);
+		Node const *node = _lookup(path);
 		Node const *slow_node = node;
 		int i = 0;
 		while (node) {
@@ -537,9 +707,9 @@ class Vfs::Tar_file_system : public File_system
 			 * loop then eventually we catch it as the faster
 			 * laps the slower.
 			 */
-			node = _root_node.lookup(record->linked_name());
+			node = _lookup(record->linked_name());
 			if (i++ & 1) {
-				slow_node = _root_node.lookup(slow_node->record->linked_name());
+				slow_node = _lookup(slow_node->record->linked_name());
 				if (node == slow_node) {
 					Genode::error(_rom_name, " contains a hard-link loop at '", path, "'");
 					node = nullptr;
@@ -549,16 +719,33 @@ class Vfs::Tar_file_system : public File_system
 		return node;
 	}
 
+	/**
+	 * Return record of the file at 'path' or nullptr if there is none
+	 */
+	Record const *_file_record(char const *path)
+	{
+		Node const *node = dereference(path);
+		if (!node || !node->record)
+			return nullptr;
+
+		Record const *record = node->record;
+		if (record->type() != Record::TYPE_FILE) {
+			Genode::error("TAR record \"", path, "\" has "
+			              "unsupported type ", record->type());
+			return nullptr;
+		}
+		return record;
+	}
+
 	public:
 
 		Tar_file_system(Vfs::Env &env, Genode::Xml_node config)
 		:
 			_env(env.env()), _alloc(env.alloc()),
 			_rom_name(config.attribute_value("name", Rom_name())),
-			_root_node("", 0),
-			_cached_num_dirent(_root_node)
+			_root_node("", 0, nullptr)
 		{
-			_for_each_tar_record_do(Add_node_action(_alloc, _root_node));
+			_for_each_tar_record_do(Add_node_action(_alloc, _root_node, _node_table));
 		}
 
 		/*********************************
@@ -567,16 +754,9 @@ class Vfs::Tar_file_system : public File_system
 
 		Dataspace_capability dataspace(char const *path) override
 		{
-			Node const *node = dereference(path);
-			if (!node || !node->record)
-				return Dataspace_capability();
-
-			Record const *record = node->record;
-			if (record->type() != Record::TYPE_FILE) {
-				Genode::error("TAR record \"", path, "\" has "
-				              "unsupported type ", record->type());
+			Record const *record = _file_record(path);
+			if (!record)
 				return Dataspace_capability();
-			}
 
 			try {
 				Ram_dataspace_capability ds_cap =
@@ -593,9 +773,44 @@ class Vfs::Tar_file_system : public File_system
 			return Dataspace_capability();
 		}
 
+		/*
+		 * The managed dataspace of the archive ROM is read-only. Hence,
+		 * the file content is handed out without copying only if the
+		 * dataspace is never written to.
+		 */
+		Dataspace_capability read_only_dataspace(char const *path) override
+		{
+			Record const *record = _file_record(path);
+			if (!record)
+				return Dataspace_capability();
+
+			Dataspace_capability const zero_copy_ds = _zero_copy_dataspace(*record);
+			if (zero_copy_ds.valid())
+				return zero_copy_ds;
+
+			return dataspace(path);
+		}
+
 		void release(char const *, Dataspace_capability ds_cap) override
 		{
-			_env.ram().free(static_cap_cast<Genode::Ram_dataspace>(ds_cap));
+			bool zero_copy = false;
+			{
+				Mutex::Guard guard(_zero_copy_mutex);
+
+				_zero_copy_dataspaces.for_each([&] (Registered_zero_copy_dataspace &zc) {
+					if (zero_copy || !(zc.ds == ds_cap))
+						return;
+
+					zero_copy = true;
+					_rm->destroy(zc.rm);
+					if (zc.last_page.valid())
+						_env.ram().free(zc.last_page);
+					destroy(_alloc, &zc);
+				});
+			}
+
+			if (!zero_copy)
+				_env.ram().free(static_cap_cast<Genode::Ram_dataspace>(ds_cap));
 		}
 
 		Stat_result stat(char const *path, Stat &out) override
@@ -655,14 +870,15 @@ class Vfs::Tar_file_system : public File_system
 
 		Rename_result rename(char const *from, char const *to) override
 		{
-			if (_root_node.lookup(from) || _root_node.lookup(to))
+			if (_lookup(from) || _lookup(to))
 				return RENAME_ERR_NO_PERM;
 			return RENAME_ERR_NO_ENTRY;
 		}
 
 		file_size num_dirent(char const *path) override
 		{
-			return _cached_num_dirent.num_dirent(path);
+			Node const *node = _lookup(path);
+			return node ? node->num_children : 0;
 		}
 
 		bool directory(char const *path) override
@@ -684,7 +900,7 @@ class Vfs::Tar_file_system : public File_system
 			 * case, return the whole path, which is relative to the root
 			 * of this file system.
 			 */
-			Node *node = _root_node.lookup(path);
+			Node *node = _lookup(path);
 			return node ? path : 0;
 		}
 
@@ -118,7 +118,21 @@ namespace Cache {
 		private:
 
 			char        _data[CHUNK_SIZE];
-			unsigned    _writes;
+			bool        _valid; /* content is present */
+			bool        _dirty; /* content differs from the backend */
+
+			static size_t &_dirty_count()
+			{
+				static size_t count = 0;
+				return count;
+			}
+
+			void _mark_dirty()
+			{
+				if (_dirty) return;
+				_dirty = true;
+				_dirty_count()++;
+			}
 
 		public:
 
@@ -126,6 +140,11 @@ namespace Cache {
 
 			static constexpr size_t SIZE = CHUNK_SIZE;
 
+			/**
+			 * Return number of chunks not yet written back to the backend
+			 */
+			static size_t dirty_chunks() { return _dirty_count(); }
+
 			/**
 			 * Construct byte chunk
 			 *
@@ -136,12 +155,28 @@ namespace Cache {
 			 * of 'Chunk_index'.
 			 */
 			Chunk(Genode::Allocator &, offset_t base_offset, Chunk_base *p)
-			: Chunk_base(base_offset, p), _writes(0) { }
+			: Chunk_base(base_offset, p), _valid(false), _dirty(false) { }
 
 			/**
 			 * Construct zero chunk
 			 */
-			Chunk() : _writes(0) { }
+			Chunk() : _valid(false), _dirty(false) { }
+
+			~Chunk() { if (_dirty) _dirty_count()--; }
+
+			bool dirty() const { return _dirty; }
+
+			char const *data() const { return _data; }
+
+			/**
+			 * Mark chunk as written back to the backend
+			 */
+			void clean()
+			{
+				if (!_dirty) return;
+				_dirty = false;
+				_dirty_count()--;
+			}
 
 			/**
 			 * Return number of used entries
@@ -165,7 +200,31 @@ namespace Cache {
 
 				_num_entries = Genode::max(_num_entries, local_offset + len);
 
-				_writes++;
+				_valid = true;
+				_mark_dirty();
+			}
+
+			/**
+			 * Populate chunk with content read from the backend
+			 *
+			 * Content that is already present is newer than the backend's
+			 * and is kept.
+			 */
+			void fill(char const *src, size_t len, offset_t seek_offset)
+			{
+				assert_valid_range(seek_offset, len, SIZE);
+
+				if (_valid) return;
+
+				offset_t const local_offset = seek_offset - base_offset();
+
+				Genode::memcpy(&_data[local_offset], src, len);
+
+				_num_entries = Genode::max(_num_entries, local_offset + len);
+
+				_valid = true;
+
+				POLICY::fill(this);
 			}
 
 			void read(char *dst, size_t len, offset_t seek_offset) const
@@ -181,16 +240,18 @@ namespace Cache {
 			{
 				assert_valid_range(seek_offset, len, SIZE);
 
-				if (_writes == 0)
+				if (!_valid)
 					throw Range_incomplete(base_offset(), SIZE);
 			}
 
+			/**
+			 * Hand dirty chunk to the write-back, which cleans it once
+			 * the content is submitted to the backend
+			 */
 			void sync(size_t len, offset_t seek_offset)
 			{
-				if (_writes > 1) {
+				if (_dirty)
 					POLICY::sync(this, (char*)_data);
-					_writes = 1;
-				}
 			}
 
 			void alloc(size_t len, offset_t seek_offset) { }
@@ -215,7 +276,7 @@ namespace Cache {
 
 			void free(size_t, offset_t)
 			{
-				if (_writes > 1) throw Dirty_chunk(_base_offset, SIZE);
+				if (_dirty) throw Dirty_chunk(_base_offset, SIZE);
 
 				_num_entries = 0;
 				if (_parent) _parent->free(SIZE, _base_offset);
@@ -409,6 +470,20 @@ namespace Cache {
 				}
 			};
 
+			struct Fill_func
+			{
+				typedef ENTRY_TYPE Entry;
+
+				static Entry &lookup(Chunk_index &chunk, unsigned i) {
+					return chunk._alloc_entry(i); }
+
+				void operator () (Entry &entry, char const *src, size_t len,
+				                  offset_t seek_offset) const
+				{
+					entry.fill(src, len, seek_offset);
+				}
+			};
+
 			struct Read_func
 			{
 				typedef ENTRY_TYPE const Entry;
@@ -515,6 +590,12 @@ namespace Cache {
 			void write(char const *src, size_t len, offset_t seek_offset) {
 				_range_op(*this, src, len, seek_offset, Write_func()); }
 
+			/**
+			 * Populate chunks with content read from the backend
+			 */
+			void fill(char const *src, size_t len, offset_t seek_offset) {
+				_range_op(*this, src, len, seek_offset, Fill_func()); }
+
 			/**
 			 * Allocate needed chunks
 			 */
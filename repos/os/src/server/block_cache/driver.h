@@ -88,18 +88,33 @@ class Driver : public Block::Driver
 		};
 
 
+	public:
+
 		/*
-		 * The given policy class is extended by a synchronization routine,
-		 * used by the cache chunk structure
+		 * The given policy class is extended by write-back routines, used
+		 * by the cache chunk structure and by the policy itself
 		 */
-		struct Policy : POLICY {
-			static void sync(const typename POLICY::Element *e, char *src); };
+		struct Policy : POLICY
+		{
+			static void sync(const typename POLICY::Element *e, char *src);
 
-	public:
+			/**
+			 * Write back dirty chunks in the vicinity of the given chunk
+			 *
+			 * \return true if the chunk got cleaned
+			 */
+			static bool write_back(const typename POLICY::Element *e);
+		};
 
 		enum {
 			SLAB_SZ = Block::Session::TX_QUEUE_SIZE*sizeof(Request),
-			CACHE_BLK_SIZE = 4096
+			CACHE_BLK_SIZE = 4096,
+
+			/* maximum number of chunks coalesced into one write request */
+			WRITE_BATCH_CHUNKS = 64,
+
+			/* maximum number of chunks read ahead of a sequential reader */
+			READ_AHEAD_CHUNKS = 32,
 		};
 
 		/**
@@ -125,6 +140,35 @@ class Driver : public Block::Driver
 		Genode::Io_signal_handler<Driver> _source_submit;
 		Genode::Io_signal_handler<Driver> _yield;
 
+		/* percentage of dirty chunks that triggers write-back */
+		unsigned const _dirty_ratio;
+
+		/*
+		 * Dirty chunks of adjacent offsets collected for a single write
+		 * request to the backend device
+		 */
+		struct Write_batch
+		{
+			Cache::offset_t off   { 0 };
+			unsigned        count { 0 };
+			Chunk_level_4  *chunks[WRITE_BATCH_CHUNKS] { };
+
+			Cache::offset_t end() const {
+				return off + count*CACHE_BLK_SIZE; }
+		} _batch { };
+
+		/*
+		 * Sequential-read detection, a read miss at the end of the
+		 * previous read request to the backend doubles the read ahead
+		 */
+		Block::sector_t _read_end   { 0 };
+		unsigned        _read_ahead { 0 }; /* in chunks */
+
+		struct Stats
+		{
+			Genode::uint64_t hits, misses, read_ahead, writes, written;
+		} _stats { 0, 0, 0, 0, 0 };
+
 		Driver(Driver const&);            /* singleton pattern */
 		Driver& operator=(Driver const&); /* singleton pattern */
 
@@ -157,8 +201,8 @@ class Driver : public Block::Driver
 		{
 			try {
 			if (r->cli.operation() == Block::Packet_descriptor::READ)
-				read(r->cli.block_number(), r->cli.block_count(),
-				     r->buffer, r->cli);
+				_read(r->cli.block_number(), r->cli.block_count(),
+				      r->buffer, r->cli, false);
 			else
 				write(r->cli.block_number(), r->cli.block_count(),
 				      r->buffer, r->cli);
@@ -178,11 +222,18 @@ class Driver : public Block::Driver
 			while (_blk.tx()->ack_avail()) {
 				Block::Packet_descriptor p = _blk.tx()->get_acked_packet();
 
-				/* when reading, write result into cache */
-				if (p.operation() == Block::Packet_descriptor::READ)
-					_cache.write(_blk.tx()->packet_content(p),
-					             p.block_count() * _info.block_size,
-					             p.block_number() * _info.block_size);
+				/*
+				 * When reading, populate the cache with the result. If the
+				 * chunks cannot be re-allocated after their eviction, the
+				 * pending client requests will miss and repeat the read.
+				 */
+				if (p.operation() == Block::Packet_descriptor::READ) {
+					try {
+						_cache.fill(_blk.tx()->packet_content(p),
+						            p.block_count() * _info.block_size,
+						            p.block_number() * _info.block_size);
+					} catch (Block::Driver::Request_congestion) { }
+				}
 
 				/* loop through the list of requests, and ack all related */
 				for (Request *r = _r_list.first(), *r_to_handle = r; r;
@@ -204,6 +255,46 @@ class Driver : public Block::Driver
 		 */
 		void _ready_to_submit() { }
 
+		/*
+		 * Return true if the chunk at the given block number is populated
+		 */
+		bool _cached(Block::sector_t nr)
+		{
+			try {
+				_cache.stat(CACHE_BLK_SIZE, nr * _info.block_size);
+				return true;
+			} catch (Cache::Chunk_base::Range_incomplete) { }
+			return false;
+		}
+
+		/*
+		 * Return number of blocks to read ahead of a read request
+		 *
+		 * \param nr   first block number of the request to the backend
+		 * \param cnt  number of blocks of the request
+		 */
+		Genode::size_t _read_ahead_blocks(Block::sector_t nr, Genode::size_t cnt)
+		{
+			_read_ahead = (nr == _read_end)
+			            ? Genode::min(Genode::max(2*_read_ahead, 1U),
+			                          (unsigned)READ_AHEAD_CHUNKS)
+			            : 0;
+
+			Block::sector_t const end    = nr + cnt;
+			Genode::size_t        blocks = 0;
+
+			for (unsigned i = 0; i < _read_ahead; i++) {
+				Block::sector_t const next = end + blocks;
+				if (next + _cache_blk_mod() > _info.block_count || _cached(next))
+					break;
+				blocks += _cache_blk_mod();
+			}
+
+			_read_end          = end + blocks;
+			_stats.read_ahead += blocks / _cache_blk_mod();
+			return blocks;
+		}
+
 		/*
 		 * Setup a request to the backend device
 		 *
@@ -239,6 +330,13 @@ class Driver : public Block::Driver
 				Genode::size_t cnt = _cache_blk_round_up(block_count +
 				                                         (block_number - nr));
 
+				if (packet.operation() == Block::Packet_descriptor::READ)
+					cnt += _read_ahead_blocks(nr, cnt);
+
+				/* the read request of a partial write ends a sequential read */
+				else
+					_read_end = 0;
+
 				/* ensure all memory is available before sending the request */
 				_cache.alloc(cnt * _info.block_size, nr * _info.block_size);
 
@@ -258,30 +356,115 @@ class Driver : public Block::Driver
 			}
 		}
 
+		/*
+		 * Return size of the backend device in bytes
+		 */
+		Cache::size_t _device_size() const {
+			return (Cache::size_t)_info.block_size * _info.block_count; }
+
+		/*
+		 * Submit the collected dirty chunks as one write request
+		 *
+		 * \throw Write_failed  backend device is not ready to proceed
+		 */
+		void _submit_write_batch()
+		{
+			if (!_batch.count)
+				return;
+
+			Cache::size_t const size =
+				Genode::min(_batch.end(), _device_size()) - _batch.off;
+
+			if (!_blk.tx()->ready_to_submit())
+				throw Write_failed(_batch.off);
+
+			Block::Packet_descriptor p;
+			try {
+				p = Block::Packet_descriptor(_blk.alloc_packet(size),
+				                             Block::Packet_descriptor::WRITE,
+				                             _batch.off / _info.block_size,
+				                             size / _info.block_size);
+			} catch(Block::Session::Tx::Source::Packet_alloc_failed) {
+				throw Write_failed(_batch.off);
+			}
+
+			char * const dst = _blk.tx()->packet_content(p);
+			for (unsigned i = 0; i < _batch.count; i++) {
+				Cache::size_t const off = i*CACHE_BLK_SIZE;
+				Genode::memcpy(dst + off, _batch.chunks[i]->data(),
+				               Genode::min((Cache::size_t)CACHE_BLK_SIZE,
+				                           size - off));
+				_batch.chunks[i]->clean();
+			}
+
+			_blk.tx()->submit_packet(p);
+
+			_stats.writes++;
+			_stats.written += _batch.count;
+			_batch.count = 0;
+		}
+
+		/*
+		 * Write back dirty chunks of the given range without blocking
+		 *
+		 * \return false if the backend device was not ready to proceed
+		 */
+		bool _try_sync(Cache::size_t len, Cache::offset_t off)
+		{
+			try {
+				_cache.sync(len, off);
+				_submit_write_batch();
+				return true;
+			} catch(Write_failed &) {
+				/* chunks not submitted yet remain dirty */
+				_batch.count = 0;
+			}
+			return false;
+		}
+
 		/*
 		 * Synchronize dirty chunks with backend device
 		 */
 		void _sync()
 		{
 			Cache::offset_t off = 0;
-			Cache::size_t len   = _info.block_size * _info.block_count;
+			Cache::size_t len   = _device_size();
 
 			while (len > 0) {
 				try {
 					_cache.sync(len, off);
+					_submit_write_batch();
 					len = 0;
 				} catch(Write_failed &e) {
 					/**
 					 * Write to backend failed when backend device isn't ready
 					 * to proceed, so handle signals, until it's ready again
 					 */
+					_batch.count = 0;
 					off = e.off;
-					len = _info.block_size * _info.block_count - off;
+					len = _device_size() - off;
 					_env.ep().wait_and_dispatch_one_io_signal();
 				}
 			}
 		}
 
+		/*
+		 * Start write-back when dirty chunks exceed the high watermark
+		 *
+		 * Write-back does not start before a full write batch is dirty,
+		 * which keeps the requests to the backend device large.
+		 */
+		void _balance_dirty()
+		{
+			Genode::uint64_t const dirty = Chunk_level_4::dirty_chunks();
+
+			if (dirty < WRITE_BATCH_CHUNKS
+			 || dirty*100 <= (Genode::uint64_t)_dirty_ratio*POLICY::resident_chunks())
+				return;
+
+			_try_sync(_device_size(), 0);
+		}
+
 		/*
 		 * Check for chunk availability
 		 *
@@ -323,14 +506,40 @@ class Driver : public Block::Driver
 			_env.parent().yield_response();
 		}
 
+		void _read(Block::sector_t           block_number,
+		           Genode::size_t            block_count,
+		           char*                     buffer,
+		           Block::Packet_descriptor &packet,
+		           bool                      account)
+		{
+			bool const hit = _stat(block_number, block_count, buffer, packet);
+
+			if (account) {
+				if (hit) _stats.hits++;
+				else     _stats.misses++;
+			}
+
+			if (!hit)
+				return;
+
+			_cache.read(buffer,
+			            block_count *_info.block_size,
+			            block_number*_info.block_size);
+
+			ack_packet(packet);
+		}
+
 	public:
 
 		/*
 		 * Constructor
 		 *
-		 * \param ep  server entrypoint
+		 * \param ep           server entrypoint
+		 * \param dirty_ratio  percentage of dirty chunks that triggers
+		 *                     write-back, 100 defers write-back until
+		 *                     sync or eviction
 		 */
-		Driver(Genode::Env &env, Genode::Heap &heap)
+		Driver(Genode::Env &env, Genode::Heap &heap, unsigned dirty_ratio)
 		: Block::Driver(env.ram()),
 		  _env(env),
 		  _r_slab(&heap),
@@ -340,7 +549,8 @@ class Driver : public Block::Driver
 		  _cache(heap, 0),
 		  _source_ack(env.ep(), *this, &Driver::_ack_avail),
 		  _source_submit(env.ep(), *this, &Driver::_ready_to_submit),
-		  _yield(env.ep(), *this, &Driver::_parent_yield)
+		  _yield(env.ep(), *this, &Driver::_parent_yield),
+		  _dirty_ratio(Genode::min(dirty_ratio, 100U))
 		{
 			using namespace Genode;
 
@@ -363,11 +573,54 @@ class Driver : public Block::Driver
 			/* when session gets closed, synchronize and flush the cache */
 			_sync();
 			POLICY::flush();
+
+			Genode::uint64_t const requests = _stats.hits + _stats.misses;
+
+			Genode::log("read requests: ", requests, " hit rate: ",
+			            requests ? _stats.hits*100/requests : 0, "%, "
+			            "chunks read ahead: ", _stats.read_ahead, ", "
+			            "chunks written: ", _stats.written, " in ",
+			            _stats.writes, " requests");
 		}
 
 		Block::Session_client* blk()    { return &_blk;   }
 		Genode::size_t         blk_sz() { return _info.block_size; }
 
+		/**
+		 * Add dirty chunk to the pending write request
+		 *
+		 * Adjacent chunks are coalesced up to 'WRITE_BATCH_CHUNKS'.
+		 *
+		 * \throw Write_failed  backend device is not ready to proceed
+		 */
+		void write_back(Chunk_level_4 &chunk)
+		{
+			if (_batch.count && (chunk.base_offset() != _batch.end()
+			                  || _batch.count == WRITE_BATCH_CHUNKS))
+				_submit_write_batch();
+
+			if (!_batch.count)
+				_batch.off = chunk.base_offset();
+
+			_batch.chunks[_batch.count++] = &chunk;
+		}
+
+		/**
+		 * Write back the dirty chunks of the batch-sized window of 'chunk'
+		 *
+		 * \return true if 'chunk' is clean afterwards
+		 */
+		bool write_back_window(Chunk_level_4 &chunk)
+		{
+			Cache::size_t   const window = WRITE_BATCH_CHUNKS*CACHE_BLK_SIZE;
+			Cache::offset_t const off    = chunk.base_offset()
+			                             - chunk.base_offset() % window;
+
+			_try_sync(Genode::min(window, _device_size() - off), off);
+
+			return !chunk.dirty();
+		}
+
 
 		/****************************
 		 ** Block-driver interface **
@@ -380,14 +633,7 @@ class Driver : public Block::Driver
 		          char*                     buffer,
 		          Block::Packet_descriptor &packet)
 		{
-			if (!_stat(block_number, block_count, buffer, packet))
-				return;
-
-			_cache.read(buffer,
-			            block_count *_info.block_size,
-			            block_number*_info.block_size);
-
-			ack_packet(packet);
+			_read(block_number, block_count, buffer, packet, true);
 		}
 
 		void write(Block::sector_t           block_number,
@@ -415,6 +661,8 @@ class Driver : public Block::Driver
 			             block_number * _info.block_size);
 
 			ack_packet(packet);
+
+			_balance_dirty();
 		}
 
 		void sync() { _sync(); }
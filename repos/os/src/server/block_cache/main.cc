@@ -11,12 +11,13 @@
  * under the terms of the GNU Affero General Public License version 3.
  */
 
+#include <base/attached_rom_dataspace.h>
 #include <base/component.h>
 
-#include "lru.h"
+#include "two_queue.h"
 #include "driver.h"
 
-using Policy = Lru_policy;
+using Policy = Two_queue_policy;
 static Driver<Policy> * driver = nullptr;
 
 
@@ -24,28 +25,32 @@ static Driver<Policy> * driver = nullptr;
  * Synchronize a chunk with the backend device
  */
 template <typename POLICY>
-void Driver<POLICY>::Policy::sync(const typename POLICY::Element *e, char *dst)
+void Driver<POLICY>::Policy::sync(const typename POLICY::Element *e, char *)
 {
-	Cache::offset_t off =
-		static_cast<const Driver<POLICY>::Chunk_level_4*>(e)->base_offset();
-
-	if (!driver) throw Write_failed(off);
-
-	if (!driver->blk()->tx()->ready_to_submit())
-		throw Write_failed(off);
-	try {
-		Block::Packet_descriptor
-			p(driver->blk()->alloc_packet(Driver::CACHE_BLK_SIZE),
-		      Block::Packet_descriptor::WRITE, off / driver->blk_sz(),
-		      Driver::CACHE_BLK_SIZE / driver->blk_sz());
-		driver->blk()->tx()->submit_packet(p);
-	} catch(Block::Session::Tx::Source::Packet_alloc_failed) {
-		throw Write_failed(off);
-	}
+	Chunk_level_4 &chunk =
+		*const_cast<Chunk_level_4 *>(static_cast<const Chunk_level_4 *>(e));
+
+	if (!driver) throw Write_failed(chunk.base_offset());
+
+	driver->write_back(chunk);
+}
+
+
+/**
+ * Write back a chunk selected for eviction together with its neighbours
+ */
+template <typename POLICY>
+bool Driver<POLICY>::Policy::write_back(const typename POLICY::Element *e)
+{
+	Chunk_level_4 &chunk =
+		*const_cast<Chunk_level_4 *>(static_cast<const Chunk_level_4 *>(e));
+
+	return driver && driver->write_back_window(chunk);
 }
 
 /* explicit instantiation for external reference */
 template void Driver<Policy>::Policy::sync(const typename Policy::Element *, char *);
+template bool Driver<Policy>::Policy::write_back(const typename Policy::Element *);
 
 
 struct Main
@@ -55,12 +60,14 @@ struct Main
 	{
 		Genode::Env  &env;
 		Genode::Heap &heap;
+		unsigned      dirty_ratio;
 
-		Factory(Genode::Env &env, Genode::Heap &heap) : env(env), heap(heap) {}
+		Factory(Genode::Env &env, Genode::Heap &heap, unsigned dirty_ratio)
+		: env(env), heap(heap), dirty_ratio(dirty_ratio) {}
 
 		Block::Driver *create()
 		{
-			driver = new (&heap) ::Driver<T>(env, heap);
+			driver = new (&heap) ::Driver<T>(env, heap, dirty_ratio);
 			return driver;
 		}
 
@@ -70,9 +77,25 @@ struct Main
 
 	void resource_handler() { }
 
+	/*
+	 * Read the dirty-ratio high watermark, the cache works without config
+	 */
+	static unsigned dirty_ratio(Genode::Env &env)
+	{
+		enum { DEFAULT_DIRTY_RATIO = 50 };
+
+		try {
+			Genode::Attached_rom_dataspace config { env, "config" };
+			return config.xml().attribute_value("dirty_ratio",
+			                                    (unsigned)DEFAULT_DIRTY_RATIO);
+		} catch (...) { }
+
+		return DEFAULT_DIRTY_RATIO;
+	}
+
 	Genode::Env                 &env;
 	Genode::Heap                 heap    { env.ram(), env.rm()     };
-	Factory<Lru_policy>          factory { env, heap               };
+	Factory<Policy>              factory { env, heap, dirty_ratio(env) };
 	Block::Root                  root    { env.ep(), heap, env.rm(), factory, true };
 	Genode::Signal_handler<Main> resource_dispatcher {
 		env.ep(), *this, &Main::resource_handler };
@@ -0,0 +1,168 @@
+/*
+ * \brief  Scan-resistant 2Q cache replacement strategy
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include "two_queue.h"
+#include "driver.h"
+
+typedef Driver<Two_queue_policy>    Cache_driver;
+typedef Cache_driver::Chunk_level_4 Chunk;
+typedef Two_queue_policy::Element   Element;
+typedef Two_queue_policy::Queue     Queue;
+
+enum {
+	/* share of resident chunks reserved for 'A1in' in percent */
+	A1IN_PERCENT = 25,
+
+	/* slots of the 'A1out' ghost table, must be a power of two */
+	GHOST_SLOTS_LOG2 = 12,
+	GHOST_SLOTS      = 1 << GHOST_SLOTS_LOG2,
+};
+
+static Queue a1in;
+static Queue am;
+
+
+/*
+ * Ghost queue 'A1out'
+ *
+ * Evicted chunks are remembered by their offset in a direct-mapped table.
+ * A newer entry displaces an older one of the same slot, which bounds the
+ * memory of the queue and approximates its FIFO order without any list
+ * maintenance. Offsets are stored incremented by one to tell apart empty
+ * slots.
+ */
+static Cache::offset_t a1out[GHOST_SLOTS];
+
+
+static Cache::offset_t &ghost_slot(Cache::offset_t off)
+{
+	Genode::uint64_t const nr = off / Chunk::SIZE;
+	return a1out[(nr * 0x9e3779b97f4a7c15ULL) >> (64 - GHOST_SLOTS_LOG2)];
+}
+
+
+static void remember(Cache::offset_t off) { ghost_slot(off) = off + 1; }
+
+
+static bool remembered(Cache::offset_t off)
+{
+	Cache::offset_t &slot = ghost_slot(off);
+	if (slot != off + 1)
+		return false;
+
+	slot = 0;
+	return true;
+}
+
+
+void Two_queue_policy::_append(Queue &q, Element &e)
+{
+	_remove(e);
+
+	e._prev  = q.tail;
+	e._queue = &q;
+
+	if (q.tail) q.tail->_next = &e; else q.head = &e;
+	q.tail = &e;
+	q.count++;
+}
+
+
+void Two_queue_policy::_remove(Element &e)
+{
+	Queue * const q = e._queue;
+	if (!q) return;
+
+	if (e._prev) e._prev->_next = e._next; else q->head = e._next;
+	if (e._next) e._next->_prev = e._prev; else q->tail = e._prev;
+
+	e._prev  = nullptr;
+	e._next  = nullptr;
+	e._queue = nullptr;
+	q->count--;
+}
+
+
+void Two_queue_policy::_access(Element &e)
+{
+	/* admit chunk written by the client without being populated before */
+	if (!e._queue) {
+		fill(&e);
+		return;
+	}
+
+	/*
+	 * References to a chunk in 'A1in' are correlated to the reference that
+	 * populated it. So only the order of 'Am' is updated.
+	 */
+	if (e._queue == &am)
+		_append(am, e);
+}
+
+
+void Two_queue_policy::fill(const Element *e)
+{
+	Element &elem  = *const_cast<Element *>(e);
+	Chunk   &chunk = static_cast<Chunk &>(elem);
+
+	if (elem._queue)
+		return;
+
+	_append(remembered(chunk.base_offset()) ? am : a1in, elem);
+}
+
+
+void Two_queue_policy::read(const Element *e) {
+	_access(*const_cast<Element *>(e)); }
+
+
+void Two_queue_policy::write(const Element *e) {
+	_access(*const_cast<Element *>(e)); }
+
+
+unsigned Two_queue_policy::resident_chunks() { return a1in.count + am.count; }
+
+
+void Two_queue_policy::flush(Cache::size_t size)
+{
+	Cache::size_t s = 0;
+
+	/* bound the attempts, dirty chunks may not be written back at once */
+	for (unsigned attempts = resident_chunks();
+	     attempts && ((size == 0) || (s < size)); attempts--) {
+
+		unsigned const a1in_max = resident_chunks() * A1IN_PERCENT / 100;
+
+		Queue &victim_queue = (a1in.count > a1in_max || !am.head) ? a1in : am;
+		if (!victim_queue.head)
+			break;
+
+		Chunk &chunk = static_cast<Chunk &>(*victim_queue.head);
+
+		if (chunk.dirty() && !Cache_driver::Policy::write_back(&chunk)) {
+
+			/* keep chunk until the backend accepts its content */
+			_append(victim_queue, chunk);
+			continue;
+		}
+
+		if (&victim_queue == &a1in)
+			remember(chunk.base_offset());
+
+		/* destruction removes the chunk from its queue */
+		chunk.free(Cache_driver::CACHE_BLK_SIZE, chunk.base_offset());
+		s += sizeof(Chunk);
+	}
+
+	if (s < size) throw Block::Driver::Request_congestion();
+}
@@ -0,0 +1,86 @@
+/*
+ * \brief  Scan-resistant 2Q cache replacement strategy
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _TWO_QUEUE_H_
+#define _TWO_QUEUE_H_
+
+#include <util/noncopyable.h>
+
+#include "chunk.h"
+
+/**
+ * 2Q replacement policy (Johnson and Shasha, VLDB 1994)
+ *
+ * Chunks enter the FIFO queue 'A1in' when populated. Chunks evicted from
+ * 'A1in' are remembered in the ghost queue 'A1out'. A chunk that is
+ * populated again while remembered in 'A1out' has been referenced beyond
+ * the correlated-reference period and enters the LRU queue 'Am'. Hence,
+ * a sequential scan only circulates through 'A1in' and leaves the
+ * frequently used chunks in 'Am' intact.
+ */
+struct Two_queue_policy
+{
+	struct Queue;
+
+	class Element : Genode::Noncopyable
+	{
+		private:
+
+			friend struct Two_queue_policy;
+
+			Element *_prev  { nullptr };
+			Element *_next  { nullptr };
+			Queue   *_queue { nullptr };
+
+		public:
+
+			Element() { }
+
+			~Element() { Two_queue_policy::_remove(*this); }
+	};
+
+	struct Queue
+	{
+		Element *head  { nullptr }; /* least recently used */
+		Element *tail  { nullptr }; /* most recently used  */
+		unsigned count { 0 };
+	};
+
+	static void _append(Queue &, Element &);
+	static void _remove(Element &);
+	static void _access(Element &);
+
+	/**
+	 * Admit chunk populated from the backend
+	 */
+	static void fill(const Element *e);
+
+	static void read(const Element  *e);
+	static void write(const Element *e);
+
+	/**
+	 * Evict clean chunks
+	 *
+	 * \param size  amount of memory to free, or 0 to evict all chunks
+	 *
+	 * \throw Block::Driver::Request_congestion
+	 */
+	static void flush(Cache::size_t size = 0);
+
+	/**
+	 * Return number of chunks managed by the policy
+	 */
+	static unsigned resident_chunks();
+};
+
+#endif /* _TWO_QUEUE_H_ */
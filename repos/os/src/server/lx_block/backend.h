@@ -0,0 +1,130 @@
+/*
+ * \brief  Interface of the asynchronous I/O backends of lx_block
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU General Public License version 2.
+ */
+
+#ifndef _LX_BLOCK__BACKEND_H_
+#define _LX_BLOCK__BACKEND_H_
+
+/* Genode includes */
+#include <block_session/block_session.h>
+#include <util/fifo.h>
+#include <util/interface.h>
+
+/* libc includes */
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <errno.h>
+#include <unistd.h>
+
+namespace Lx_block {
+
+	struct Request;
+	struct Backend;
+}
+
+
+/**
+ * Block request in flight
+ *
+ * The request objects are owned by the driver. While a request is in
+ * flight, it is exclusively accessed by the backend.
+ */
+struct Lx_block::Request : Genode::Fifo<Request>::Element
+{
+	enum class Op { READ, WRITE };
+
+	Block::Packet_descriptor packet { };
+
+	Op      op     = Op::READ;
+	char   *buffer = nullptr;
+	off_t   offset = 0;
+	size_t  count  = 0;
+
+	/*
+	 * Progress of the request, updated by the backend
+	 */
+	size_t done  = 0;
+	int    error = 0;
+
+	/* I/O vector referenced by the io_uring submission-queue entry */
+	struct iovec iov { };
+
+	bool in_use = false;
+
+	bool finished() const { return error || done == count; }
+
+	/**
+	 * Account the result of a (partial) transfer
+	 *
+	 * \param result  number of transferred bytes or negative errno
+	 */
+	void transferred(ssize_t result)
+	{
+		if (result < 0)  error = (int)-result;
+		else if (!result) error = EIO;   /* unexpected end of file */
+		else              done += result;
+	}
+
+	/**
+	 * Perform the remaining transfer synchronously
+	 */
+	void transfer(int fd)
+	{
+		while (!finished()) {
+
+			char  * const ptr = buffer + done;
+			size_t  const len = count  - done;
+			off_t   const pos = offset + done;
+
+			ssize_t const n = (op == Op::READ) ? pread (fd, ptr, len, pos)
+			                                   : pwrite(fd, ptr, len, pos);
+			if (n == -1 && errno == EINTR)
+				continue;
+
+			transferred(n == -1 ? -errno : n);
+		}
+	}
+};
+
+
+struct Lx_block::Backend : Genode::Interface
+{
+	/**
+	 * Interface for handling completed requests
+	 */
+	struct Completion_handler : Genode::Interface
+	{
+		virtual void completed(Request &) = 0;
+	};
+
+	virtual char const *name() const = 0;
+
+	/**
+	 * Start processing of request
+	 */
+	virtual void submit(Request &) = 0;
+
+	/**
+	 * Pass completed requests to the completion handler
+	 *
+	 * This method is called by the entrypoint, after the backend
+	 * triggered the completion signal.
+	 */
+	virtual void process_completions() = 0;
+
+	/**
+	 * Block until at least one request got completed and process it
+	 */
+	virtual void wait_for_completion() = 0;
+};
+
+#endif /* _LX_BLOCK__BACKEND_H_ */
@@ -20,12 +20,21 @@
 #include <block/driver.h>
 #include <util/string.h>
 
+/* local includes */
+#include "worker_backend.h"
+#if __has_include(<linux/io_uring.h>)
+#include "uring_backend.h"
+#define LX_BLOCK_IO_URING
+#endif
+
 /* libc includes */
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <stdio.h> /* perror */
+#include <string.h> /* strerror */
+#include <errno.h>
 
 
 static bool xml_attr_ok(Genode::Xml_node node, char const *attr)
@@ -34,10 +43,21 @@ static bool xml_attr_ok(Genode::Xml_node node, char const *attr)
 }
 
 
-class Lx_block_driver : public Block::Driver
+class Lx_block_driver : public Block::Driver,
+                        private Lx_block::Backend::Completion_handler
 {
 	private:
 
+		/*
+		 * Noncopyable
+		 */
+		Lx_block_driver(Lx_block_driver const &);
+		Lx_block_driver &operator = (Lx_block_driver const &);
+
+		using Request = Lx_block::Request;
+
+		enum { MAX_QUEUE_DEPTH = 64 };
+
 		Genode::Env &_env;
 
 		Block::Session::Info const _info;
@@ -70,16 +90,123 @@ class Lx_block_driver : public Block::Driver
 			Genode::size_t const block_size =
 				config.attribute_value("block_size", default_block_size);
 
+			/* buffers used for O_DIRECT must be page aligned */
+			Genode::size_t const align_log2 = xml_attr_ok(config, "direct")
+			                                ? Genode::max(Genode::log2(block_size), 12UL)
+			                                : Genode::log2(block_size);
 			return {
 				.block_size  = block_size,
 				.block_count = st.st_size / block_size,
-				.align_log2  = Genode::log2(block_size),
+				.align_log2  = align_log2,
 				.writeable   = xml_attr_ok(config, "writeable")
 			};
 		}
 
 		int _fd { -1 };
 
+		/*
+		 * Asynchronous operation, used if 'queue_depth' is greater than 1
+		 */
+
+		unsigned const _queue_depth;
+		unsigned       _in_flight = 0;
+
+		Request _requests[MAX_QUEUE_DEPTH] { };
+
+		Genode::Signal_handler<Lx_block_driver> _completion_handler {
+			_env.ep(), *this, &Lx_block_driver::_handle_completions };
+
+		Genode::Constructible<Lx_block::Worker_backend> _worker_backend { };
+#ifdef LX_BLOCK_IO_URING
+		Genode::Constructible<Lx_block::Uring_backend>  _uring_backend  { };
+#endif
+
+		Lx_block::Backend *_backend = nullptr;
+
+		void _construct_backend(Genode::Xml_node const &config)
+		{
+			if (_queue_depth < 2)
+				return;
+
+			Lx_block::Backend::Completion_handler &handler = *this;
+
+#ifdef LX_BLOCK_IO_URING
+			if (config.attribute_value("io_uring", true)) {
+				try {
+					_uring_backend.construct(_env, _fd, _queue_depth,
+					                         _completion_handler, handler);
+					_backend = &*_uring_backend;
+					return;
+				} catch (Lx_block::Uring_backend::Setup_failed) {
+					Genode::warning("io_uring not available, using worker threads"); }
+			}
+#endif
+			unsigned const workers =
+				config.attribute_value("workers", Genode::min(_queue_depth, 8U));
+
+			_worker_backend.construct(_env, _fd, workers,
+			                          _completion_handler, handler);
+			_backend = &*_worker_backend;
+		}
+
+		void _handle_completions() { _backend->process_completions(); }
+
+		/**
+		 * Wait until all requests in flight are completed
+		 */
+		void _drain()
+		{
+			while (_in_flight)
+				_backend->wait_for_completion();
+		}
+
+		void _submit(Request::Op               op,
+		             Block::sector_t           block_number,
+		             Genode::size_t            block_count,
+		             char                     *buffer,
+		             Block::Packet_descriptor &packet)
+		{
+			Request *request_ptr = nullptr;
+			for (unsigned i = 0; i < _queue_depth && !request_ptr; i++)
+				if (!_requests[i].in_use)
+					request_ptr = &_requests[i];
+
+			if (!request_ptr)
+				throw Request_congestion();
+
+			Request &request = *request_ptr;
+
+			request.packet = packet;
+			request.op     = op;
+			request.buffer = buffer;
+			request.offset = block_number * _info.block_size;
+			request.count  = block_count  * _info.block_size;
+			request.done   = 0;
+			request.error  = 0;
+			request.in_use = true;
+
+			_in_flight++;
+			_backend->submit(request);
+		}
+
+		/**
+		 * Completion_handler interface
+		 */
+		void completed(Request &request) override
+		{
+			request.in_use = false;
+			_in_flight--;
+
+			if (request.error)
+				Genode::error(request.op == Request::Op::READ ? "read" : "write",
+				              " at offset ", request.offset, " failed: ",
+				              Genode::Cstring(strerror(request.error)));
+
+			/* the packet may trigger the submission of a new request */
+			Block::Packet_descriptor packet = request.packet;
+			ack_packet(packet, !request.error);
+		}
+
 	public:
 
 		struct Could_not_open_file : Genode::Exception { };
@@ -88,23 +215,43 @@ class Lx_block_driver : public Block::Driver
 		:
 			Block::Driver(env.ram()),
 			_env(env),
-			_info(_init_info(config))
+			_info(_init_info(config)),
+			_queue_depth(Genode::min(config.attribute_value("queue_depth", 1U),
+			                         (unsigned)MAX_QUEUE_DEPTH))
 		{
+			bool const direct = xml_attr_ok(config, "direct");
+
 			/* open file */
 			File_name const file_name = _file_name(config);
-			_fd = open(file_name.string(), _info.writeable ? O_RDWR : O_RDONLY);
+			_fd = open(file_name.string(), (_info.writeable ? O_RDWR : O_RDONLY)
+			                             | (direct ? O_DIRECT : 0));
 			if (_fd == -1) {
 				Genode::error("open ", file_name.string());
 				throw Could_not_open_file();
 			}
 
+			_construct_backend(config);
+
 			Genode::log("Provide '", file_name, "' as block device "
 			            "block_size:  ", _info.block_size, " "
 			            "block_count: ", _info.block_count, " "
-			            "writeable:   ", _info.writeable ? "yes" : "no");
+			            "writeable:   ", _info.writeable ? "yes" : "no", " "
+			            "direct:      ", direct ? "yes" : "no", " "
+			            "queue_depth: ", _backend ? _queue_depth : 1, " "
+			            "io:          ", _backend ? _backend->name() : "sync");
 		}
 
-		~Lx_block_driver() { close(_fd); }
+		~Lx_block_driver()
+		{
+			if (_backend)
+				_drain();
+
+			_worker_backend.destruct();
+#ifdef LX_BLOCK_IO_URING
+			_uring_backend.destruct();
+#endif
+			close(_fd);
+		}
 
 
 		/*****************************
@@ -118,6 +265,12 @@ class Lx_block_driver : public Block::Driver
 		          char                     *buffer,
 		          Block::Packet_descriptor &packet) override
 		{
+			if (_backend) {
+				_submit(Request::Op::READ, block_number, block_count,
+				        buffer, packet);
+				return;
+			}
+
 			off_t  const offset = block_number * _info.block_size;
 			size_t const count  = block_count  * _info.block_size;
 
@@ -140,6 +293,12 @@ class Lx_block_driver : public Block::Driver
 				throw Io_error();
 			}
 
+			if (_backend) {
+				_submit(Request::Op::WRITE, block_number, block_count,
+				        const_cast<char *>(buffer), packet);
+				return;
+			}
+
 			off_t  const offset = block_number * _info.block_size;
 			size_t const count  = block_count  * _info.block_size;
 
@@ -152,7 +311,49 @@ class Lx_block_driver : public Block::Driver
 			ack_packet(packet);
 		}
 
-		void sync() override { }
+		/*
+		 * Sync and trim requests are executed only when no request is in
+		 * flight. Otherwise, the session retries them on the next
+		 * acknowledgement. Waiting for the completions here instead would
+		 * acknowledge packets from within the packet handling of the
+		 * session.
+		 */
+
+		void sync() override
+		{
+			/* the sync covers all writes submitted before */
+			if (_in_flight)
+				throw Request_congestion();
+
+			if (fdatasync(_fd) == -1) {
+				perror("fdatasync");
+				throw Io_error();
+			}
+		}
+
+		void trim(Block::sector_t block_number,
+		          Genode::size_t  block_count) override
+		{
+			if (_in_flight)
+				throw Request_congestion();
+
+			off_t const offset = block_number * _info.block_size;
+			off_t const length = block_count  * _info.block_size;
+
+			/* file systems without hole-punching support ignore the hint */
+			if (fallocate(_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+			              offset, length) == -1 && errno != EOPNOTSUPP) {
+				perror("fallocate");
+				throw Io_error();
+			}
+		}
+
+		void session_invalidated() override
+		{
+			/* the packet-stream buffer must not be accessed afterwards */
+			if (_backend)
+				_drain();
+		}
 };
 
 
@@ -0,0 +1,335 @@
+/*
+ * \brief  I/O backend using the io_uring interface of the Linux kernel
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU General Public License version 2.
+ */
+
+#ifndef _LX_BLOCK__URING_BACKEND_H_
+#define _LX_BLOCK__URING_BACKEND_H_
+
+/* Genode includes */
+#include <base/blockade.h>
+#include <base/exception.h>
+#include <base/signal.h>
+#include <base/thread.h>
+#include <util/reconstructible.h>
+#include <util/string.h>
+
+/* local includes */
+#include "backend.h"
+
+/* Linux includes */
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+namespace Lx_block { class Uring_backend; }
+
+
+/**
+ * Backend that submits the requests to an io_uring instance
+ *
+ * The rings are accessed by the entrypoint only. A completion thread
+ * blocks in the kernel until completion-queue entries become available and
+ * signals the entrypoint, which in turn processes the entries. The
+ * interface is used via raw system calls so that lx_block does not depend
+ * on liburing.
+ */
+class Lx_block::Uring_backend : public Backend
+{
+	public:
+
+		struct Setup_failed : Genode::Exception { };
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Uring_backend(Uring_backend const &);
+		Uring_backend &operator = (Uring_backend const &);
+
+		struct Completion_thread : Genode::Thread
+		{
+			Uring_backend &_backend;
+
+			Genode::Blockade blockade { };
+
+			Completion_thread(Genode::Env &env, Uring_backend &backend)
+			:
+				Genode::Thread(env, "io_uring", 8*1024*sizeof(long)),
+				_backend(backend)
+			{ }
+
+			void entry() override
+			{
+				for (;;) {
+
+					/* block until a completion-queue entry is available */
+					_backend._enter(0, 1, IORING_ENTER_GETEVENTS);
+
+					if (_backend._exit)
+						return;
+
+					Genode::Signal_transmitter(_backend._sigh).submit();
+
+					/* wait until the entrypoint processed the entries */
+					blockade.block();
+
+					if (_backend._exit)
+						return;
+				}
+			}
+		};
+
+		int const _fd;
+
+		Completion_handler &_handler;
+
+		Genode::Signal_context_capability const _sigh;
+
+		struct Mapping
+		{
+			void   *ptr  = MAP_FAILED;
+			size_t  size = 0;
+
+			template <typename T>
+			T *at(unsigned offset) const { return (T *)((char *)ptr + offset); }
+		};
+
+		Mapping _sq_ring { }, _cq_ring { }, _sqe_array { };
+
+		int _ring_fd = -1;
+
+		unsigned *_sq_head  = nullptr, *_sq_tail = nullptr,
+		         *_sq_mask  = nullptr, *_sq_index = nullptr;
+		unsigned *_cq_head  = nullptr, *_cq_tail = nullptr,
+		         *_cq_mask  = nullptr;
+
+		io_uring_sqe *_sqes = nullptr;
+		io_uring_cqe *_cqes = nullptr;
+
+		bool volatile _exit = false;
+
+		Genode::Constructible<Completion_thread> _thread { };
+
+		int _enter(unsigned to_submit, unsigned min_complete, unsigned flags)
+		{
+			for (;;) {
+				long const ret = syscall(__NR_io_uring_enter, _ring_fd, to_submit,
+				                         min_complete, flags, nullptr, 0);
+				if (ret >= 0)
+					return (int)ret;
+
+				if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+					return -errno;
+			}
+		}
+
+		static Mapping _map(int fd, size_t size, off_t offset)
+		{
+			Mapping mapping { };
+			mapping.ptr  = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+			                    MAP_SHARED | MAP_POPULATE, fd, offset);
+			mapping.size = size;
+
+			if (mapping.ptr == MAP_FAILED)
+				throw Setup_failed();
+
+			return mapping;
+		}
+
+		static void _unmap(Mapping &mapping)
+		{
+			if (mapping.ptr != MAP_FAILED)
+				munmap(mapping.ptr, mapping.size);
+
+			mapping.ptr = MAP_FAILED;
+		}
+
+		void _cleanup()
+		{
+			if (_cq_ring.ptr == _sq_ring.ptr)
+				_cq_ring.ptr = MAP_FAILED;
+
+			_unmap(_sqe_array);
+			_unmap(_cq_ring);
+			_unmap(_sq_ring);
+
+			if (_ring_fd != -1)
+				close(_ring_fd);
+
+			_ring_fd = -1;
+		}
+
+		void _setup(unsigned entries)
+		{
+			io_uring_params params { };
+
+			_ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+			if (_ring_fd < 0) {
+				_ring_fd = -1;
+				throw Setup_failed();
+			}
+
+			size_t const sq_size = params.sq_off.array
+			                     + params.sq_entries*sizeof(unsigned);
+			size_t const cq_size = params.cq_off.cqes
+			                     + params.cq_entries*sizeof(io_uring_cqe);
+
+			/* kernels since 5.4 map both rings at once */
+			bool const single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+
+			_sq_ring = _map(_ring_fd, single_mmap ? Genode::max(sq_size, cq_size)
+			                                      : sq_size, IORING_OFF_SQ_RING);
+			_cq_ring = single_mmap ? _sq_ring
+			                       : _map(_ring_fd, cq_size, IORING_OFF_CQ_RING);
+
+			_sqe_array = _map(_ring_fd, params.sq_entries*sizeof(io_uring_sqe),
+			                  IORING_OFF_SQES);
+
+			_sq_head  = _sq_ring.at<unsigned>(params.sq_off.head);
+			_sq_tail  = _sq_ring.at<unsigned>(params.sq_off.tail);
+			_sq_mask  = _sq_ring.at<unsigned>(params.sq_off.ring_mask);
+			_sq_index = _sq_ring.at<unsigned>(params.sq_off.array);
+			_sqes     = _sqe_array.at<io_uring_sqe>(0);
+
+			_cq_head  = _cq_ring.at<unsigned>(params.cq_off.head);
+			_cq_tail  = _cq_ring.at<unsigned>(params.cq_off.tail);
+			_cq_mask  = _cq_ring.at<unsigned>(params.cq_off.ring_mask);
+			_cqes     = _cq_ring.at<io_uring_cqe>(params.cq_off.cqes);
+		}
+
+		void _submit_sqe(Request *request)
+		{
+			unsigned const tail  = *_sq_tail;
+			unsigned const index = tail & *_sq_mask;
+
+			io_uring_sqe &sqe = _sqes[index];
+			Genode::memset(&sqe, 0, sizeof(sqe));
+
+			if (request) {
+				request->iov.iov_base = request->buffer + request->done;
+				request->iov.iov_len  = request->count  - request->done;
+
+				sqe.opcode    = (request->op == Request::Op::READ) ? IORING_OP_READV
+				                                                   : IORING_OP_WRITEV;
+				sqe.fd        = _fd;
+				sqe.off       = request->offset + request->done;
+				sqe.addr      = (__u64)&request->iov;
+				sqe.len       = 1;
+				sqe.user_data = (__u64)request;
+			} else {
+				sqe.opcode    = IORING_OP_NOP;
+			}
+
+			_sq_index[index] = index;
+			__atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+			int const ret = _enter(1, 0, 0);
+			if (ret >= 0)
+				return;
+
+			/* withdraw the entry not consumed by the kernel */
+			if (__atomic_load_n(_sq_head, __ATOMIC_ACQUIRE) == tail)
+				__atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+			if (request) {
+				request->error = -ret;
+				_handler.completed(*request);
+			}
+		}
+
+	public:
+
+		/**
+		 * Constructor
+		 *
+		 * \param entries  maximum number of requests in flight
+		 *
+		 * \throw Setup_failed  io_uring is not supported by the kernel
+		 */
+		Uring_backend(Genode::Env                       &env,
+		              int                                fd,
+		              unsigned                           entries,
+		              Genode::Signal_context_capability  sigh,
+		              Completion_handler                &handler)
+		:
+			_fd(fd), _handler(handler), _sigh(sigh)
+		{
+			try { _setup(entries); }
+			catch (Setup_failed) { _cleanup(); throw; }
+
+			_thread.construct(env, *this);
+			_thread->start();
+		}
+
+		~Uring_backend()
+		{
+			/* unblock the completion thread */
+			_exit = true;
+			_submit_sqe(nullptr);
+			_thread->blockade.wakeup();
+			_thread->join();
+			_thread.destruct();
+
+			_cleanup();
+		}
+
+
+		/***********************
+		 ** Backend interface **
+		 ***********************/
+
+		char const *name() const override { return "io_uring"; }
+
+		void submit(Request &request) override { _submit_sqe(&request); }
+
+		void process_completions() override
+		{
+			/*
+			 * Consume one entry at a time because the completion handler
+			 * may submit new requests or process completions itself.
+			 */
+			for (;;) {
+
+				unsigned const head = *_cq_head;
+				if (head == __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE))
+					break;
+
+				io_uring_cqe const cqe = _cqes[head & *_cq_mask];
+				__atomic_store_n(_cq_head, head + 1, __ATOMIC_RELEASE);
+
+				Request * const request = (Request *)cqe.user_data;
+				if (!request)
+					continue;
+
+				request->transferred(cqe.res);
+
+				/* resubmit the remainder of a partial transfer */
+				if (!request->finished()) {
+					_submit_sqe(request);
+					continue;
+				}
+
+				_handler.completed(*request);
+			}
+
+			_thread->blockade.wakeup();
+		}
+
+		void wait_for_completion() override
+		{
+			_enter(0, 1, IORING_ENTER_GETEVENTS);
+			process_completions();
+		}
+};
+
+#endif /* _LX_BLOCK__URING_BACKEND_H_ */
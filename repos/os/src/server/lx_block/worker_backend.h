@@ -0,0 +1,214 @@
+/*
+ * \brief  I/O backend using a pool of worker threads
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU General Public License version 2.
+ */
+
+#ifndef _LX_BLOCK__WORKER_BACKEND_H_
+#define _LX_BLOCK__WORKER_BACKEND_H_
+
+/* Genode includes */
+#include <base/blockade.h>
+#include <base/mutex.h>
+#include <base/semaphore.h>
+#include <base/signal.h>
+#include <base/thread.h>
+#include <util/reconstructible.h>
+
+/* local includes */
+#include "backend.h"
+
+namespace Lx_block { class Worker_backend; }
+
+
+/**
+ * Backend that performs blocking 'pread'/'pwrite' calls in worker threads
+ *
+ * This backend is used if io_uring is not available. Each worker processes
+ * one request at a time. Hence, the number of workers limits the number of
+ * requests that are processed concurrently by the kernel.
+ */
+class Lx_block::Worker_backend : public Backend
+{
+	public:
+
+		enum { MAX_WORKERS = 16 };
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Worker_backend(Worker_backend const &);
+		Worker_backend &operator = (Worker_backend const &);
+
+		struct Worker : Genode::Thread
+		{
+			Worker_backend &_backend;
+
+			Worker(Genode::Env &env, Worker_backend &backend)
+			:
+				Genode::Thread(env, "worker", 8*1024*sizeof(long)),
+				_backend(backend)
+			{ }
+
+			void entry() override { _backend._work(); }
+		};
+
+		int const _fd;
+
+		Completion_handler &_handler;
+
+		Genode::Signal_context_capability const _sigh;
+
+		Genode::Mutex     _mutex       { };
+		Genode::Semaphore _pending_sem { };
+		Genode::Blockade  _blockade    { };
+
+		/* protected by '_mutex' */
+		Genode::Fifo<Request> _pending   { };
+		Genode::Fifo<Request> _completed { };
+		bool                  _waiting = false;
+		bool                  _exit    = false;
+
+		unsigned const _num_workers;
+
+		Genode::Constructible<Worker> _workers[MAX_WORKERS] { };
+
+		void _work()
+		{
+			for (;;) {
+
+				_pending_sem.down();
+
+				Request *request_ptr = nullptr;
+				{
+					Genode::Mutex::Guard guard(_mutex);
+
+					if (_exit)
+						return;
+
+					_pending.dequeue([&] (Request &request) {
+						request_ptr = &request; });
+				}
+
+				if (!request_ptr)
+					continue;
+
+				request_ptr->transfer(_fd);
+
+				bool wakeup = false;
+				{
+					Genode::Mutex::Guard guard(_mutex);
+
+					_completed.enqueue(*request_ptr);
+
+					wakeup   = _waiting;
+					_waiting = false;
+				}
+
+				if (wakeup)
+					_blockade.wakeup();
+				else
+					Genode::Signal_transmitter(_sigh).submit();
+			}
+		}
+
+	public:
+
+		Worker_backend(Genode::Env                       &env,
+		               int                                fd,
+		               unsigned                           num_workers,
+		               Genode::Signal_context_capability  sigh,
+		               Completion_handler                &handler)
+		:
+			_fd(fd), _handler(handler), _sigh(sigh),
+			_num_workers(Genode::min(Genode::max(num_workers, 1U),
+			                         (unsigned)MAX_WORKERS))
+		{
+			for (unsigned i = 0; i < _num_workers; i++) {
+				_workers[i].construct(env, *this);
+				_workers[i]->start();
+			}
+		}
+
+		~Worker_backend()
+		{
+			{
+				Genode::Mutex::Guard guard(_mutex);
+				_exit = true;
+			}
+
+			for (unsigned i = 0; i < _num_workers; i++)
+				_pending_sem.up();
+
+			for (unsigned i = 0; i < _num_workers; i++) {
+				_workers[i]->join();
+				_workers[i].destruct();
+			}
+		}
+
+		unsigned num_workers() const { return _num_workers; }
+
+
+		/***********************
+		 ** Backend interface **
+		 ***********************/
+
+		char const *name() const override { return "threads"; }
+
+		void submit(Request &request) override
+		{
+			{
+				Genode::Mutex::Guard guard(_mutex);
+				_pending.enqueue(request);
+			}
+			_pending_sem.up();
+		}
+
+		void process_completions() override
+		{
+			/*
+			 * Dequeue one request at a time because the completion handler
+			 * may submit new requests or process completions itself.
+			 */
+			for (;;) {
+
+				Request *request_ptr = nullptr;
+				{
+					Genode::Mutex::Guard guard(_mutex);
+					_completed.dequeue([&] (Request &request) {
+						request_ptr = &request; });
+				}
+
+				if (!request_ptr)
+					return;
+
+				_handler.completed(*request_ptr);
+			}
+		}
+
+		void wait_for_completion() override
+		{
+			bool block = false;
+			{
+				Genode::Mutex::Guard guard(_mutex);
+				if (_completed.empty())
+					block = _waiting = true;
+			}
+
+			if (block)
+				_blockade.block();
+
+			process_completions();
+		}
+};
+
+#endif /* _LX_BLOCK__WORKER_BACKEND_H_ */
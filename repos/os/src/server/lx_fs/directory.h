@@ -23,6 +23,7 @@
 
 /* libc includes */
 #include <stdio.h>
+#include <time.h>
 
 /* local includes */
 #include "file.h"
@@ -51,6 +52,23 @@ class Lx_fs::Directory : public Node
 		Path       _path;
 		Allocator &_alloc;
 
+		/*
+		 * Index of the entry returned by the next 'readdir' call
+		 *
+		 * Sequential reads continue at the current position of the
+		 * directory stream, which fetches the entries from the kernel in
+		 * batches. The stream is rewound only if a client seeks backwards.
+		 */
+		seek_off_t _cursor = 0;
+
+		/*
+		 * Number of entries counted at '_counted_at' for the directory
+		 * modification time '_counted_mtime'
+		 */
+		size_t          _num_entries_cached = 0;
+		struct timespec _counted_mtime { };
+		struct timespec _counted_at    { };
+
 		unsigned long _inode(char const *path, bool create)
 		{
 			int ret;
@@ -88,16 +106,68 @@ class Lx_fs::Directory : public Node
 			return fd;
 		}
 
-		size_t _num_entries() const
+		void _rewind()
 		{
-			unsigned num = 0;
-
 			rewinddir(_fd);
-			while (readdir(_fd)) ++num;
+			_cursor = 0;
+		}
+
+		struct dirent *_next_dirent()
+		{
+			struct dirent *dent = readdir(_fd);
+			if (dent)
+				_cursor++;
+
+			return dent;
+		}
+
+		/**
+		 * Count entries without disturbing the cursor
+		 */
+		size_t _count_entries() const
+		{
+			int const fd = openat(dirfd(_fd), ".", O_RDONLY | O_DIRECTORY);
+			if (fd == -1)
+				return 0;
+
+			DIR *dir = fdopendir(fd);
+			if (!dir) {
+				close(fd);
+				return 0;
+			}
 
+			size_t num = 0;
+			while (readdir(dir)) ++num;
+
+			closedir(dir);
 			return num;
 		}
 
+		static bool _equal(struct timespec const &a, struct timespec const &b) {
+			return a.tv_sec == b.tv_sec && a.tv_nsec == b.tv_nsec; }
+
+		/**
+		 * Return number of entries, recounted only if the directory changed
+		 *
+		 * The cached number is valid only if the modification time lies
+		 * in an earlier second than the counting. Otherwise, a modification
+		 * within the granularity of the file-system timestamps could go
+		 * unnoticed.
+		 */
+		size_t _num_entries(struct stat const &st)
+		{
+			bool const cached = _equal(st.st_mtim, _counted_mtime)
+			                 && st.st_mtim.tv_sec < _counted_at.tv_sec;
+			if (cached)
+				return _num_entries_cached;
+
+			clock_gettime(CLOCK_REALTIME, &_counted_at);
+			_counted_mtime      = st.st_mtim;
+			_num_entries_cached = _count_entries();
+
+			return _num_entries_cached;
+		}
+
 	public:
 
 		Directory(Allocator &alloc, char const *path, bool create)
@@ -192,44 +262,53 @@ class Lx_fs::Directory : public Node
 				return 0;
 			}
 
-			seek_off_t index = seek_offset / sizeof(Directory_entry);
+			seek_off_t const index = seek_offset / sizeof(Directory_entry);
 
-			/* seek to index and read entry */
-			struct dirent *dent;
-			rewinddir(_fd);
-			for (unsigned i = 0; i <= index; ++i) {
-				dent = readdir(_fd);
-			}
+			/* reposition the cursor on non-sequential access */
+			if (index < _cursor)
+				_rewind();
 
-			if (!dent)
-				return 0;
-
-			Path dent_path(dent->d_name, _path.base());
+			while (_cursor < index)
+				if (!_next_dirent())
+					return 0;
 
-			struct stat st { };
-			lstat(dent_path.base(), &st);
-
-			auto type = [] (unsigned char type)
+			auto type = [] (unsigned char type, mode_t mode)
 			{
 				switch (type) {
 				case DT_REG: return Node_type::CONTINUOUS_FILE;
 				case DT_DIR: return Node_type::DIRECTORY;
 				case DT_LNK: return Node_type::SYMLINK;
+				case DT_UNKNOWN:
+					if (S_ISDIR(mode)) return Node_type::DIRECTORY;
+					if (S_ISLNK(mode)) return Node_type::SYMLINK;
+					return Node_type::CONTINUOUS_FILE;
 				default:     return Node_type::CONTINUOUS_FILE;
 				}
 			};
 
-			Directory_entry &e = *(Directory_entry *)(dst);
-			e = {
-				.inode = (unsigned long)dent->d_ino,
-				.type  = type(dent->d_type),
-				.rwx   = { .readable   = (st.st_mode & S_IRUSR) != 0,
-				           .writeable  = (st.st_mode & S_IWUSR) != 0,
-				           .executable = (st.st_mode & S_IXUSR) != 0},
-				.name  = { dent->d_name }
-			};
+			/* fill as many entries into the buffer as possible */
+			size_t num = 0;
+			for (; (num + 1)*sizeof(Directory_entry) <= len; num++) {
+
+				struct dirent *dent = _next_dirent();
+				if (!dent)
+					break;
+
+				struct stat st { };
+				fstatat(dirfd(_fd), dent->d_name, &st, AT_SYMLINK_NOFOLLOW);
+
+				Directory_entry &e = ((Directory_entry *)dst)[num];
+				e = {
+					.inode = (unsigned long)dent->d_ino,
+					.type  = type(dent->d_type, st.st_mode),
+					.rwx   = { .readable   = (st.st_mode & S_IRUSR) != 0,
+					           .writeable  = (st.st_mode & S_IWUSR) != 0,
+					           .executable = (st.st_mode & S_IXUSR) != 0},
+					.name  = { dent->d_name }
+				};
+			}
 
-			return sizeof(Directory_entry);
+			return num*sizeof(Directory_entry);
 		}
 
 		size_t write(char const *, size_t, seek_off_t) override
@@ -253,7 +332,7 @@ class Lx_fs::Directory : public Node
 				st.st_mtime = 0;
 
 			return {
-				.size  = _num_entries() * sizeof(File_system::Directory_entry),
+				.size  = _num_entries(st) * sizeof(File_system::Directory_entry),
 				.type  = Node_type::DIRECTORY,
 				.rwx   = { .readable   = (st.st_mode & S_IRUSR) != 0,
 				           .writeable  = (st.st_mode & S_IWUSR) != 0,
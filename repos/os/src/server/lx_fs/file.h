@@ -112,6 +112,11 @@ class Lx_fs::File : public Node
 			close(_fd);
 		}
 
+		/*
+		 * Reading and writing accesses the file descriptor only
+		 */
+		bool io_thread_safe() const override { return true; }
+
 		void update_modification_time(Timestamp const time) override
 		{
 			struct timespec ts[2] = {
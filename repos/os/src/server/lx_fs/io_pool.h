@@ -0,0 +1,243 @@
+/*
+ * \brief  Pool of threads for reading and writing files
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _IO_POOL_H_
+#define _IO_POOL_H_
+
+/* Genode includes */
+#include <base/blockade.h>
+#include <base/mutex.h>
+#include <base/semaphore.h>
+#include <base/signal.h>
+#include <base/thread.h>
+#include <util/fifo.h>
+#include <util/reconstructible.h>
+
+/* local includes */
+#include "node.h"
+
+namespace Lx_fs {
+
+	struct Io_job;
+	class  Io_pool;
+}
+
+
+/**
+ * Read or write operation executed by an I/O thread
+ */
+struct Lx_fs::Io_job : Genode::Fifo<Io_job>::Element
+{
+	struct Owner : Genode::Interface
+	{
+		/**
+		 * Called by the entrypoint for each completed job
+		 */
+		virtual void io_completed(Io_job &) = 0;
+	};
+
+	enum class Op { READ, WRITE };
+
+	Owner &owner;
+	Node  &node;
+
+	Op          op       = Op::READ;
+	char       *buffer   = nullptr;
+	size_t      length   = 0;
+	seek_off_t  position = 0;
+
+	size_t result = 0;
+
+	Io_job(Owner &owner, Node &node) : owner(owner), node(node) { }
+
+	void execute()
+	{
+		result = (op == Op::READ) ? node.read (buffer, length, position)
+		                          : node.write(buffer, length, position);
+	}
+};
+
+
+/**
+ * Threads that execute the blocking file operations
+ *
+ * The jobs are executed in the order of their submission, but may complete
+ * out of order. Completed jobs are handed back to their owners in the
+ * context of the entrypoint.
+ */
+class Lx_fs::Io_pool
+{
+	public:
+
+		enum { MAX_THREADS = 16 };
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Io_pool(Io_pool const &);
+		Io_pool &operator = (Io_pool const &);
+
+		struct Io_thread : Genode::Thread
+		{
+			Io_pool &_pool;
+
+			Io_thread(Genode::Env &env, Io_pool &pool)
+			:
+				Genode::Thread(env, "io", 8*1024*sizeof(long)), _pool(pool)
+			{ }
+
+			void entry() override { _pool._work(); }
+		};
+
+		Genode::Mutex     _mutex       { };
+		Genode::Semaphore _pending_sem { };
+		Genode::Blockade  _blockade    { };
+
+		/* protected by '_mutex' */
+		Genode::Fifo<Io_job> _pending   { };
+		Genode::Fifo<Io_job> _completed { };
+		bool                 _waiting = false;
+		bool                 _exit    = false;
+
+		Genode::Signal_handler<Io_pool> _completion_handler;
+
+		unsigned const _num_threads;
+
+		Genode::Constructible<Io_thread> _threads[MAX_THREADS] { };
+
+		void _work()
+		{
+			for (;;) {
+
+				_pending_sem.down();
+
+				Io_job *job_ptr = nullptr;
+				{
+					Genode::Mutex::Guard guard(_mutex);
+
+					if (_exit)
+						return;
+
+					_pending.dequeue([&] (Io_job &job) { job_ptr = &job; });
+				}
+
+				if (!job_ptr)
+					continue;
+
+				job_ptr->execute();
+
+				bool wakeup = false;
+				{
+					Genode::Mutex::Guard guard(_mutex);
+
+					_completed.enqueue(*job_ptr);
+
+					wakeup   = _waiting;
+					_waiting = false;
+				}
+
+				if (wakeup)
+					_blockade.wakeup();
+				else
+					_completion_handler.local_submit();
+			}
+		}
+
+		void _handle_completions() { process_completions(); }
+
+	public:
+
+		Io_pool(Genode::Env &env, unsigned num_threads)
+		:
+			_completion_handler(env.ep(), *this, &Io_pool::_handle_completions),
+			_num_threads(Genode::min(num_threads, (unsigned)MAX_THREADS))
+		{
+			for (unsigned i = 0; i < _num_threads; i++) {
+				_threads[i].construct(env, *this);
+				_threads[i]->start();
+			}
+		}
+
+		~Io_pool()
+		{
+			{
+				Genode::Mutex::Guard guard(_mutex);
+				_exit = true;
+			}
+
+			for (unsigned i = 0; i < _num_threads; i++)
+				_pending_sem.up();
+
+			for (unsigned i = 0; i < _num_threads; i++) {
+				_threads[i]->join();
+				_threads[i].destruct();
+			}
+		}
+
+		unsigned num_threads() const { return _num_threads; }
+
+		void submit(Io_job &job)
+		{
+			{
+				Genode::Mutex::Guard guard(_mutex);
+				_pending.enqueue(job);
+			}
+			_pending_sem.up();
+		}
+
+		/**
+		 * Hand completed jobs back to their owners
+		 */
+		void process_completions()
+		{
+			/*
+			 * Dequeue one job at a time because the owner may submit new
+			 * jobs or process completions itself.
+			 */
+			for (;;) {
+
+				Io_job *job_ptr = nullptr;
+				{
+					Genode::Mutex::Guard guard(_mutex);
+					_completed.dequeue([&] (Io_job &job) { job_ptr = &job; });
+				}
+
+				if (!job_ptr)
+					return;
+
+				job_ptr->owner.io_completed(*job_ptr);
+			}
+		}
+
+		/**
+		 * Block until at least one job got completed and process it
+		 */
+		void wait_for_completion()
+		{
+			bool block = false;
+			{
+				Genode::Mutex::Guard guard(_mutex);
+				if (_completed.empty())
+					block = _waiting = true;
+			}
+
+			if (block)
+				_blockade.block();
+
+			process_completions();
+		}
+};
+
+#endif /* _IO_POOL_H_ */
@@ -28,6 +28,7 @@
 
 /* local includes */
 #include "directory.h"
+#include "io_pool.h"
 #include "notifier.h"
 #include "open_node.h"
 #include "watch.h"
@@ -91,13 +92,37 @@ class Lx_fs::Session_resources
 
 class Lx_fs::Session_component : private Session_resources,
                                  public Session_rpc_object,
-                                 private Watch_node::Response_handler
+                                 private Watch_node::Response_handler,
+                                 private Io_job::Owner
 {
 	private:
 
+		/*
+		 * Noncopyable
+		 */
+		Session_component(Session_component const &);
+		Session_component &operator = (Session_component const &);
+
 		using Open_node      = File_system::Open_node<Node>;
 		using Signal_handler = Genode::Signal_handler<Session_component>;
 
+		/*
+		 * Packet that is processed by an I/O thread or waits for the
+		 * completion of a preceding packet of the same node
+		 */
+		struct Packet_job : Io_job
+		{
+			Open_node         &open_node;
+			Packet_descriptor  packet;
+
+			Genode::Fifo_element<Packet_job> queue_elem { *this };
+
+			Packet_job(Owner &owner, Open_node &open_node, Packet_descriptor packet)
+			:
+				Io_job(owner, open_node.node()), open_node(open_node), packet(packet)
+			{ }
+		};
+
 		Genode::Env                 &_env;
 		Directory                   &_root;
 		Id_space<File_system::Node>  _open_node_registry { };
@@ -105,6 +130,23 @@ class Lx_fs::Session_component : private Session_resources,
 		Absolute_path const          _root_dir;
 		Signal_handler               _process_packet_dispatcher;
 		Notifier                    &_notifier;
+		Io_pool                     *_io_pool;
+
+		/*
+		 * Jobs of the deferred packets
+		 *
+		 * Acknowledgement slots are reserved for the deferred packets. So
+		 * there are never more deferred packets than slots in the
+		 * acknowledgement queue.
+		 */
+		Genode::Constructible<Packet_job> _jobs[TX_QUEUE_SIZE] { };
+
+		/*
+		 * Deferred packets in the order of their arrival
+		 */
+		Genode::Fifo<Genode::Fifo_element<Packet_job>> _deferred_jobs { };
+		unsigned                                       _num_deferred_jobs = 0;
+		bool                                           _draining = false;
 
 		/******************************
 		 ** Packet-stream processing **
@@ -186,6 +228,143 @@ class Lx_fs::Session_component : private Session_resources,
 			tx_sink()->acknowledge_packet(packet);
 		}
 
+		bool _io_thread_applicable(Packet_descriptor const &packet, Node &node)
+		{
+			bool const read_or_write = packet.operation() == Packet_descriptor::READ
+			                        || packet.operation() == Packet_descriptor::WRITE;
+
+			return _io_pool && read_or_write && node.io_thread_safe()
+			    && tx_sink()->packet_valid(packet)
+			    && (packet.length() <= packet.size());
+		}
+
+		void _defer_packet(Packet_descriptor packet, Open_node &open_node)
+		{
+			Genode::Constructible<Packet_job> *slot = nullptr;
+			for (unsigned i = 0; i < TX_QUEUE_SIZE && !slot; i++)
+				if (!_jobs[i].constructed())
+					slot = &_jobs[i];
+
+			/* cannot happen because '_process_packets' checks the limit */
+			if (!slot) {
+				Genode::error("no job for deferred packet");
+				tx_sink()->acknowledge_packet(packet);
+				return;
+			}
+
+			Io_job::Owner &owner = *this;
+			slot->construct(owner, open_node, packet);
+			Packet_job &job = **slot;
+
+			_deferred_jobs.enqueue(job.queue_elem);
+			_num_deferred_jobs++;
+
+			Node &node = open_node.node();
+			node.deferred_packets(node.deferred_packets() + 1);
+
+			if (node.deferred_packets() == 1)
+				_process_deferred_packets(node);
+		}
+
+		void _remove_deferred(Packet_job &job)
+		{
+			_deferred_jobs.remove(job.queue_elem);
+			_num_deferred_jobs--;
+
+			job.node.deferred_packets(job.node.deferred_packets() - 1);
+
+			for (unsigned i = 0; i < TX_QUEUE_SIZE; i++)
+				if (_jobs[i].constructed() && &*_jobs[i] == &job)
+					_jobs[i].destruct();
+		}
+
+		/**
+		 * Process the deferred packets of a node with no packet in flight
+		 *
+		 * Packets that are not applicable for an I/O thread are processed
+		 * immediately until a packet is handed over to an I/O thread.
+		 */
+		void _process_deferred_packets(Node &node)
+		{
+			for (;;) {
+
+				Packet_job *job_ptr = nullptr;
+				_deferred_jobs.for_each([&] (Genode::Fifo_element<Packet_job> &elem) {
+					if (!job_ptr && &elem.object().node == &node)
+						job_ptr = &elem.object(); });
+
+				if (!job_ptr)
+					return;
+
+				Packet_job &job = *job_ptr;
+
+				if (_io_thread_applicable(job.packet, node)) {
+
+					bool const write = (job.packet.operation() == Packet_descriptor::WRITE);
+
+					job.op       = write ? Io_job::Op::WRITE : Io_job::Op::READ;
+					job.buffer   = tx_sink()->packet_content(job.packet);
+					job.length   = job.packet.length();
+					job.position = job.packet.position();
+
+					_io_pool->submit(job);
+					return;
+				}
+
+				Packet_descriptor packet   = job.packet;
+				Open_node        &open_node = job.open_node;
+
+				_remove_deferred(job);
+				_process_packet_op(packet, open_node);
+			}
+		}
+
+		/**
+		 * Io_job::Owner interface
+		 */
+		void io_completed(Io_job &io_job) override
+		{
+			Packet_job &job = static_cast<Packet_job &>(io_job);
+
+			Node              &node       = job.node;
+			Packet_descriptor  packet     = job.packet;
+			size_t const       res_length = job.result;
+
+			_remove_deferred(job);
+
+			/* result semantics as implemented by '_process_packet_op' */
+			bool ack       = true;
+			bool succeeded = false;
+
+			if (packet.operation() == Packet_descriptor::READ) {
+				succeeded = res_length || (packet.position() >= node.status().size);
+			} else {
+				/* File system session can't handle partial writes */
+				ack       = (res_length == packet.length());
+				succeeded = true;
+			}
+
+			if (ack) {
+				packet.length(res_length);
+				packet.succeeded(succeeded);
+				tx_sink()->acknowledge_packet(packet);
+			}
+
+			_process_deferred_packets(node);
+
+			if (!_draining)
+				_process_packets();
+		}
+
+		/**
+		 * Wait until no packet of the node is deferred
+		 */
+		void _drain(Node &node)
+		{
+			while (node.deferred_packets())
+				_io_pool->wait_for_completion();
+		}
+
 		void _process_packet()
 		{
 			Packet_descriptor packet = tx_sink()->get_packet();
@@ -194,6 +373,14 @@ class Lx_fs::Session_component : private Session_resources,
 			packet.succeeded(false);
 
 			auto process_packet_fn = [&] (Open_node &open_node) {
+
+				/* preserve the order of packets per node */
+				Node &node = open_node.node();
+				if (node.deferred_packets() || _io_thread_applicable(packet, node)) {
+					_defer_packet(packet, open_node);
+					return;
+				}
+
 				_process_packet_op(packet, open_node);
 			};
 
@@ -224,8 +411,13 @@ class Lx_fs::Session_component : private Session_resources,
 				 * in '_process_packet' would infinitely block the context
 				 * of the main thread. The main thread is however needed
 				 * for receiving any subsequent 'ready-to-ack' signals.
+				 *
+				 * Acknowledgement slots are reserved for the deferred
+				 * packets. Once all jobs are in use, further packets stay
+				 * in the submit queue.
 				 */
-				if (!tx_sink()->ready_to_ack())
+				if (tx_sink()->ack_slots_free() <= _num_deferred_jobs
+				 || _num_deferred_jobs == TX_QUEUE_SIZE)
 					return;
 
 				_process_packet();
@@ -264,7 +456,8 @@ class Lx_fs::Session_component : private Session_resources,
 		                  size_t               tx_buf_size,
 		                  char const          *root_dir,
 		                  bool                 writable,
-		                  Notifier            &notifier)
+		                  Notifier            &notifier,
+		                  Io_pool             *io_pool)
 		:
 			Session_resources { env.pd(), env.rm(), ram_quota, cap_quota, tx_buf_size },
 			Session_rpc_object {_packet_ds.cap(), env.rm(), env.ep().rpc_ep() },
@@ -273,7 +466,8 @@ class Lx_fs::Session_component : private Session_resources,
 			_writable { writable },
 			_root_dir { root_dir },
 			_process_packet_dispatcher { env.ep(), *this, &Session_component::_process_packets },
-			_notifier { notifier }
+			_notifier { notifier },
+			_io_pool { io_pool }
 		{
 			/*
 			 * Register '_process_packets' dispatch function as signal
@@ -288,6 +482,11 @@ class Lx_fs::Session_component : private Session_resources,
 		 */
 		~Session_component()
 		{
+			/* the I/O threads must not access the nodes afterwards */
+			_draining = true;
+			while (_num_deferred_jobs)
+				_io_pool->wait_for_completion();
+
 			List<List_element<Open_node>> node_list;
 
 			auto collect_fn = [&node_list, this] (Open_node &open_node) {
@@ -422,6 +621,7 @@ class Lx_fs::Session_component : private Session_resources,
 		{
 			auto close_fn = [&] (Open_node &open_node) {
 				Node &node = open_node.node();
+				_drain(node);
 				destroy(_alloc, &open_node);
 				destroy(_alloc, &node);
 			};
@@ -557,6 +757,11 @@ class Lx_fs::Root : public Root_component<Session_component>
 		Genode::Attached_rom_dataspace  _config   { _env, "config" };
 		Notifier                        _notifier { _env };
 
+		unsigned const _num_io_threads =
+			_config.xml().attribute_value("io_threads", 0U);
+
+		Genode::Constructible<Io_pool> _io_pool { };
+
 		static inline bool writeable_from_args(char const *args)
 		{
 			return { Arg_string::find_arg(args, "writeable").bool_value(true) };
@@ -640,7 +845,8 @@ class Lx_fs::Root : public Root_component<Session_component>
 				                           Genode::Cap_quota { cap_quota },
 				                           tx_buf_size,
 				                           absolute_root_dir(root_dir).string(),
-				                           writeable, _notifier };
+				                           writeable, _notifier,
+				                           _io_pool.constructed() ? &*_io_pool : nullptr };
 
 				auto ram_used { _env.pd().used_ram().value - initial_ram_usage };
 				auto cap_used { _env.pd().used_caps().value - initial_cap_usage };
@@ -693,7 +899,10 @@ class Lx_fs::Root : public Root_component<Session_component>
 		:
 			Root_component<Session_component>(&env.ep().rpc_ep(), &md_alloc),
 			_env(env)
-		{ }
+		{
+			if (_num_io_threads)
+				_io_pool.construct(_env, _num_io_threads);
+		}
 };
 
 
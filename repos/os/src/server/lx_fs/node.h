@@ -47,6 +47,12 @@ class Lx_fs::Node : public File_system::Node_base
 		Name                _name;
 		unsigned long const _inode;
 
+		/*
+		 * Number of packets of the node that are processed by an I/O thread
+		 * or wait for the completion of such a packet
+		 */
+		unsigned _deferred_packets = 0;
+
 	public:
 
 		Node(unsigned long inode)
@@ -63,6 +69,15 @@ class Lx_fs::Node : public File_system::Node_base
 		 */
 		void name(char const *name) { Genode::copy_cstring(_name, name, sizeof(_name)); }
 
+		unsigned deferred_packets() const { return _deferred_packets; }
+
+		void deferred_packets(unsigned n) { _deferred_packets = n; }
+
+		/**
+		 * Return true if 'read' and 'write' may be executed by an I/O thread
+		 */
+		virtual bool io_thread_safe() const { return false; }
+
 		virtual void update_modification_time(Timestamp const) = 0;
 
 		virtual size_t read(char *dst, size_t len, seek_off_t) = 0;
@@ -76,8 +76,7 @@ void Nic_loopback::Session_component::_handle_packet_stream()
 	for (;;) {
 
 		/* flush acknowledgements for the echoes packets */
-		while (_rx.source()->ack_avail())
-			_rx.source()->release_packet(_rx.source()->get_acked_packet());
+		_release_acked_rx_packets();
 
 		/*
 		 * If the client cannot accept new acknowledgements for a sent packets,
@@ -37,15 +37,15 @@ bool Arp_cache_entry::_higher(Ipv4_address const &ip) const
 }
 
 
-Arp_cache_entry const &
+Arp_cache_entry const *
 Arp_cache_entry::find_by_ip(Ipv4_address const &ip) const
 {
 	if (ip == _ip) {
-		return *this; }
+		return this; }
 
 	Arp_cache_entry const *const entry = child(_higher(ip));
 	if (!entry) {
-		throw Arp_cache::No_match(); }
+		return nullptr; }
 
 	return entry->find_by_ip(ip);
 }
@@ -79,10 +79,10 @@ void Arp_cache::new_entry(Ipv4_address const &ip, Mac_address const &mac)
 }
 
 
-Arp_cache_entry const &Arp_cache::find_by_ip(Ipv4_address const &ip) const
+Arp_cache_entry const *Arp_cache::find_by_ip(Ipv4_address const &ip) const
 {
 	if (!first()) {
-		throw No_match(); }
+		return nullptr; }
 
 	return first()->find_by_ip(ip);
 }
@@ -42,7 +42,7 @@ class Net::Arp_cache_entry : public Genode::Avl_node<Arp_cache_entry>
 
 		Arp_cache_entry(Ipv4_address const &ip, Mac_address const &mac);
 
-		Arp_cache_entry const &find_by_ip(Ipv4_address const &ip) const;
+		Arp_cache_entry const *find_by_ip(Ipv4_address const &ip) const;
 
 
 		/**************
@@ -83,15 +83,16 @@ class Net::Arp_cache : public Genode::Avl_tree<Arp_cache_entry>
 
 	public:
 
-		struct No_match : Genode::Exception { };
-
 		Arp_cache(Domain const &domain) : _domain(domain) { }
 
 		void new_entry(Ipv4_address const &ip, Mac_address const &mac);
 
 		void destroy_entries_with_mac(Mac_address const &mac);
 
-		Arp_cache_entry const &find_by_ip(Ipv4_address const &ip) const;
+		/**
+		 * Return entry of 'ip' or nullptr if there is none
+		 */
+		Arp_cache_entry const *find_by_ip(Ipv4_address const &ip) const;
 };
 
 #endif /* _ARP_CACHE_H_ */
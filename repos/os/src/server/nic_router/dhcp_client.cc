@@ -22,7 +22,6 @@ enum { PKT_SIZE = 1024 };
 using namespace Genode;
 using namespace Net;
 using Message_type = Dhcp_packet::Message_type;
-using Drop_packet  = Net::Interface::Drop_packet;
 using Dhcp_options = Dhcp_packet::Options_aggregator<Size_guard>;
 
 
@@ -117,7 +116,7 @@ void Dhcp_client::_handle_timeout(Duration)
 }
 
 
-void Dhcp_client::handle_dhcp_reply(Dhcp_packet &dhcp)
+Packet_result Dhcp_client::handle_dhcp_reply(Dhcp_packet &dhcp)
 {
 	try {
 		Message_type const msg_type =
@@ -127,7 +126,7 @@ void Dhcp_client::handle_dhcp_reply(Dhcp_packet &dhcp)
 		case State::SELECT:
 
 			if (msg_type != Message_type::OFFER) {
-				throw Drop_packet("DHCP client expects an offer");
+				return packet_drop("DHCP client expects an offer");
 			}
 			_set_state(State::REQUEST, _config().dhcp_request_timeout());
 			_send(Message_type::REQUEST, Ipv4_address(),
@@ -138,7 +137,7 @@ void Dhcp_client::handle_dhcp_reply(Dhcp_packet &dhcp)
 		case State::REQUEST:
 			{
 				if (msg_type != Message_type::ACK) {
-					throw Drop_packet("DHCP client expects an acknowledgement");
+					return packet_drop("DHCP client expects an acknowledgement");
 				}
 				_lease_time_sec = dhcp.option<Dhcp_packet::Ip_lease_time>().value();
 				_set_state(State::BOUND, _rerequest_timeout(1));
@@ -149,17 +148,18 @@ void Dhcp_client::handle_dhcp_reply(Dhcp_packet &dhcp)
 		case State::REBIND:
 
 			if (msg_type != Message_type::ACK) {
-				throw Drop_packet("DHCP client expects an acknowledgement");
+				return packet_drop("DHCP client expects an acknowledgement");
 			}
 			_set_state(State::BOUND, _rerequest_timeout(1));
 			_lease_time_sec = dhcp.option<Dhcp_packet::Ip_lease_time>().value();
 			break;
 
-		default: throw Drop_packet("DHCP client doesn't expect a packet");
+		default: return packet_drop("DHCP client doesn't expect a packet");
 		}
+		return packet_handled();
 	}
 	catch (Dhcp_packet::Option_not_found) {
-		throw Drop_packet("DHCP reply misses required option");
+		return packet_drop("DHCP reply misses required option");
 	}
 }
 
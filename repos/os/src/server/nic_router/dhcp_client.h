@@ -18,6 +18,9 @@
 #include <timer_session/connection.h>
 #include <net/dhcp.h>
 
+/* local includes */
+#include <packet_result.h>
+
 namespace Net {
 
 	class Domain;
@@ -63,7 +66,7 @@ class Net::Dhcp_client
 		Dhcp_client(Timer::Connection &timer,
 		            Interface         &interface);
 
-		void handle_dhcp_reply(Dhcp_packet &dhcp);
+		Packet_result handle_dhcp_reply(Dhcp_packet &dhcp);
 
 		void discover();
 };
@@ -17,6 +17,7 @@
 /* local includes */
 #include <ipv4_address_prefix.h>
 #include <list.h>
+#include <prefix_trie.h>
 
 /* Genode includes */
 #include <util/list.h>
@@ -69,34 +70,59 @@ struct Net::Direct_rule : Direct_rule_base,
 
 
 template <typename T>
-struct Net::Direct_rule_list : List<T>
+class Net::Direct_rule_list : public List<T>
 {
-	using Base = List<T>;
+	private:
 
-	struct No_match : Genode::Exception { };
+		using Base = List<T>;
 
-	T const &longest_prefix_match(Ipv4_address const &ip) const
-	{
-		/* first match is sufficient as the list is prefix-size-sorted */
-		for (T const *curr = Base::first(); curr; curr = curr->next()) {
-			if (curr->dst().prefix_matches(ip)) {
-				return *curr; }
+		Prefix_trie<T> _trie { };
+
+	public:
+
+		/**
+		 * Return the rule with the longest prefix that matches 'ip' or nullptr
+		 *
+		 * Only rules that were present at the last call of 'compile' are
+		 * considered.
+		 */
+		T const *longest_prefix_match(Ipv4_address const &ip) const {
+			return _trie.longest_prefix_match(ip); }
+
+		void insert(T &rule)
+		{
+			/* ensure that the list stays prefix-size-sorted (descending) */
+			T *behind = nullptr;
+			for (T *curr = Base::first(); curr; curr = curr->next()) {
+				if (rule.dst().prefix >= curr->dst().prefix) {
+					break; }
+
+				behind = curr;
+			}
+			Base::insert(&rule, behind);
 		}
-		throw No_match();
-	}
-
-	void insert(T &rule)
-	{
-		/* ensure that the list stays prefix-size-sorted (descending) */
-		T *behind = nullptr;
-		for (T *curr = Base::first(); curr; curr = curr->next()) {
-			if (rule.dst().prefix >= curr->dst().prefix) {
-				break; }
-
-			behind = curr;
+
+		/**
+		 * Build the lookup structure from the current list of rules
+		 *
+		 * Of rules with the same prefix, the one that comes first in the
+		 * list wins, which is the rule a linear scan of the list would find.
+		 *
+		 * \throw Out_of_ram
+		 * \throw Out_of_caps
+		 */
+		void compile(Genode::Allocator &alloc)
+		{
+			_trie.destroy_each(alloc);
+			Base::for_each([&] (T const &rule) {
+				_trie.insert(alloc, rule.dst(), rule); });
+		}
+
+		void destroy_each(Genode::Deallocator &dealloc)
+		{
+			_trie.destroy_each(dealloc);
+			Base::destroy_each(dealloc);
 		}
-		Base::insert(&rule, behind);
-	}
 };
 
 #endif /* _RULE_H_ */
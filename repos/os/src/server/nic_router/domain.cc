@@ -212,7 +212,7 @@ Domain::Domain(Configuration &config, Xml_node const node, Allocator &alloc)
 }
 
 
-Link_side_tree &Domain::links(L3_protocol const protocol)
+Link_side_table &Domain::links(L3_protocol const protocol)
 {
 	switch (protocol) {
 	case L3_protocol::TCP:  return _tcp_links;
@@ -319,6 +319,11 @@ void Domain::init(Domain_tree &domains)
 		try { _ip_rules.insert(*new (_alloc) Ip_rule(domains, node)); }
 		catch (Ip_rule::Invalid) { _invalid("invalid IP rule"); }
 	});
+	/* build the lookup structures of the rules that use prefix matching */
+	_tcp_rules.compile(_alloc);
+	_udp_rules.compile(_alloc);
+	_icmp_rules.compile(_alloc);
+	_ip_rules.compile(_alloc);
 }
 
 
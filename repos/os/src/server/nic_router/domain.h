@@ -111,9 +111,9 @@ class Net::Domain : public Domain_base,
 		List<Domain>                          _ip_config_dependents { };
 		Arp_cache                             _arp_cache            { *this };
 		Arp_waiter_list                       _foreign_arp_waiters  { };
-		Link_side_tree                        _tcp_links            { };
-		Link_side_tree                        _udp_links            { };
-		Link_side_tree                        _icmp_links           { };
+		Link_side_table                       _tcp_links            { _alloc };
+		Link_side_table                       _udp_links            { _alloc };
+		Link_side_table                       _icmp_links           { _alloc };
 		Genode::size_t                        _tx_bytes             { 0 };
 		Genode::size_t                        _rx_bytes             { 0 };
 		bool                            const _verbose_packets;
@@ -182,7 +182,7 @@ class Net::Domain : public Domain_base,
 
 		void try_reuse_ip_config(Domain const &domain);
 
-		Link_side_tree &links(L3_protocol const protocol);
+		Link_side_table &links(L3_protocol const protocol);
 
 		void attach_interface(Interface &interface);
 
@@ -230,9 +230,9 @@ class Net::Domain : public Domain_base,
 		Dhcp_server                 &dhcp_server();
 		Arp_cache                   &arp_cache()                 { return _arp_cache; }
 		Arp_waiter_list             &foreign_arp_waiters()       { return _foreign_arp_waiters; }
-		Link_side_tree              &tcp_links()                 { return _tcp_links; }
-		Link_side_tree              &udp_links()                 { return _udp_links; }
-		Link_side_tree              &icmp_links()                { return _icmp_links; }
+		Link_side_table             &tcp_links()                 { return _tcp_links; }
+		Link_side_table             &udp_links()                 { return _udp_links; }
+		Link_side_table             &icmp_links()                { return _icmp_links; }
 		Domain_link_stats           &udp_stats()                 { return _udp_stats; }
 		Domain_link_stats           &tcp_stats()                 { return _tcp_stats; }
 		Domain_link_stats           &icmp_stats()                { return _icmp_stats; }
@@ -57,16 +57,16 @@ Forward_rule::Forward_rule(Domain_tree &domains, Xml_node const node)
 }
 
 
-Forward_rule const &Forward_rule::find_by_port(Port const port) const
+Forward_rule const *Forward_rule::find_by_port(Port const port) const
 {
 	if (port == _port) {
-		return *this; }
+		return this; }
 
 	Forward_rule *const rule =
 		Avl_node<Forward_rule>::child(port.value > _port.value);
 
 	if (!rule) {
-		throw Forward_rule_tree::No_match(); }
+		return nullptr; }
 
 	return rule->find_by_port(port);
 }
@@ -76,10 +76,10 @@ Forward_rule const &Forward_rule::find_by_port(Port const port) const
  ** Forward_rule_tree **
  ***********************/
 
-Forward_rule const &Forward_rule_tree::find_by_port(Port const port) const
+Forward_rule const *Forward_rule_tree::find_by_port(Port const port) const
 {
 	if (!first()) {
-		throw No_match(); }
+		return nullptr; }
 
 	return first()->find_by_port(port);
 }
@@ -54,7 +54,7 @@ class Net::Forward_rule : public Genode::Avl_node<Forward_rule>
 
 		Forward_rule(Domain_tree &domains, Genode::Xml_node const node);
 
-		Forward_rule const &find_by_port(Port const port) const;
+		Forward_rule const *find_by_port(Port const port) const;
 
 
 		/*********
@@ -84,9 +84,10 @@ class Net::Forward_rule : public Genode::Avl_node<Forward_rule>
 
 struct Net::Forward_rule_tree : Avl_tree<Forward_rule>
 {
-	struct No_match : Genode::Exception { };
-
-	Forward_rule const &find_by_port(Port const port) const;
+	/**
+	 * Return rule for 'port' or nullptr if there is none
+	 */
+	Forward_rule const *find_by_port(Port const port) const;
 };
 
 #endif /* _FORWARD_RULE_H_ */
@@ -0,0 +1,285 @@
+/*
+ * \brief  Open-addressing hash table with incremental resizing
+ * \author agent
+ * \date   2026-10-16
+ *
+ * The table stores pointers to elements that provide an 'id()' accessor.
+ * The ID type must provide a 'hash(seed)' method and an equality operator.
+ * Collisions are resolved by linear probing. When the load factor exceeds
+ * 3/4, a larger slot array is allocated and the elements of the former
+ * array are moved over by a few slots with each subsequent insertion or
+ * removal. Hence, no single operation pays for rehashing the whole table.
+ *
+ * Each table hashes with its own seed, which is taken from the timestamp
+ * counter when the table is created. The slot of an element thereby cannot
+ * be predicted from its ID alone, which prevents a remote peer from
+ * crafting IDs that all collide in the same probe chain.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _HASH_TABLE_H_
+#define _HASH_TABLE_H_
+
+/* Genode includes */
+#include <base/allocator.h>
+#include <trace/timestamp.h>
+#include <util/noncopyable.h>
+
+namespace Net {
+
+	static inline Genode::uint32_t hash_bytes(void const       *base,
+	                                          Genode::size_t    size,
+	                                          Genode::uint32_t  seed);
+
+	template <typename, typename> class Hash_table;
+}
+
+
+/**
+ * Seeded FNV-1a hash over 'size' bytes at 'base'
+ *
+ * The seed is mixed into the initial state and the result is passed
+ * through a final avalanche step so that all bits of the input and the
+ * seed affect the low bits used for indexing the slot array.
+ */
+static inline Genode::uint32_t Net::hash_bytes(void const       *base,
+                                               Genode::size_t    size,
+                                               Genode::uint32_t  seed)
+{
+	Genode::uint8_t const *byte = (Genode::uint8_t const *)base;
+	Genode::uint32_t hash = 2166136261u ^ seed;
+	for (Genode::size_t i = 0; i < size; i++) {
+		hash ^= byte[i];
+		hash *= 16777619u;
+	}
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+
+template <typename T, typename ID>
+class Net::Hash_table : Genode::Noncopyable
+{
+	private:
+
+		enum {
+			MIN_SLOTS     = 64,
+			MIGRATE_SLOTS = 8,
+		};
+
+		/* marks a slot whose element was removed, keeps probe chains intact */
+		static T *_tombstone() { return (T *)~0UL; }
+
+		struct Slots
+		{
+			T              **base     { nullptr };
+			Genode::size_t   cnt      { 0 };
+			Genode::size_t   used     { 0 };  /* elements and tombstones */
+			Genode::size_t   elements { 0 };
+
+			bool valid() const { return base != nullptr; }
+
+			Genode::size_t size() const { return cnt * sizeof(T *); }
+		};
+
+		Genode::Allocator       &_alloc;
+		Genode::uint32_t  const  _seed;
+		Slots                    _curr     { };
+		Slots                    _old      { };
+		Genode::size_t           _migrated { 0 };
+
+		static Genode::uint32_t _random_seed(void const *table)
+		{
+			Genode::uint64_t const ts = Genode::Trace::timestamp();
+			return (Genode::uint32_t)(ts ^ (ts >> 32) ^ (Genode::addr_t)table);
+		}
+
+		Genode::size_t _first_slot(Slots const &slots, ID const &id) const {
+			return id.hash(_seed) & (slots.cnt - 1); }
+
+		T **_lookup(Slots const &slots, ID const &id) const
+		{
+			if (!slots.valid()) {
+				return nullptr; }
+
+			for (Genode::size_t idx = _first_slot(slots, id), i = 0;
+			     i < slots.cnt; i++, idx = (idx + 1) & (slots.cnt - 1))
+			{
+				T *const elem = slots.base[idx];
+				if (!elem) {
+					return nullptr; }
+
+				if (elem != _tombstone() && elem->id() == id) {
+					return &slots.base[idx]; }
+			}
+			return nullptr;
+		}
+
+		/**
+		 * Return slot that holds 'elem'
+		 *
+		 * Slots of other elements with the same ID are skipped.
+		 */
+		T **_lookup_elem(Slots const &slots, T const &elem) const
+		{
+			if (!slots.valid()) {
+				return nullptr; }
+
+			for (Genode::size_t idx = _first_slot(slots, elem.id()), i = 0;
+			     i < slots.cnt; i++, idx = (idx + 1) & (slots.cnt - 1))
+			{
+				T *const slot_elem = slots.base[idx];
+				if (!slot_elem) {
+					return nullptr; }
+
+				if (slot_elem == &elem) {
+					return &slots.base[idx]; }
+			}
+			return nullptr;
+		}
+
+		/**
+		 * Store element in slot array that is known to have a free slot
+		 */
+		void _store(Slots &slots, T &elem)
+		{
+			for (Genode::size_t idx = _first_slot(slots, elem.id());;
+			     idx = (idx + 1) & (slots.cnt - 1))
+			{
+				T *&slot = slots.base[idx];
+				if (slot && slot != _tombstone()) {
+					continue; }
+
+				if (!slot) {
+					slots.used++; }
+
+				slot = &elem;
+				slots.elements++;
+				return;
+			}
+		}
+
+		void _free(Slots &slots)
+		{
+			if (slots.valid()) {
+				_alloc.free(slots.base, slots.size()); }
+
+			slots = Slots { };
+		}
+
+		/**
+		 * Move up to 'max' slots from the former into the current array
+		 */
+		void _migrate(Genode::size_t max)
+		{
+			if (!_old.valid()) {
+				return; }
+
+			for (; max && _migrated < _old.cnt; max--, _migrated++) {
+
+				T *const elem = _old.base[_migrated];
+				if (!elem || elem == _tombstone()) {
+					continue; }
+
+				_old.base[_migrated] = _tombstone();
+				_old.elements--;
+				_store(_curr, *elem);
+			}
+			if (_migrated == _old.cnt || !_old.elements) {
+				_free(_old); }
+		}
+
+		void _grow()
+		{
+			/*
+			 * The current array is sized such that it can absorb all
+			 * elements of the former array, so a migration that is still in
+			 * progress can be finished without further allocations.
+			 */
+			_migrate(~(Genode::size_t)0);
+
+			Genode::size_t cnt = MIN_SLOTS;
+			while (cnt < (_curr.elements + 1) * 4) {
+				cnt <<= 1; }
+
+			Slots slots { };
+			slots.base = (T **)_alloc.alloc(cnt * sizeof(T *));
+			slots.cnt  = cnt;
+			for (Genode::size_t idx = 0; idx < cnt; idx++) {
+				slots.base[idx] = nullptr; }
+
+			_old      = _curr;
+			_curr     = slots;
+			_migrated = 0;
+		}
+
+	public:
+
+		Hash_table(Genode::Allocator &alloc)
+		: _alloc(alloc), _seed(_random_seed(this)) { }
+
+		~Hash_table()
+		{
+			_free(_old);
+			_free(_curr);
+		}
+
+		/**
+		 * Insert element
+		 *
+		 * \throw Out_of_ram
+		 * \throw Out_of_caps
+		 */
+		void insert(T &elem)
+		{
+			_migrate(MIGRATE_SLOTS);
+
+			if ((_curr.used + _old.elements + 1) * 4 > _curr.cnt * 3) {
+				_grow(); }
+
+			_store(_curr, elem);
+		}
+
+		void remove(T &elem)
+		{
+			_migrate(MIGRATE_SLOTS);
+
+			if (T **const slot = _lookup_elem(_curr, elem)) {
+				*slot = _tombstone();
+				_curr.elements--;
+				return;
+			}
+			if (T **const slot = _lookup_elem(_old, elem)) {
+				*slot = _tombstone();
+				_old.elements--;
+			}
+		}
+
+		/**
+		 * Return element with matching ID or nullptr if there is none
+		 */
+		T *find_by_id(ID const &id) const
+		{
+			if (T **const slot = _lookup(_curr, id)) {
+				return *slot; }
+
+			if (T **const slot = _lookup(_old, id)) {
+				return *slot; }
+
+			return nullptr;
+		}
+
+		Genode::size_t count() const { return _curr.elements + _old.elements; }
+};
+
+#endif /* _HASH_TABLE_H_ */
@@ -154,27 +154,21 @@ static void _link_packet(L3_protocol  const  prot,
 }
 
 
-static void _update_checksum(L3_protocol   const prot,
-                             void         *const prot_base,
-                             size_t        const prot_size,
-                             Ipv4_address  const src,
-                             Ipv4_address  const dst,
-                             size_t        const ip_size)
+static void _update_checksum(L3_protocol                   const  prot,
+                             void                         *const  prot_base,
+                             Ipv4_packet                         &ip,
+                             Internet_checksum_diff        const &ip_icd,
+                             Internet_checksum_diff        const &prot_icd)
 {
+	ip.update_checksum(ip_icd);
+
+	/* the UDP and TCP checksum also cover the IP addresses */
+	Internet_checksum_diff l4_icd { prot_icd };
+	l4_icd.add_up_diff(ip_icd);
 	switch (prot) {
-	case L3_protocol::TCP:
-		((Tcp_packet *)prot_base)->update_checksum(src, dst, prot_size);
-		return;
-	case L3_protocol::UDP:
-		((Udp_packet *)prot_base)->update_checksum(src, dst);
-		return;
-	case L3_protocol::ICMP:
-		{
-			Icmp_packet &icmp = *(Icmp_packet *)prot_base;
-			icmp.update_checksum(ip_size - sizeof(Ipv4_packet) -
-			                               sizeof(Icmp_packet));
-			return;
-		}
+	case L3_protocol::TCP:  ((Tcp_packet *)prot_base)->update_checksum(l4_icd);    return;
+	case L3_protocol::UDP:  ((Udp_packet *)prot_base)->update_checksum(l4_icd);    return;
+	case L3_protocol::ICMP: ((Icmp_packet *)prot_base)->update_checksum(prot_icd); return;
 	default: throw Interface::Bad_transport_protocol(); }
 }
 
@@ -201,6 +195,19 @@ static void _dst_port(L3_protocol  const prot,
 }
 
 
+static void _dst_port(L3_protocol             const  prot,
+                      void                   *const  prot_base,
+                      Port                    const  port,
+                      Internet_checksum_diff        &icd)
+{
+	switch (prot) {
+	case L3_protocol::TCP:  (*(Tcp_packet *)prot_base).dst_port(port, icd);  return;
+	case L3_protocol::UDP:  (*(Udp_packet *)prot_base).dst_port(port, icd);  return;
+	case L3_protocol::ICMP: (*(Icmp_packet *)prot_base).query_id(port.value, icd); return;
+	default: throw Interface::Bad_transport_protocol(); }
+}
+
+
 static Port _src_port(L3_protocol const prot, void *const prot_base)
 {
 	switch (prot) {
@@ -223,6 +230,29 @@ static void _src_port(L3_protocol  const prot,
 }
 
 
+static void _src_port(L3_protocol             const  prot,
+                      void                   *const  prot_base,
+                      Port                    const  port,
+                      Internet_checksum_diff        &icd)
+{
+	switch (prot) {
+	case L3_protocol::TCP:  ((Tcp_packet *)prot_base)->src_port(port, icd);        return;
+	case L3_protocol::UDP:  ((Udp_packet *)prot_base)->src_port(port, icd);        return;
+	case L3_protocol::ICMP: ((Icmp_packet *)prot_base)->query_id(port.value, icd); return;
+	default: throw Interface::Bad_transport_protocol(); }
+}
+
+
+static bool _supported_transport_protocol(L3_protocol const prot)
+{
+	switch (prot) {
+	case L3_protocol::TCP:
+	case L3_protocol::UDP:
+	case L3_protocol::ICMP: return true;
+	default:                return false; }
+}
+
+
 static void *_prot_base(L3_protocol const  prot,
                         Size_guard        &size_guard,
                         Ipv4_packet       &ip)
@@ -293,27 +323,20 @@ void Interface::_destroy_link(Link &link)
 }
 
 
-void Interface::_pass_prot(Ethernet_frame       &eth,
-                           Size_guard           &size_guard,
-                           Ipv4_packet          &ip,
-                           L3_protocol    const  prot,
-                           void          *const  prot_base,
-                           size_t         const  prot_size)
+void Interface::_pass_prot(Ethernet_frame &eth,
+                           Size_guard     &size_guard)
 {
 	eth.src(_router_mac);
 	if (!_domain().use_arp()) {
 		eth.dst(_router_mac);
 	}
-	_update_checksum(prot, prot_base, prot_size, ip.src(), ip.dst(), ip.total_length());
-	_pass_ip(eth, size_guard, ip);
+	_pass_ip(eth, size_guard);
 }
 
 
 void Interface::_pass_ip(Ethernet_frame &eth,
-                         Size_guard     &size_guard,
-                         Ipv4_packet    &ip)
+                         Size_guard     &size_guard)
 {
-	ip.update_checksum();
 	send(eth, size_guard);
 }
 
@@ -549,20 +572,22 @@ Link_list &Interface::dissolved_links(L3_protocol const protocol)
 }
 
 
-void Interface::_adapt_eth(Ethernet_frame          &eth,
-                           Ipv4_address      const &dst_ip,
-                           Packet_descriptor const &pkt,
-                           Domain                  &remote_domain)
+Packet_result Interface::_adapt_eth(Ethernet_frame          &eth,
+                                    Ipv4_address      const &dst_ip,
+                                    Packet_descriptor const &pkt,
+                                    Domain                  &remote_domain)
 {
 	Ipv4_config const &remote_ip_cfg = remote_domain.ip_config();
 	if (!remote_ip_cfg.valid()) {
-		throw Drop_packet("target domain has yet no IP config");
+		return packet_drop("target domain has yet no IP config");
 	}
 	if (remote_domain.use_arp()) {
 
 		Ipv4_address const &hop_ip = remote_domain.next_hop(dst_ip);
-		try { eth.dst(remote_domain.arp_cache().find_by_ip(hop_ip).mac()); }
-		catch (Arp_cache::No_match) {
+		Arp_cache_entry const *const entry =
+			remote_domain.arp_cache().find_by_ip(hop_ip);
+
+		if (!entry) {
 			remote_domain.interfaces().for_each([&] (Interface &interface) {
 				interface._broadcast_arp_request(remote_ip_cfg.interface().address,
 				                                 hop_ip);
@@ -570,40 +595,56 @@ void Interface::_adapt_eth(Ethernet_frame          &eth,
 			try { new (_alloc) Arp_waiter { *this, remote_domain, hop_ip, pkt }; }
 			catch (Out_of_ram)  { throw Free_resources_and_retry_handle_eth(); }
 			catch (Out_of_caps) { throw Free_resources_and_retry_handle_eth(); }
-			throw Packet_postponed();
+			return packet_postponed();
 		}
-
+		eth.dst(entry->mac());
 	}
+	return packet_handled();
 }
 
 
-void Interface::_nat_link_and_pass(Ethernet_frame        &eth,
-                                   Size_guard            &size_guard,
-                                   Ipv4_packet           &ip,
-                                   L3_protocol     const  prot,
-                                   void           *const  prot_base,
-                                   size_t          const  prot_size,
-                                   Link_side_id    const &local_id,
-                                   Domain                &local_domain,
-                                   Domain                &remote_domain)
+void Interface::_nat_link_and_pass(Ethernet_frame         &eth,
+                                   Size_guard             &size_guard,
+                                   Ipv4_packet            &ip,
+                                   Internet_checksum_diff &ip_icd,
+                                   L3_protocol      const  prot,
+                                   void            *const  prot_base,
+                                   Internet_checksum_diff &prot_icd,
+                                   Link_side_id     const &local_id,
+                                   Domain                 &local_domain,
+                                   Domain                 &remote_domain)
 {
 	try {
 		Pointer<Port_allocator_guard> remote_port_alloc;
-		try {
-			Nat_rule &nat = remote_domain.nat_rules().find_by_domain(local_domain);
+		if (Nat_rule *const nat = remote_domain.nat_rules().find_by_domain(local_domain)) {
 			if(_config().verbose()) {
-				log("[", local_domain, "] using NAT rule: ", nat); }
+				log("[", local_domain, "] using NAT rule: ", *nat); }
 
-			_src_port(prot, prot_base, nat.port_alloc(prot).alloc());
-			ip.src(remote_domain.ip_config().interface().address);
-			remote_port_alloc = nat.port_alloc(prot);
+			_src_port(prot, prot_base, nat->port_alloc(prot).alloc(), prot_icd);
+			ip.src(remote_domain.ip_config().interface().address, ip_icd);
+			remote_port_alloc = nat->port_alloc(prot);
 		}
-		catch (Nat_rule_tree::No_match) { }
 		Link_side_id const remote_id = { ip.dst(), _dst_port(prot, prot_base),
 		                                 ip.src(), _src_port(prot, prot_base) };
-		_new_link(prot, local_id, remote_port_alloc, remote_domain, remote_id);
+		try { _new_link(prot, local_id, remote_port_alloc, remote_domain, remote_id); }
+		catch (Free_resources_and_retry_handle_eth) {
+
+			/*
+			 * The packet gets handled once more after freeing resources,
+			 * so hand back the NAT port and restore the header as received
+			 */
+			try { remote_port_alloc().free(remote_id.src_port); }
+			catch (Pointer<Port_allocator_guard>::Invalid) { }
+
+			ip.src(local_id.src_ip);
+			ip.dst(local_id.dst_ip);
+			_src_port(prot, prot_base, local_id.src_port);
+			_dst_port(prot, prot_base, local_id.dst_port);
+			throw;
+		}
+		_update_checksum(prot, prot_base, ip, ip_icd, prot_icd);
 		remote_domain.interfaces().for_each([&] (Interface &interface) {
-			interface._pass_prot(eth, size_guard, ip, prot, prot_base, prot_size);
+			interface._pass_prot(eth, size_guard);
 		});
 	} catch (Port_allocator_guard::Out_of_indices) {
 		switch (prot) {
@@ -730,9 +771,9 @@ void Interface::_new_dhcp_allocation(Ethernet_frame &eth,
 }
 
 
-void Interface::_handle_dhcp_request(Ethernet_frame &eth,
-                                     Dhcp_packet    &dhcp,
-                                     Domain         &local_domain)
+Packet_result Interface::_handle_dhcp_request(Ethernet_frame &eth,
+                                              Dhcp_packet    &dhcp,
+                                              Domain         &local_domain)
 {
 	try {
 		/* try to get the DHCP server config of this interface */
@@ -758,7 +799,7 @@ void Interface::_handle_dhcp_request(Ethernet_frame &eth,
 					_release_dhcp_allocation(allocation, local_domain);
 					_destroy_dhcp_allocation(allocation, local_domain);
 					_new_dhcp_allocation(eth, dhcp, dhcp_srv, local_domain);
-					return;
+					return packet_handled();
 
 				} else {
 					allocation.lifetime(_config().dhcp_offer_timeout());
@@ -766,7 +807,7 @@ void Interface::_handle_dhcp_request(Ethernet_frame &eth,
 					                 allocation.ip(),
 					                 Dhcp_packet::Message_type::OFFER,
 					                 dhcp.xid(), local_intf);
-					return;
+					return packet_handled();
 				}
 			case Dhcp_packet::Message_type::REQUEST:
 
@@ -776,7 +817,7 @@ void Interface::_handle_dhcp_request(Ethernet_frame &eth,
 					                 allocation.ip(),
 					                 Dhcp_packet::Message_type::ACK,
 					                 dhcp.xid(), local_intf);
-					return;
+					return packet_handled();
 
 				} else {
 					Dhcp_packet::Server_ipv4 &dhcp_srv_ip =
@@ -794,13 +835,13 @@ void Interface::_handle_dhcp_request(Ethernet_frame &eth,
 						                 allocation.ip(),
 						                 Dhcp_packet::Message_type::ACK,
 						                 dhcp.xid(), local_intf);
-						return;
+						return packet_handled();
 
 					} else {
 
 						_release_dhcp_allocation(allocation, local_domain);
 						_destroy_dhcp_allocation(allocation, local_domain);
-						return;
+						return packet_handled();
 					}
 				}
 			case Dhcp_packet::Message_type::INFORM:
@@ -809,19 +850,19 @@ void Interface::_handle_dhcp_request(Ethernet_frame &eth,
 				                 allocation.ip(),
 				                 Dhcp_packet::Message_type::ACK,
 				                 dhcp.xid(), local_intf);
-				return;
+				return packet_handled();
 
 			case Dhcp_packet::Message_type::DECLINE:
 			case Dhcp_packet::Message_type::RELEASE:
 
 				_release_dhcp_allocation(allocation, local_domain);
 				_destroy_dhcp_allocation(allocation, local_domain);
-				return;
+				return packet_handled();
 
-			case Dhcp_packet::Message_type::NAK:   throw Drop_packet("DHCP NAK from client");
-			case Dhcp_packet::Message_type::OFFER: throw Drop_packet("DHCP OFFER from client");
-			case Dhcp_packet::Message_type::ACK:   throw Drop_packet("DHCP ACK from client");
-			default:                               throw Drop_packet("DHCP request with broken message type");
+			case Dhcp_packet::Message_type::NAK:   return packet_drop("DHCP NAK from client");
+			case Dhcp_packet::Message_type::OFFER: return packet_drop("DHCP OFFER from client");
+			case Dhcp_packet::Message_type::ACK:   return packet_drop("DHCP ACK from client");
+			default:                               return packet_drop("DHCP request with broken message type");
 			}
 		}
 		catch (Dhcp_allocation_tree::No_match) {
@@ -830,20 +871,20 @@ void Interface::_handle_dhcp_request(Ethernet_frame &eth,
 			case Dhcp_packet::Message_type::DISCOVER:
 
 				_new_dhcp_allocation(eth, dhcp, dhcp_srv, local_domain);
-				return;
-
-			case Dhcp_packet::Message_type::REQUEST: throw Drop_packet("DHCP REQUEST from client without offered/acked IP");
-			case Dhcp_packet::Message_type::DECLINE: throw Drop_packet("DHCP DECLINE from client without offered/acked IP");
-			case Dhcp_packet::Message_type::RELEASE: throw Drop_packet("DHCP RELEASE from client without offered/acked IP");
-			case Dhcp_packet::Message_type::NAK:     throw Drop_packet("DHCP NAK from client");
-			case Dhcp_packet::Message_type::OFFER:   throw Drop_packet("DHCP OFFER from client");
-			case Dhcp_packet::Message_type::ACK:     throw Drop_packet("DHCP ACK from client");
-			default:                                 throw Drop_packet("DHCP request with broken message type");
+				return packet_handled();
+
+			case Dhcp_packet::Message_type::REQUEST: return packet_drop("DHCP REQUEST from client without offered/acked IP");
+			case Dhcp_packet::Message_type::DECLINE: return packet_drop("DHCP DECLINE from client without offered/acked IP");
+			case Dhcp_packet::Message_type::RELEASE: return packet_drop("DHCP RELEASE from client without offered/acked IP");
+			case Dhcp_packet::Message_type::NAK:     return packet_drop("DHCP NAK from client");
+			case Dhcp_packet::Message_type::OFFER:   return packet_drop("DHCP OFFER from client");
+			case Dhcp_packet::Message_type::ACK:     return packet_drop("DHCP ACK from client");
+			default:                                 return packet_drop("DHCP request with broken message type");
 			}
 		}
 	}
 	catch (Dhcp_packet::Option_not_found exception) {
-		throw Drop_packet("DHCP request misses required option"); }
+		return packet_drop("DHCP request misses required option"); }
 }
 
 
@@ -965,141 +1006,166 @@ void Interface::_send_icmp_echo_reply(Ethernet_frame &eth,
 }
 
 
-void Interface::_handle_icmp_query(Ethernet_frame          &eth,
-                                   Size_guard              &size_guard,
-                                   Ipv4_packet             &ip,
-                                   Packet_descriptor const &pkt,
-                                   L3_protocol              prot,
-                                   void                    *prot_base,
-                                   size_t                   prot_size,
-                                   Domain                  &local_domain)
+Packet_result Interface::_handle_icmp_query(Ethernet_frame          &eth,
+                                            Size_guard              &size_guard,
+                                            Ipv4_packet             &ip,
+                                            Packet_descriptor const &pkt,
+                                            L3_protocol              prot,
+                                            void                    *prot_base,
+                                            Domain                  &local_domain)
 {
 	Link_side_id const local_id = { ip.src(), _src_port(prot, prot_base),
 	                                ip.dst(), _dst_port(prot, prot_base) };
 
 	/* try to route via existing ICMP links */
-	try {
-		Link_side const &local_side = local_domain.links(prot).find_by_id(local_id);
-		Link &link = local_side.link();
-		bool const client = local_side.is_client();
+	if (Link_side const *const local_side =
+	    local_domain.links(prot).find_by_id(local_id))
+	{
+		Link &link = local_side->link();
+		bool const client = local_side->is_client();
 		Link_side &remote_side = client ? link.server() : link.client();
 		Domain &remote_domain = remote_side.domain();
 		if (_config().verbose()) {
 			log("[", local_domain, "] using ", l3_protocol_name(prot),
 			    " link: ", link);
 		}
-		_adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
-		ip.src(remote_side.dst_ip());
-		ip.dst(remote_side.src_ip());
-		_src_port(prot, prot_base, remote_side.dst_port());
-		_dst_port(prot, prot_base, remote_side.src_port());
+		Packet_result const result =
+			_adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
+
+		if (!result.handled()) {
+			return result; }
+
+		Internet_checksum_diff ip_icd { };
+		Internet_checksum_diff prot_icd { };
+		ip.src(remote_side.dst_ip(), ip_icd);
+		ip.dst(remote_side.src_ip(), ip_icd);
+		_src_port(prot, prot_base, remote_side.dst_port(), prot_icd);
+		_dst_port(prot, prot_base, remote_side.src_port(), prot_icd);
+		_update_checksum(prot, prot_base, ip, ip_icd, prot_icd);
 
 		remote_domain.interfaces().for_each([&] (Interface &interface) {
-			interface._pass_prot(eth, size_guard, ip, prot, prot_base, prot_size);
+			interface._pass_prot(eth, size_guard);
 		});
 		_link_packet(prot, prot_base, link, client);
-		return;
+		return packet_handled();
 	}
-	catch (Link_side_tree::No_match) { }
 
 	/* try to route via ICMP rules */
-	try {
-		Ip_rule const &rule =
-			local_domain.icmp_rules().longest_prefix_match(ip.dst());
-
+	if (Ip_rule const *const rule =
+	    local_domain.icmp_rules().longest_prefix_match(ip.dst()))
+	{
 		if(_config().verbose()) {
-			log("[", local_domain, "] using ICMP rule: ", rule); }
+			log("[", local_domain, "] using ICMP rule: ", *rule); }
+
+		Domain &remote_domain = rule->domain();
+		Packet_result const result =
+			_adapt_eth(eth, local_id.dst_ip, pkt, remote_domain);
 
-		Domain &remote_domain = rule.domain();
-		_adapt_eth(eth, local_id.dst_ip, pkt, remote_domain);
-		_nat_link_and_pass(eth, size_guard, ip, prot, prot_base, prot_size,
-		                   local_id, local_domain, remote_domain);
+		if (!result.handled()) {
+			return result; }
 
-		return;
-	}
-	catch (Ip_rule_list::No_match) { }
+		Internet_checksum_diff ip_icd { };
+		Internet_checksum_diff prot_icd { };
+		_nat_link_and_pass(eth, size_guard, ip, ip_icd, prot, prot_base,
+		                   prot_icd, local_id, local_domain, remote_domain);
 
-	throw Bad_transport_protocol();
+		return packet_handled();
+	}
+	/* leave the packet up to the IP rules */
+	return packet_unhandled();
 }
 
 
-void Interface::_handle_icmp_error(Ethernet_frame          &eth,
-                                   Size_guard              &size_guard,
-                                   Ipv4_packet             &ip,
-                                   Packet_descriptor const &pkt,
-                                   Domain                  &local_domain,
-                                   Icmp_packet             &icmp,
-                                   size_t                   icmp_sz)
+Packet_result Interface::_handle_icmp_error(Ethernet_frame          &eth,
+                                            Size_guard              &size_guard,
+                                            Ipv4_packet             &ip,
+                                            Packet_descriptor const &pkt,
+                                            Domain                  &local_domain,
+                                            Icmp_packet             &icmp,
+                                            size_t                   icmp_sz)
 {
 	/* drop packet if embedded IP checksum invalid */
 	Ipv4_packet &embed_ip = icmp.data<Ipv4_packet>(size_guard);
 	if (embed_ip.checksum_error()) {
-		throw Drop_packet("bad checksum in IP packet embedded in ICMP error");
+		return packet_drop("bad checksum in IP packet embedded in ICMP error");
 	}
 	/* get link identity of the embeddeded transport packet */
-	L3_protocol  const embed_prot      = embed_ip.protocol();
+	L3_protocol const embed_prot = embed_ip.protocol();
+	if (!_supported_transport_protocol(embed_prot)) {
+
+		/* leave the packet up to the IP rules */
+		return packet_unhandled();
+	}
 	void        *const embed_prot_base = _prot_base(embed_prot, size_guard, embed_ip);
 	Link_side_id const local_id = { embed_ip.dst(), _dst_port(embed_prot, embed_prot_base),
 	                                embed_ip.src(), _src_port(embed_prot, embed_prot_base) };
-	try {
-		/* lookup a link state that matches the embedded transport packet */
-		Link_side const &local_side = local_domain.links(embed_prot).find_by_id(local_id);
-		Link &link = local_side.link();
-		bool const client = local_side.is_client();
-		Link_side &remote_side = client ? link.server() : link.client();
-		Domain &remote_domain = remote_side.domain();
 
-		/* print out that the link is used */
-		if (_config().verbose()) {
-			log("[", local_domain, "] using ", l3_protocol_name(embed_prot),
-			    " link: ", link);
-		}
-		/* adapt source and destination of Ethernet frame and IP packet */
-		_adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
-		if (remote_side.dst_ip() == remote_domain.ip_config().interface().address) {
-			ip.src(remote_side.dst_ip());
-		}
-		ip.dst(remote_side.src_ip());
+	/* lookup a link state that matches the embedded transport packet */
+	Link_side const *const local_side =
+		local_domain.links(embed_prot).find_by_id(local_id);
 
-		/* adapt source and destination of embedded IP and transport packet */
-		embed_ip.src(remote_side.src_ip());
-		embed_ip.dst(remote_side.dst_ip());
-		_src_port(embed_prot, embed_prot_base, remote_side.src_port());
-		_dst_port(embed_prot, embed_prot_base, remote_side.dst_port());
+	/* drop packet if there is no matching link */
+	if (!local_side) {
+		return packet_drop("no link that matches packet embedded in ICMP error"); }
 
-		/* update checksum of both IP headers and the ICMP header */
-		embed_ip.update_checksum();
-		icmp.update_checksum(icmp_sz - sizeof(Icmp_packet));
-		ip.update_checksum();
+	Link &link = local_side->link();
+	bool const client = local_side->is_client();
+	Link_side &remote_side = client ? link.server() : link.client();
+	Domain &remote_domain = remote_side.domain();
 
-		/* send adapted packet to all interfaces of remote domain */
-		remote_domain.interfaces().for_each([&] (Interface &interface) {
-			interface.send(eth, size_guard);
-		});
-		/* refresh link only if the error is not about an ICMP query */
-		if (embed_prot != L3_protocol::ICMP) {
-			_link_packet(embed_prot, embed_prot_base, link, client); }
+	/* print out that the link is used */
+	if (_config().verbose()) {
+		log("[", local_domain, "] using ", l3_protocol_name(embed_prot),
+		    " link: ", link);
 	}
-	/* drop packet if there is no matching link */
-	catch (Link_side_tree::No_match) {
-		throw Drop_packet("no link that matches packet embedded in ICMP error"); }
+	/* adapt source and destination of Ethernet frame and IP packet */
+	Packet_result const result =
+		_adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
+
+	if (!result.handled()) {
+		return result; }
+
+	if (remote_side.dst_ip() == remote_domain.ip_config().interface().address) {
+		ip.src(remote_side.dst_ip());
+	}
+	ip.dst(remote_side.src_ip());
+
+	/* adapt source and destination of embedded IP and transport packet */
+	embed_ip.src(remote_side.src_ip());
+	embed_ip.dst(remote_side.dst_ip());
+	_src_port(embed_prot, embed_prot_base, remote_side.src_port());
+	_dst_port(embed_prot, embed_prot_base, remote_side.dst_port());
+
+	/* update checksum of both IP headers and the ICMP header */
+	embed_ip.update_checksum();
+	icmp.update_checksum(icmp_sz - sizeof(Icmp_packet));
+	ip.update_checksum();
+
+	/* send adapted packet to all interfaces of remote domain */
+	remote_domain.interfaces().for_each([&] (Interface &interface) {
+		interface.send(eth, size_guard);
+	});
+	/* refresh link only if the error is not about an ICMP query */
+	if (embed_prot != L3_protocol::ICMP) {
+		_link_packet(embed_prot, embed_prot_base, link, client); }
+	return packet_handled();
 }
 
 
-void Interface::_handle_icmp(Ethernet_frame            &eth,
-                             Size_guard                &size_guard,
-                             Ipv4_packet               &ip,
-                             Packet_descriptor   const &pkt,
-                             L3_protocol                prot,
-                             void                      *prot_base,
-                             size_t                     prot_size,
-                             Domain                    &local_domain,
-                             Ipv4_address_prefix const &local_intf)
+Packet_result Interface::_handle_icmp(Ethernet_frame            &eth,
+                                      Size_guard                &size_guard,
+                                      Ipv4_packet               &ip,
+                                      Packet_descriptor   const &pkt,
+                                      L3_protocol                prot,
+                                      void                      *prot_base,
+                                      size_t                     prot_size,
+                                      Domain                    &local_domain,
+                                      Ipv4_address_prefix const &local_intf)
 {
 	/* drop packet if ICMP checksum is invalid */
 	Icmp_packet &icmp = *reinterpret_cast<Icmp_packet *>(prot_base);
 	if (icmp.checksum_error(size_guard.unconsumed())) {
-		throw Drop_packet("bad ICMP checksum"); }
+		return packet_drop("bad ICMP checksum"); }
 
 	/* try to act as ICMP Echo server */
 	if (icmp.type() == Icmp_packet::Type::ECHO_REQUEST &&
@@ -1110,21 +1176,123 @@ void Interface::_handle_icmp(Ethernet_frame            &eth,
 			log("[", local_domain, "] act as ICMP Echo server"); }
 
 		_send_icmp_echo_reply(eth, ip, icmp, prot_size, size_guard);
-		return;
+		return packet_handled();
 	}
 	/* try to act as ICMP router */
 	switch (icmp.type()) {
 	case Icmp_packet::Type::ECHO_REPLY:
-	case Icmp_packet::Type::ECHO_REQUEST:    _handle_icmp_query(eth, size_guard, ip, pkt, prot, prot_base, prot_size, local_domain); break;
-	case Icmp_packet::Type::DST_UNREACHABLE: _handle_icmp_error(eth, size_guard, ip, pkt, local_domain, icmp, prot_size); break;
-	default: Drop_packet("unhandled type in ICMP"); }
+	case Icmp_packet::Type::ECHO_REQUEST:    return _handle_icmp_query(eth, size_guard, ip, pkt, prot, prot_base, local_domain);
+	case Icmp_packet::Type::DST_UNREACHABLE: return _handle_icmp_error(eth, size_guard, ip, pkt, local_domain, icmp, prot_size);
+	default:                                 return packet_drop("unhandled type in ICMP"); }
 }
 
 
-void Interface::_handle_ip(Ethernet_frame          &eth,
-                           Size_guard              &size_guard,
-                           Packet_descriptor const &pkt,
-                           Domain                  &local_domain)
+Packet_result Interface::_handle_udp_tcp(Ethernet_frame            &eth,
+                                         Size_guard                &size_guard,
+                                         Ipv4_packet               &ip,
+                                         Packet_descriptor   const &pkt,
+                                         L3_protocol                prot,
+                                         void                      *prot_base,
+                                         Domain                    &local_domain,
+                                         Ipv4_address_prefix const &local_intf)
+{
+	Link_side_id const local_id = { ip.src(), _src_port(prot, prot_base),
+	                                ip.dst(), _dst_port(prot, prot_base) };
+
+	/* try to route via existing UDP/TCP links */
+	if (Link_side const *const local_side =
+	    local_domain.links(prot).find_by_id(local_id))
+	{
+		Link &link = local_side->link();
+		bool const client = local_side->is_client();
+		Link_side &remote_side = client ? link.server() : link.client();
+		Domain &remote_domain = remote_side.domain();
+		if (_config().verbose()) {
+			log("[", local_domain, "] using ", l3_protocol_name(prot),
+			    " link: ", link);
+		}
+		Packet_result const result =
+			_adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
+
+		if (!result.handled()) {
+			return result; }
+
+		Internet_checksum_diff ip_icd { };
+		Internet_checksum_diff prot_icd { };
+		ip.src(remote_side.dst_ip(), ip_icd);
+		ip.dst(remote_side.src_ip(), ip_icd);
+		_src_port(prot, prot_base, remote_side.dst_port(), prot_icd);
+		_dst_port(prot, prot_base, remote_side.src_port(), prot_icd);
+		_update_checksum(prot, prot_base, ip, ip_icd, prot_icd);
+
+		remote_domain.interfaces().for_each([&] (Interface &interface) {
+			interface._pass_prot(eth, size_guard);
+		});
+		_link_packet(prot, prot_base, link, client);
+		return packet_handled();
+	}
+
+	/* try to route via forward rules */
+	if (local_id.dst_ip == local_intf.address) {
+		if (Forward_rule const *const rule =
+		    _forward_rules(local_domain, prot).find_by_port(local_id.dst_port))
+		{
+			if(_config().verbose()) {
+				log("[", local_domain, "] using forward rule: ",
+				    l3_protocol_name(prot), " ", *rule);
+			}
+			Domain &remote_domain = rule->domain();
+			Packet_result const result =
+				_adapt_eth(eth, rule->to_ip(), pkt, remote_domain);
+
+			if (!result.handled()) {
+				return result; }
+
+			Internet_checksum_diff ip_icd { };
+			Internet_checksum_diff prot_icd { };
+			ip.dst(rule->to_ip(), ip_icd);
+			if (!(rule->to_port() == Port(0))) {
+				_dst_port(prot, prot_base, rule->to_port(), prot_icd);
+			}
+			_nat_link_and_pass(eth, size_guard, ip, ip_icd, prot, prot_base,
+			                   prot_icd, local_id, local_domain, remote_domain);
+			return packet_handled();
+		}
+	}
+	/* try to route via transport and permit rules */
+	if (Transport_rule const *const transport_rule =
+	    _transport_rules(local_domain, prot).longest_prefix_match(local_id.dst_ip))
+	{
+		if (Permit_rule const *const permit_rule =
+		    transport_rule->permit_rule(local_id.dst_port))
+		{
+			if(_config().verbose()) {
+				log("[", local_domain, "] using ", l3_protocol_name(prot),
+				    " rule: ", *transport_rule, " ", *permit_rule);
+			}
+			Domain &remote_domain = permit_rule->domain();
+			Packet_result const result =
+				_adapt_eth(eth, local_id.dst_ip, pkt, remote_domain);
+
+			if (!result.handled()) {
+				return result; }
+
+			Internet_checksum_diff ip_icd { };
+			Internet_checksum_diff prot_icd { };
+			_nat_link_and_pass(eth, size_guard, ip, ip_icd, prot, prot_base,
+			                   prot_icd, local_id, local_domain, remote_domain);
+			return packet_handled();
+		}
+	}
+	/* leave the packet up to the IP rules */
+	return packet_unhandled();
+}
+
+
+Packet_result Interface::_handle_ip(Ethernet_frame          &eth,
+                                    Size_guard              &size_guard,
+                                    Packet_descriptor const &pkt,
+                                    Domain                  &local_domain)
 {
 	/* drop fragmented IPv4 as it isn't supported */
 	Ipv4_packet &ip = eth.data<Ipv4_packet>(size_guard);
@@ -1137,7 +1305,7 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 			_send_icmp_dst_unreachable(
 				local_intf, eth, ip, _config().icmp_type_3_code_on_fragm_ipv4());
 		}
-		throw Drop_packet("fragmented IPv4 not supported");
+		return packet_drop("fragmented IPv4 not supported");
 	}
 	/* try handling subnet-local IP packets */
 	if (local_intf.prefix_matches(ip.dst()) &&
@@ -1148,14 +1316,15 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 		 * the router. Thus, forward it to all other interfaces of the domain.
 		 */
 		_domain_broadcast(eth, size_guard, local_domain);
-		return;
+		return packet_handled();
 	}
 
 	/* try to route via transport layer rules */
-	try {
-		L3_protocol  const prot      = ip.protocol();
-		size_t       const prot_size = size_guard.unconsumed();
-		void        *const prot_base = _prot_base(prot, size_guard, ip);
+	L3_protocol const prot = ip.protocol();
+	if (_supported_transport_protocol(prot)) {
+
+		size_t  const prot_size = size_guard.unconsumed();
+		void   *const prot_base = _prot_base(prot, size_guard, ip);
 
 		/* try handling DHCP requests before trying any routing */
 		if (prot == L3_protocol::UDP) {
@@ -1168,136 +1337,70 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 				switch (dhcp.op()) {
 				case Dhcp_packet::REQUEST:
 
-					try { _handle_dhcp_request(eth, dhcp, local_domain); }
+					try { return _handle_dhcp_request(eth, dhcp, local_domain); }
 					catch (Pointer<Dhcp_server>::Invalid) {
-						throw Drop_packet("DHCP request while DHCP server inactive");
+						return packet_drop("DHCP request while DHCP server inactive");
 					}
-					return;
 
 				case Dhcp_packet::REPLY:
 
 					if (eth.dst() != router_mac() &&
 					    eth.dst() != Mac_address(0xff))
 					{
-						throw Drop_packet("Ethernet of DHCP reply doesn't target router"); }
+						return packet_drop("Ethernet of DHCP reply doesn't target router"); }
 
 					if (dhcp.client_mac() != router_mac()) {
-						throw Drop_packet("DHCP reply doesn't target router"); }
+						return packet_drop("DHCP reply doesn't target router"); }
 
 					if (!_dhcp_client.constructed()) {
-						throw Drop_packet("DHCP reply while DHCP client inactive"); }
+						return packet_drop("DHCP reply while DHCP client inactive"); }
 
-					_dhcp_client->handle_dhcp_reply(dhcp);
-					return;
+					return _dhcp_client->handle_dhcp_reply(dhcp);
 
 				default:
 
-					throw Drop_packet("Bad DHCP opcode");
-				}
-			}
-		}
-		else if (prot == L3_protocol::ICMP) {
-			_handle_icmp(eth, size_guard, ip, pkt, prot, prot_base, prot_size,
-			             local_domain, local_intf);
-			return;
-		}
-
-		Link_side_id const local_id = { ip.src(), _src_port(prot, prot_base),
-		                                ip.dst(), _dst_port(prot, prot_base) };
-
-		/* try to route via existing UDP/TCP links */
-		try {
-			Link_side const &local_side = local_domain.links(prot).find_by_id(local_id);
-			Link &link = local_side.link();
-			bool const client = local_side.is_client();
-			Link_side &remote_side = client ? link.server() : link.client();
-			Domain &remote_domain = remote_side.domain();
-			if (_config().verbose()) {
-				log("[", local_domain, "] using ", l3_protocol_name(prot),
-				    " link: ", link);
-			}
-			_adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
-			ip.src(remote_side.dst_ip());
-			ip.dst(remote_side.src_ip());
-			_src_port(prot, prot_base, remote_side.dst_port());
-			_dst_port(prot, prot_base, remote_side.src_port());
-
-			remote_domain.interfaces().for_each([&] (Interface &interface) {
-				interface._pass_prot(eth, size_guard, ip, prot, prot_base, prot_size);
-			});
-			_link_packet(prot, prot_base, link, client);
-			return;
-		}
-		catch (Link_side_tree::No_match) { }
-
-		/* try to route via forward rules */
-		if (local_id.dst_ip == local_intf.address) {
-			try {
-				Forward_rule const &rule =
-					_forward_rules(local_domain, prot).find_by_port(local_id.dst_port);
-
-				if(_config().verbose()) {
-					log("[", local_domain, "] using forward rule: ",
-					    l3_protocol_name(prot), " ", rule);
+					return packet_drop("Bad DHCP opcode");
 				}
-				Domain &remote_domain = rule.domain();
-				_adapt_eth(eth, rule.to_ip(), pkt, remote_domain);
-				ip.dst(rule.to_ip());
-				if (!(rule.to_port() == Port(0))) {
-					_dst_port(prot, prot_base, rule.to_port());
-				}
-				_nat_link_and_pass(eth, size_guard, ip, prot, prot_base,
-				                   prot_size, local_id, local_domain, remote_domain);
-				return;
 			}
-			catch (Forward_rule_tree::No_match) { }
 		}
-		/* try to route via transport and permit rules */
-		try {
-			Transport_rule const &transport_rule =
-				_transport_rules(local_domain, prot).longest_prefix_match(local_id.dst_ip);
-
-			Permit_rule const &permit_rule =
-				transport_rule.permit_rule(local_id.dst_port);
-
-			if(_config().verbose()) {
-				log("[", local_domain, "] using ", l3_protocol_name(prot),
-				    " rule: ", transport_rule, " ", permit_rule);
-			}
-			Domain &remote_domain = permit_rule.domain();
-			_adapt_eth(eth, local_id.dst_ip, pkt, remote_domain);
-			_nat_link_and_pass(eth, size_guard, ip, prot, prot_base, prot_size,
-			                   local_id, local_domain, remote_domain);
-			return;
-		}
-		catch (Transport_rule_list::No_match) { }
-		catch (Permit_single_rule_tree::No_match) { }
+		Packet_result const result = prot == L3_protocol::ICMP ?
+			_handle_icmp(eth, size_guard, ip, pkt, prot, prot_base,
+			             prot_size, local_domain, local_intf) :
+			_handle_udp_tcp(eth, size_guard, ip, pkt, prot, prot_base,
+			                local_domain, local_intf);
+
+		if (!result.unhandled()) {
+			return result; }
 	}
-	catch (Interface::Bad_transport_protocol) { }
 
 	/* try to route via IP rules */
-	try {
-		Ip_rule const &rule =
-			local_domain.ip_rules().longest_prefix_match(ip.dst());
-
+	if (Ip_rule const *const rule =
+	    local_domain.ip_rules().longest_prefix_match(ip.dst()))
+	{
 		if(_config().verbose()) {
-			log("[", local_domain, "] using IP rule: ", rule); }
+			log("[", local_domain, "] using IP rule: ", *rule); }
+
+		Domain &remote_domain = rule->domain();
+		Packet_result const result =
+			_adapt_eth(eth, ip.dst(), pkt, remote_domain);
+
+		if (!result.handled()) {
+			return result; }
 
-		Domain &remote_domain = rule.domain();
-		_adapt_eth(eth, ip.dst(), pkt, remote_domain);
 		remote_domain.interfaces().for_each([&] (Interface &interface) {
-			interface._pass_ip(eth, size_guard, ip);
+			interface._pass_ip(eth, size_guard);
 		});
 
-		return;
+		return packet_handled();
 	}
-	catch (Ip_rule_list::No_match) { }
 
 	/* give up and drop packet */
 	_send_icmp_dst_unreachable(local_intf, eth, ip,
 	                           Icmp_packet::Code::DST_NET_UNREACHABLE);
 	if (_config().verbose()) {
 		log("[", local_domain, "] unroutable packet"); }
+
+	return packet_handled();
 }
 
 
@@ -1327,18 +1430,17 @@ void Interface::_broadcast_arp_request(Ipv4_address const &src_ip,
 }
 
 
-void Interface::_handle_arp_reply(Ethernet_frame &eth,
-                                  Size_guard     &size_guard,
-                                  Arp_packet     &arp,
-                                  Domain         &local_domain)
+Packet_result Interface::_handle_arp_reply(Ethernet_frame &eth,
+                                           Size_guard     &size_guard,
+                                           Arp_packet     &arp,
+                                           Domain         &local_domain)
 {
-	try {
-		/* check wether a matching ARP cache entry already exists */
-		local_domain.arp_cache().find_by_ip(arp.src_ip());
+	/* check wether a matching ARP cache entry already exists */
+	if (local_domain.arp_cache().find_by_ip(arp.src_ip())) {
 		if (_config().verbose()) {
 			log("[", local_domain, "] ARP entry already exists"); }
-	}
-	catch (Arp_cache::No_match) {
+
+	} else {
 
 		/* by now, no matching ARP cache entry exists, so create one */
 		Ipv4_address const ip = arp.src_ip();
@@ -1368,6 +1470,7 @@ void Interface::_handle_arp_reply(Ethernet_frame &eth,
 			    "to all interfaces of the sender domain"); }
 		_domain_broadcast(eth, size_guard, local_domain);
 	}
+	return packet_handled();
 }
 
 
@@ -1399,10 +1502,10 @@ void Interface::_send_arp_reply(Ethernet_frame &request_eth,
 }
 
 
-void Interface::_handle_arp_request(Ethernet_frame &eth,
-                                    Size_guard     &size_guard,
-                                    Arp_packet     &arp,
-                                    Domain         &local_domain)
+Packet_result Interface::_handle_arp_request(Ethernet_frame &eth,
+                                             Size_guard     &size_guard,
+                                             Arp_packet     &arp,
+                                             Domain         &local_domain)
 {
 	Ipv4_config         const &local_ip_cfg = local_domain.ip_config();
 	Ipv4_address_prefix const &local_intf   = local_ip_cfg.interface();
@@ -1412,7 +1515,7 @@ void Interface::_handle_arp_request(Ethernet_frame &eth,
 		if (arp.src_ip() == arp.dst_ip()) {
 
 			/* gratuitous ARP requests are not really necessary */
-			throw Drop_packet("gratuitous ARP request");
+			return packet_drop("gratuitous ARP request");
 
 		} else if (arp.dst_ip() == local_intf.address) {
 
@@ -1437,7 +1540,7 @@ void Interface::_handle_arp_request(Ethernet_frame &eth,
 		if (local_ip_cfg.gateway_valid()) {
 
 			/* leave request up to the gateway of the domain */
-			throw Drop_packet("leave ARP request up to gateway");
+			return packet_drop("leave ARP request up to gateway");
 
 		} else {
 
@@ -1448,22 +1551,23 @@ void Interface::_handle_arp_request(Ethernet_frame &eth,
 			_send_arp_reply(eth, arp);
 		}
 	}
+	return packet_handled();
 }
 
 
-void Interface::_handle_arp(Ethernet_frame &eth,
-                            Size_guard     &size_guard,
-                            Domain         &local_domain)
+Packet_result Interface::_handle_arp(Ethernet_frame &eth,
+                                     Size_guard     &size_guard,
+                                     Domain         &local_domain)
 {
 	/* ignore ARP regarding protocols other than IPv4 via ethernet */
 	Arp_packet &arp = eth.data<Arp_packet>(size_guard);
 	if (!arp.ethernet_ipv4()) {
-		throw Drop_packet("ARP for unknown protocol"); }
+		return packet_drop("ARP for unknown protocol"); }
 
 	switch (arp.opcode()) {
-	case Arp_packet::REPLY:   _handle_arp_reply(eth, size_guard, arp, local_domain);   break;
-	case Arp_packet::REQUEST: _handle_arp_request(eth, size_guard, arp, local_domain); break;
-	default: throw Drop_packet("unknown ARP operation"); }
+	case Arp_packet::REPLY:   return _handle_arp_reply(eth, size_guard, arp, local_domain);
+	case Arp_packet::REQUEST: return _handle_arp_request(eth, size_guard, arp, local_domain);
+	default:                  return packet_drop("unknown ARP operation"); }
 }
 
 
@@ -1472,10 +1576,9 @@ void Interface::_handle_pkt()
 	Packet_descriptor const pkt = _sink.get_packet();
 	Size_guard size_guard(pkt.size());
 	try {
-		_handle_eth(_sink.packet_content(pkt), size_guard, pkt);
-		_ack_packet(pkt);
+		if (!_handle_eth(_sink.packet_content(pkt), size_guard, pkt).postponed()) {
+			_ack_packet(pkt); }
 	}
-	catch (Packet_postponed) { }
 	catch (Genode::Packet_descriptor::Invalid_packet) { }
 }
 
@@ -1503,10 +1606,11 @@ void Interface::_continue_handle_eth(Domain            const &domain,
                                      Packet_descriptor const &pkt)
 {
 	Size_guard size_guard(pkt.size());
-	try { _handle_eth(_sink.packet_content(pkt), size_guard, pkt); }
-	catch (Packet_postponed) {
-		if (domain.verbose_packet_drop()) {
-			log("[", domain, "] drop packet (handling postponed twice)"); }
+	try {
+		if (_handle_eth(_sink.packet_content(pkt), size_guard, pkt).postponed()) {
+			if (domain.verbose_packet_drop()) {
+				log("[", domain, "] drop packet (handling postponed twice)"); }
+		}
 	}
 	catch (Genode::Packet_descriptor::Invalid_packet) {
 		if (domain.verbose_packet_drop()) {
@@ -1542,17 +1646,17 @@ void Interface::_destroy_released_dhcp_allocations(Domain &local_domain)
 }
 
 
-void Interface::_handle_eth(Ethernet_frame           &eth,
-                            Size_guard               &size_guard,
-                            Packet_descriptor  const &pkt,
-                            Domain                   &local_domain)
+Packet_result Interface::_handle_eth(Ethernet_frame           &eth,
+                                     Size_guard               &size_guard,
+                                     Packet_descriptor  const &pkt,
+                                     Domain                   &local_domain)
 {
 	if (local_domain.ip_config().valid()) {
 
 		switch (eth.type()) {
-		case Ethernet_frame::Type::ARP:  _handle_arp(eth, size_guard, local_domain);     break;
-		case Ethernet_frame::Type::IPV4: _handle_ip(eth, size_guard, pkt, local_domain); break;
-		default: throw Bad_network_protocol(); }
+		case Ethernet_frame::Type::ARP:  return _handle_arp(eth, size_guard, local_domain);
+		case Ethernet_frame::Type::IPV4: return _handle_ip(eth, size_guard, pkt, local_domain);
+		default:                         return packet_drop("unknown network layer protocol"); }
 
 	} else {
 
@@ -1562,47 +1666,46 @@ void Interface::_handle_eth(Ethernet_frame           &eth,
 			if (eth.dst() != router_mac() &&
 			    eth.dst() != Mac_address(0xff))
 			{
-				throw Drop_packet("Expecting Ethernet targeting the router"); }
+				return packet_drop("Expecting Ethernet targeting the router"); }
 
 			Ipv4_packet &ip = eth.data<Ipv4_packet>(size_guard);
 			if (ip.protocol() != Ipv4_packet::Protocol::UDP) {
-				throw Drop_packet("Expecting UDP packet"); }
+				return packet_drop("Expecting UDP packet"); }
 
 			Udp_packet &udp = ip.data<Udp_packet>(size_guard);
 			if (!Dhcp_packet::is_dhcp(&udp)) {
-				throw Drop_packet("Expecting DHCP packet"); }
+				return packet_drop("Expecting DHCP packet"); }
 
 			Dhcp_packet &dhcp = udp.data<Dhcp_packet>(size_guard);
 			switch (dhcp.op()) {
 			case Dhcp_packet::REPLY:
 
 				if (dhcp.client_mac() != router_mac()) {
-					throw Drop_packet("Expecting DHCP targeting the router"); }
+					return packet_drop("Expecting DHCP targeting the router"); }
 
 				if (!_dhcp_client.constructed()) {
-					throw Drop_packet("Expecting DHCP client to be active"); }
+					return packet_drop("Expecting DHCP client to be active"); }
 
-				_dhcp_client->handle_dhcp_reply(dhcp);
-				break;
+				return _dhcp_client->handle_dhcp_reply(dhcp);
 
 			default:
 
-				throw Drop_packet("Expecting DHCP reply");
+				return packet_drop("Expecting DHCP reply");
 			}
-			break;
 		}
 		default:
 
-			throw Bad_network_protocol();
+			return packet_drop("unknown network layer protocol");
 		}
 	}
 }
 
 
-void Interface::_handle_eth(void              *const  eth_base,
-                            Size_guard               &size_guard,
-                            Packet_descriptor  const &pkt)
+Packet_result Interface::_handle_eth(void              *const  eth_base,
+                                     Size_guard               &size_guard,
+                                     Packet_descriptor  const &pkt)
 {
+	Packet_result result = packet_handled();
 	try {
 		Domain &local_domain = _domain();
 		local_domain.raise_rx_bytes(size_guard.total_size());
@@ -1620,7 +1723,7 @@ void Interface::_handle_eth(void              *const  eth_base,
 					log("[", local_domain, "] rcv ", eth); }
 
 				/* try to handle ethernet frame */
-				try { _handle_eth(eth, size_guard, pkt, local_domain); }
+				try { result = _handle_eth(eth, size_guard, pkt, local_domain); }
 				catch (Free_resources_and_retry_handle_eth) {
 					try {
 						if (_config().verbose()) {
@@ -1639,7 +1742,7 @@ void Interface::_handle_eth(void              *const  eth_base,
 						_destroy_some_links<Icmp_link>(_icmp_links, _dissolved_icmp_links, _alloc, max);
 
 						/* retry to handle ethernet frame */
-						_handle_eth(eth, size_guard, pkt, local_domain);
+						result = _handle_eth(eth, size_guard, pkt, local_domain);
 					}
 					catch (Free_resources_and_retry_handle_eth exception) {
 						if (exception.prot != (L3_protocol)0) {
@@ -1651,9 +1754,13 @@ void Interface::_handle_eth(void              *const  eth_base,
 						}
 
 						/* give up if the resources still not suffice */
-						throw Drop_packet("insufficient resources");
+						result = packet_drop("insufficient resources");
 					}
 				}
+				if (result.drop() && local_domain.verbose_packet_drop()) {
+					log("[", local_domain, "] drop packet (",
+					    result.drop_reason, ")");
+				}
 			}
 			catch (Dhcp_server::Alloc_ip_failed) {
 				if (_config().verbose()) {
@@ -1675,18 +1782,6 @@ void Interface::_handle_eth(void              *const  eth_base,
 					    "DHCP reply");
 				}
 			}
-			catch (Bad_network_protocol) {
-				if (_config().verbose()) {
-					log("[", local_domain, "] unknown network layer "
-					    "protocol");
-				}
-			}
-			catch (Drop_packet exception) {
-				if (local_domain.verbose_packet_drop()) {
-					log("[", local_domain, "] drop packet (",
-					    exception.reason, ")");
-				}
-			}
 		}
 		catch (Size_guard::Exceeded) {
 			if (_config().verbose()) {
@@ -1708,6 +1803,7 @@ void Interface::_handle_eth(void              *const  eth_base,
 		if (_config().verbose()) {
 			log("[?] drop packet: no domain"); }
 	}
+	return result;
 }
 
 
@@ -1801,25 +1897,30 @@ void Interface::_update_link_check_nat(Link        &link,
 		throw Dismiss_link();
 	}
 	Pointer<Port_allocator_guard> remote_port_alloc_ptr;
-	if (link.client().src_ip() == link.server().dst_ip()) {
-		link.handle_config(cln_dom, new_srv_dom, remote_port_alloc_ptr, _config());
-		return;
-	}
 	try {
+		if (link.client().src_ip() == link.server().dst_ip()) {
+			link.handle_config(cln_dom, new_srv_dom, remote_port_alloc_ptr, _config());
+			return;
+		}
 		if (link.server().dst_ip() != new_srv_dom.ip_config().interface().address) {
 			_dismiss_link_log(link, "NAT IP");
 			throw Dismiss_link();
 		}
-		Nat_rule &nat = new_srv_dom.nat_rules().find_by_domain(cln_dom);
-		Port_allocator_guard &remote_port_alloc = nat.port_alloc(prot);
+		Nat_rule *const nat = new_srv_dom.nat_rules().find_by_domain(cln_dom);
+		if (!nat) {
+			_dismiss_link_log(link, "no NAT rule");
+			throw Dismiss_link();
+		}
+		Port_allocator_guard &remote_port_alloc = nat->port_alloc(prot);
 		remote_port_alloc.alloc(link.server().dst_port());
 		remote_port_alloc_ptr = remote_port_alloc;
 		link.handle_config(cln_dom, new_srv_dom, remote_port_alloc_ptr, _config());
 		return;
 	}
-	catch (Nat_rule_tree::No_match)              { _dismiss_link_log(link, "no NAT rule"); }
 	catch (Port_allocator::Allocation_conflict)  { _dismiss_link_log(link, "no NAT-port"); }
 	catch (Port_allocator_guard::Out_of_indices) { _dismiss_link_log(link, "no NAT-port quota"); }
+	catch (Out_of_ram)                           { _dismiss_link_log(link, "no link-table RAM"); }
+	catch (Out_of_caps)                          { _dismiss_link_log(link, "no link-table caps"); }
 	throw Dismiss_link();
 }
 
@@ -1830,57 +1931,58 @@ void Interface::_update_udp_tcp_links(L3_protocol  prot,
 	links(prot).for_each([&] (Link &link) {
 		try {
 			/* try to find forward rule that matches the server port */
-			Forward_rule const &rule =
-				_forward_rules(cln_dom, prot).
-					find_by_port(link.client().dst_port());
-
-			/* if destination IP of forwarding changed, dismiss link */
-			if (rule.to_ip() != link.server().src_ip()) {
-				_dismiss_link_log(link, "other forward-rule to");
-				throw Dismiss_link();
-			}
-			/*
-			 * If destination port of forwarding was set and then was
-			 * modified or unset, dismiss link
-			 */
-			if (!(link.server().src_port() == link.client().dst_port())) {
-				if (!(rule.to_port() == link.server().src_port())) {
-					_dismiss_link_log(link, "other forward-rule to_port");
+			if (Forward_rule const *const rule =
+			    _forward_rules(cln_dom, prot).find_by_port(link.client().dst_port()))
+			{
+				/* if destination IP of forwarding changed, dismiss link */
+				if (rule->to_ip() != link.server().src_ip()) {
+					_dismiss_link_log(link, "other forward-rule to");
 					throw Dismiss_link();
 				}
-			}
-			/*
-			 * If destination port of forwarding was not set and then was
-			 * set, dismiss link
-			 */
-			else {
-				if (!(rule.to_port() == link.server().src_port()) &&
-				    !(rule.to_port() == Port(0)))
-				{
-					_dismiss_link_log(link, "new forward-rule to_port");
-					throw Dismiss_link();
+				/*
+				 * If destination port of forwarding was set and then was
+				 * modified or unset, dismiss link
+				 */
+				if (!(link.server().src_port() == link.client().dst_port())) {
+					if (!(rule->to_port() == link.server().src_port())) {
+						_dismiss_link_log(link, "other forward-rule to_port");
+						throw Dismiss_link();
+					}
+				}
+				/*
+				 * If destination port of forwarding was not set and then was
+				 * set, dismiss link
+				 */
+				else {
+					if (!(rule->to_port() == link.server().src_port()) &&
+					    !(rule->to_port() == Port(0)))
+					{
+						_dismiss_link_log(link, "new forward-rule to_port");
+						throw Dismiss_link();
+					}
 				}
+				_update_link_check_nat(link, rule->domain(), prot, cln_dom);
+				return;
 			}
-			_update_link_check_nat(link, rule.domain(), prot, cln_dom);
-			return;
-		}
-		catch (Forward_rule_tree::No_match) {
-			try {
-				/* try to find transport rule that matches the server IP */
-				Transport_rule const &transport_rule =
-					_transport_rules(cln_dom, prot).
-						longest_prefix_match(link.client().dst_ip());
+			/* try to find transport rule that matches the server IP */
+			Transport_rule const *const transport_rule =
+				_transport_rules(cln_dom, prot).
+					longest_prefix_match(link.client().dst_ip());
 
-				/* try to find permit rule that matches the server port */
-				Permit_rule const &permit_rule =
-					transport_rule.permit_rule(link.client().dst_port());
+			if (!transport_rule) {
+				_dismiss_link_log(link, "no transport/forward rule");
+				throw Dismiss_link();
+			}
+			/* try to find permit rule that matches the server port */
+			Permit_rule const *const permit_rule =
+				transport_rule->permit_rule(link.client().dst_port());
 
-				_update_link_check_nat(link, permit_rule.domain(), prot, cln_dom);
-				return;
+			if (!permit_rule) {
+				_dismiss_link_log(link, "no permit rule");
+				throw Dismiss_link();
 			}
-			catch (Transport_rule_list::No_match)     { _dismiss_link_log(link, "no transport/forward rule"); }
-			catch (Permit_single_rule_tree::No_match) { _dismiss_link_log(link, "no permit rule"); }
-			catch (Dismiss_link)                      { }
+			_update_link_check_nat(link, permit_rule->domain(), prot, cln_dom);
+			return;
 		}
 		catch (Dismiss_link) { }
 		_destroy_link(link);
@@ -1893,13 +1995,16 @@ void Interface::_update_icmp_links(Domain &cln_dom)
 	L3_protocol const prot = L3_protocol::ICMP;
 	links(prot).for_each([&] (Link &link) {
 		try {
-			Ip_rule const &rule = cln_dom.icmp_rules().
+			Ip_rule const *const rule = cln_dom.icmp_rules().
 				longest_prefix_match(link.client().dst_ip());
 
-			_update_link_check_nat(link, rule.domain(), prot, cln_dom);
+			if (!rule) {
+				_dismiss_link_log(link, "no ICMP rule");
+				throw Dismiss_link();
+			}
+			_update_link_check_nat(link, rule->domain(), prot, cln_dom);
 			return;
 		}
-		catch (Ip_rule_list::No_match) { _dismiss_link_log(link, "no ICMP rule"); }
 		catch (Dismiss_link) { }
 		_destroy_link(link);
 	});
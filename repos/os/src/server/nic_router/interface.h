@@ -22,11 +22,13 @@
 #include <dhcp_server.h>
 #include <list.h>
 #include <report.h>
+#include <packet_result.h>
 
 /* Genode includes */
 #include <nic_session/nic_session.h>
 #include <net/dhcp.h>
 #include <net/icmp.h>
+#include <net/internet_checksum.h>
 
 namespace Genode { class Xml_generator; }
 
@@ -204,70 +206,79 @@ class Net::Interface : private Interface_list::Element
 		Transport_rule_list &_transport_rules(Domain            &local_domain,
 		                                      L3_protocol const  prot) const;
 
-		void _handle_arp(Ethernet_frame       &eth,
-		                 Size_guard           &size_guard,
-		                 Domain               &local_domain);
+		Packet_result _handle_arp(Ethernet_frame       &eth,
+		                          Size_guard           &size_guard,
+		                          Domain               &local_domain);
 
-		void _handle_arp_reply(Ethernet_frame       &eth,
-		                       Size_guard           &size_guard,
-		                       Arp_packet           &arp,
-		                       Domain               &local_domain);
+		Packet_result _handle_arp_reply(Ethernet_frame       &eth,
+		                                Size_guard           &size_guard,
+		                                Arp_packet           &arp,
+		                                Domain               &local_domain);
 
-		void _handle_arp_request(Ethernet_frame       &eth,
-		                         Size_guard           &size_guard,
-		                         Arp_packet           &arp,
-		                         Domain               &local_domain);
+		Packet_result _handle_arp_request(Ethernet_frame       &eth,
+		                                  Size_guard           &size_guard,
+		                                  Arp_packet           &arp,
+		                                  Domain               &local_domain);
 
 		void _send_arp_reply(Ethernet_frame &request_eth,
 		                     Arp_packet     &request_arp);
 
-		void _handle_dhcp_request(Ethernet_frame &eth,
-		                          Dhcp_packet    &dhcp,
-		                          Domain         &local_domain);
-
-		void _handle_ip(Ethernet_frame          &eth,
-		                Size_guard              &size_guard,
-		                Packet_descriptor const &pkt,
-		                Domain                  &local_domain);
-
-		void _handle_icmp_query(Ethernet_frame          &eth,
-		                        Size_guard              &size_guard,
-		                        Ipv4_packet             &ip,
-		                        Packet_descriptor const &pkt,
-		                        L3_protocol              prot,
-		                        void                    *prot_base,
-		                        Genode::size_t           prot_size,
-		                        Domain                  &local_domain);
-
-		void _handle_icmp_error(Ethernet_frame          &eth,
-		                        Size_guard              &size_guard,
-		                        Ipv4_packet             &ip,
-		                        Packet_descriptor const &pkt,
-		                        Domain                  &local_domain,
-		                        Icmp_packet             &icmp,
-		                        Genode::size_t           icmp_sz);
-
-		void _handle_icmp(Ethernet_frame            &eth,
-		                  Size_guard                &size_guard,
-		                  Ipv4_packet               &ip,
-		                  Packet_descriptor   const &pkt,
-		                  L3_protocol                prot,
-		                  void                      *prot_base,
-		                  Genode::size_t             prot_size,
-		                  Domain                    &local_domain,
-		                  Ipv4_address_prefix const &local_intf);
-
-		void _adapt_eth(Ethernet_frame          &eth,
-		                Ipv4_address      const &dst_ip,
-		                Packet_descriptor const &pkt,
-		                Domain                  &remote_domain);
+		Packet_result _handle_dhcp_request(Ethernet_frame &eth,
+		                                   Dhcp_packet    &dhcp,
+		                                   Domain         &local_domain);
+
+		Packet_result _handle_ip(Ethernet_frame          &eth,
+		                         Size_guard              &size_guard,
+		                         Packet_descriptor const &pkt,
+		                         Domain                  &local_domain);
+
+		Packet_result _handle_icmp_query(Ethernet_frame          &eth,
+		                                 Size_guard              &size_guard,
+		                                 Ipv4_packet             &ip,
+		                                 Packet_descriptor const &pkt,
+		                                 L3_protocol              prot,
+		                                 void                    *prot_base,
+		                                 Domain                  &local_domain);
+
+		Packet_result _handle_icmp_error(Ethernet_frame          &eth,
+		                                 Size_guard              &size_guard,
+		                                 Ipv4_packet             &ip,
+		                                 Packet_descriptor const &pkt,
+		                                 Domain                  &local_domain,
+		                                 Icmp_packet             &icmp,
+		                                 Genode::size_t           icmp_sz);
+
+		Packet_result _handle_icmp(Ethernet_frame            &eth,
+		                           Size_guard                &size_guard,
+		                           Ipv4_packet               &ip,
+		                           Packet_descriptor   const &pkt,
+		                           L3_protocol                prot,
+		                           void                      *prot_base,
+		                           Genode::size_t             prot_size,
+		                           Domain                    &local_domain,
+		                           Ipv4_address_prefix const &local_intf);
+
+		Packet_result _handle_udp_tcp(Ethernet_frame            &eth,
+		                              Size_guard                &size_guard,
+		                              Ipv4_packet               &ip,
+		                              Packet_descriptor   const &pkt,
+		                              L3_protocol                prot,
+		                              void                      *prot_base,
+		                              Domain                    &local_domain,
+		                              Ipv4_address_prefix const &local_intf);
+
+		Packet_result _adapt_eth(Ethernet_frame          &eth,
+		                         Ipv4_address      const &dst_ip,
+		                         Packet_descriptor const &pkt,
+		                         Domain                  &remote_domain);
 
 		void _nat_link_and_pass(Ethernet_frame         &eth,
 		                        Size_guard             &size_guard,
 		                        Ipv4_packet            &ip,
+		                        Internet_checksum_diff &ip_icd,
 		                        L3_protocol      const  prot,
 		                        void            *const  prot_base,
-		                        Genode::size_t   const  prot_size,
+		                        Internet_checksum_diff &prot_icd,
 		                        Link_side_id     const &local_id,
 		                        Domain                 &local_domain,
 		                        Domain                 &remote_domain);
@@ -279,16 +290,11 @@ class Net::Interface : private Interface_list::Element
 		                       Size_guard     &size_guard,
 		                       Domain         &local_domain);
 
-		void _pass_prot(Ethernet_frame         &eth,
-		                Size_guard             &size_guard,
-		                Ipv4_packet            &ip,
-		                L3_protocol      const  prot,
-		                void            *const  prot_base,
-		                Genode::size_t   const  prot_size);
+		void _pass_prot(Ethernet_frame &eth,
+		                Size_guard     &size_guard);
 
-		void _pass_ip(Ethernet_frame       &eth,
-		              Size_guard           &size_guard,
-		              Ipv4_packet          &ip);
+		void _pass_ip(Ethernet_frame &eth,
+		              Size_guard     &size_guard);
 
 		void _handle_pkt();
 
@@ -297,14 +303,14 @@ class Net::Interface : private Interface_list::Element
 
 		Ipv4_address const &_router_ip() const;
 
-		void _handle_eth(void              *const  eth_base,
-		                 Size_guard               &size_guard,
-		                 Packet_descriptor  const &pkt);
+		Packet_result _handle_eth(void              *const  eth_base,
+		                          Size_guard               &size_guard,
+		                          Packet_descriptor  const &pkt);
 
-		void _handle_eth(Ethernet_frame           &eth,
-		                 Size_guard               &size_guard,
-		                 Packet_descriptor  const &pkt,
-		                 Domain                   &local_domain);
+		Packet_result _handle_eth(Ethernet_frame           &eth,
+		                          Size_guard               &size_guard,
+		                          Packet_descriptor  const &pkt,
+		                          Domain                   &local_domain);
 
 		void _ack_packet(Packet_descriptor const &pkt);
 
@@ -372,17 +378,8 @@ class Net::Interface : private Interface_list::Element
 		struct Free_resources_and_retry_handle_eth : Genode::Exception { L3_protocol prot; Free_resources_and_retry_handle_eth(L3_protocol prot = (L3_protocol)0) : prot(prot) { } };
 		struct Bad_send_dhcp_args                  : Genode::Exception { };
 		struct Bad_transport_protocol              : Genode::Exception { };
-		struct Bad_network_protocol                : Genode::Exception { };
-		struct Packet_postponed                    : Genode::Exception { };
 		struct Alloc_dhcp_msg_buffer_failed        : Genode::Exception { };
 
-		struct Drop_packet : Genode::Exception
-		{
-			char const *reason;
-
-			Drop_packet(char const *reason) : reason(reason) { }
-		};
-
 		Interface(Genode::Entrypoint     &ep,
 		          Timer::Connection      &timer,
 		          Mac_address      const  router_mac,
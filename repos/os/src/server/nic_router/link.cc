@@ -45,6 +45,12 @@ bool Link_side_id::operator > (Link_side_id const &id) const
 }
 
 
+uint32_t Link_side_id::hash(uint32_t seed) const
+{
+	return hash_bytes(data_base(), data_size(), seed);
+}
+
+
 /***************
  ** Link_side **
  ***************/
@@ -62,20 +68,6 @@ Link_side::Link_side(Domain             &domain,
 }
 
 
-Link_side const &Link_side::find_by_id(Link_side_id const &id) const
-{
-	if (id == _id) {
-		return *this; }
-
-	bool const side = id > _id;
-	Link_side *const link_side = Avl_node<Link_side>::child(side);
-	if (!link_side) {
-		throw Link_side_tree::No_match(); }
-
-	return link_side->find_by_id(id);
-}
-
-
 void Link_side::print(Output &output) const
 {
 	Genode::print(output, "src ", src_ip(), ":", src_port(),
@@ -89,20 +81,6 @@ bool Link_side::is_client() const
 }
 
 
-/********************
- ** Link_side_tree **
- ********************/
-
-Link_side const &Link_side_tree::find_by_id(Link_side_id const &id) const
-{
-	Link_side *const link_side = first();
-	if (!link_side) {
-		throw No_match(); }
-
-	return link_side->find_by_id(id);
-}
-
-
 /**********
  ** Link **
  **********/
@@ -135,10 +113,22 @@ Link::Link(Interface                     &cln_interface,
 	_stats(stats),
 	_stats_curr(stats.opening)
 {
+	/*
+	 * Inserting into the link tables of the domains may have to grow the
+	 * tables, so do it before the link becomes visible anywhere else.
+	 */
+	_client.domain().links(_protocol).insert(_client);
+	try { _server.domain().links(_protocol).insert(_server); }
+	catch (Out_of_ram) {
+		_client.domain().links(_protocol).remove(_client);
+		throw;
+	}
+	catch (Out_of_caps) {
+		_client.domain().links(_protocol).remove(_client);
+		throw;
+	}
 	_stats_curr()++;
 	_client_interface.links(_protocol).insert(this);
-	_client.domain().links(_protocol).insert(&_client);
-	_server.domain().links(_protocol).insert(&_server);
 	_dissolve_timeout.schedule(_dissolve_timeout_us);
 }
 
@@ -168,8 +158,8 @@ void Link::dissolve(bool timeout)
 	}
 	_stats_curr()++;
 
-	_client.domain().links(_protocol).remove(&_client);
-	_server.domain().links(_protocol).remove(&_server);
+	_client.domain().links(_protocol).remove(_client);
+	_server.domain().links(_protocol).remove(_server);
 	if (_config().verbose()) {
 		log("Dissolve ", l3_protocol_name(_protocol), " link: ", *this); }
 
@@ -201,16 +191,16 @@ void Link::handle_config(Domain                        &cln_domain,
 	_dissolve_timeout_us = dissolve_timeout_us;
 	_dissolve_timeout.schedule(_dissolve_timeout_us);
 
-	_client.domain().links(_protocol).remove(&_client);
-	_server.domain().links(_protocol).remove(&_server);
+	_client.domain().links(_protocol).remove(_client);
+	_server.domain().links(_protocol).remove(_server);
 
 	_config            = config;
 	_client._domain    = cln_domain;
 	_server._domain    = srv_domain;
 	_server_port_alloc = srv_port_alloc;
 
-	cln_domain.links(_protocol).insert(&_client);
-	srv_domain.links(_protocol).insert(&_server);
+	cln_domain.links(_protocol).insert(_client);
+	srv_domain.links(_protocol).insert(_server);
 
 	if (config.verbose()) {
 		log("[", cln_domain, "] update link client: ", _client);
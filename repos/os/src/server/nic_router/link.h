@@ -32,7 +32,6 @@
 
 /* Genode includes */
 #include <timer_session/connection.h>
-#include <util/avl_tree.h>
 #include <util/list.h>
 #include <net/ipv4.h>
 #include <net/port.h>
@@ -42,6 +41,7 @@
 #include <reference.h>
 #include <pointer.h>
 #include <l3_protocol.h>
+#include <hash_table.h>
 
 namespace Net {
 
@@ -53,7 +53,7 @@ namespace Net {
 	class  Interface;
 	class  Link_side_id;
 	class  Link_side;
-	class  Link_side_tree;
+	class  Link_side_table;
 	class  Link;
 	struct Link_list : List<Link> { };
 	class  Tcp_link;
@@ -73,6 +73,8 @@ struct Net::Link_side_id
 
 	void *data_base() const { return (void *)&src_ip; }
 
+	Genode::uint32_t hash(Genode::uint32_t seed) const;
+
 
 	/************************
 	 ** Standard operators **
@@ -85,7 +87,7 @@ struct Net::Link_side_id
 __attribute__((__packed__));
 
 
-class Net::Link_side : public Genode::Avl_node<Link_side>
+class Net::Link_side
 {
 	friend class Link;
 
@@ -101,18 +103,9 @@ class Net::Link_side : public Genode::Avl_node<Link_side>
 		          Link_side_id const &id,
 		          Link               &link);
 
-		Link_side const &find_by_id(Link_side_id const &id) const;
-
 		bool is_client() const;
 
 
-		/**************
-		 ** Avl_node **
-		 **************/
-
-		bool higher(Link_side *side) { return side->_id > _id; }
-
-
 		/*********
 		 ** Log **
 		 *********/
@@ -126,6 +119,7 @@ class Net::Link_side : public Genode::Avl_node<Link_side>
 
 		Domain             &domain()    const { return _domain(); }
 		Link               &link()      const { return _link; }
+		Link_side_id const &id()        const { return _id; }
 		Ipv4_address const &src_ip()    const { return _id.src_ip; }
 		Ipv4_address const &dst_ip()    const { return _id.dst_ip; }
 		Port                src_port()  const { return _id.src_port; }
@@ -133,11 +127,9 @@ class Net::Link_side : public Genode::Avl_node<Link_side>
 };
 
 
-struct Net::Link_side_tree : Genode::Avl_tree<Link_side>
+struct Net::Link_side_table : Hash_table<Link_side, Link_side_id>
 {
-	struct No_match : Genode::Exception { };
-
-	Link_side const &find_by_id(Link_side_id const &id) const;
+	Link_side_table(Genode::Allocator &alloc) : Hash_table(alloc) { }
 };
 
 
@@ -57,7 +57,7 @@ class Net::Nat_rule : public Genode::Avl_node<Nat_rule>
 		         Genode::Xml_node const  node,
 		         bool             const  verbose);
 
-		Nat_rule &find_by_domain(Domain &domain);
+		Nat_rule *find_by_domain(Domain &domain);
 
 		Port_allocator_guard &port_alloc(L3_protocol const prot);
 
@@ -89,9 +89,10 @@ class Net::Nat_rule : public Genode::Avl_node<Nat_rule>
 
 struct Net::Nat_rule_tree : Avl_tree<Nat_rule>
 {
-	struct No_match : Genode::Exception { };
-
-	Nat_rule &find_by_domain(Domain &domain);
+	/**
+	 * Return rule for 'domain' or nullptr if there is none
+	 */
+	Nat_rule *find_by_domain(Domain &domain);
 };
 
 #endif /* _NAT_RULE_H_ */
@@ -0,0 +1,74 @@
+/*
+ * \brief  Result of handling a packet
+ * \author agent
+ * \date   2026-10-16
+ *
+ * Packet handling returns a result instead of throwing exceptions for the
+ * drop and postpone cases as these are ordinary outcomes that may occur for
+ * each packet of a flood of unmatched traffic. Exceptions remain reserved for
+ * resource exhaustion.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _PACKET_RESULT_H_
+#define _PACKET_RESULT_H_
+
+namespace Net {
+
+	struct Packet_result;
+
+	static inline Packet_result packet_handled();
+	static inline Packet_result packet_postponed();
+	static inline Packet_result packet_drop(char const *reason);
+	static inline Packet_result packet_unhandled();
+}
+
+
+struct Net::Packet_result
+{
+	enum Type { UNHANDLED, HANDLED, POSTPONED, DROP };
+
+	Type        type        { UNHANDLED };
+	char const *drop_reason { "" };
+
+	bool handled()   const { return type == HANDLED; }
+	bool postponed() const { return type == POSTPONED; }
+	bool drop()      const { return type == DROP; }
+	bool unhandled() const { return type == UNHANDLED; }
+};
+
+
+/**
+ * The packet was consumed and can be acknowledged
+ */
+static inline Net::Packet_result Net::packet_handled() {
+	return Packet_result { Packet_result::HANDLED, "" }; }
+
+
+/**
+ * The packet waits for an ARP reply and must not be acknowledged yet
+ */
+static inline Net::Packet_result Net::packet_postponed() {
+	return Packet_result { Packet_result::POSTPONED, "" }; }
+
+
+/**
+ * The packet was dropped for the given reason
+ */
+static inline Net::Packet_result Net::packet_drop(char const *reason) {
+	return Packet_result { Packet_result::DROP, reason }; }
+
+
+/**
+ * No handling stage took care of the packet so far
+ */
+static inline Net::Packet_result Net::packet_unhandled() {
+	return Packet_result { Packet_result::UNHANDLED, "" }; }
+
+#endif /* _PACKET_RESULT_H_ */
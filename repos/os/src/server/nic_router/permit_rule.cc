@@ -87,16 +87,16 @@ Permit_single_rule::Permit_single_rule(Domain_tree    &domains,
 }
 
 
-Permit_single_rule const &
+Permit_single_rule const *
 Permit_single_rule::find_by_port(Port const port) const
 {
 	if (port == _port) {
-		return *this; }
+		return this; }
 
 	bool const side = port.value > _port.value;
 	Permit_single_rule *const rule = Avl_node<Permit_single_rule>::child(side);
 	if (!rule) {
-		throw Permit_single_rule_tree::No_match(); }
+		return nullptr; }
 
 	return rule->find_by_port(port);
 }
@@ -107,12 +107,12 @@ Permit_single_rule::find_by_port(Port const port) const
  ** Permit_single_rule_tree **
  *****************************/
 
-Permit_single_rule const &
+Permit_single_rule const *
 Permit_single_rule_tree::find_by_port(Port const port) const
 {
 	Permit_single_rule *const rule = first();
 	if (!rule) {
-		throw No_match(); }
+		return nullptr; }
 
 	return rule->find_by_port(port);
 }
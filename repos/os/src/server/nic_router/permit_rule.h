@@ -112,7 +112,7 @@ class Net::Permit_single_rule : public  Permit_rule,
 		Permit_single_rule(Domain_tree            &domains,
 		                   Genode::Xml_node const  node);
 
-		Permit_single_rule const &find_by_port(Port const port) const;
+		Permit_single_rule const *find_by_port(Port const port) const;
 
 
 		/*********
@@ -141,8 +141,6 @@ struct Net::Permit_single_rule_tree : private Avl_tree<Permit_single_rule>
 {
 	friend class Transport_rule;
 
-	struct No_match : Genode::Exception { };
-
 	void insert(Permit_single_rule *rule)
 	{
 		Genode::Avl_tree<Permit_single_rule>::insert(rule);
@@ -150,7 +148,10 @@ struct Net::Permit_single_rule_tree : private Avl_tree<Permit_single_rule>
 
 	using Genode::Avl_tree<Permit_single_rule>::first;
 
-	Permit_single_rule const &find_by_port(Port const port) const;
+	/**
+	 * Return rule for 'port' or nullptr if there is none
+	 */
+	Permit_single_rule const *find_by_port(Port const port) const;
 };
 
 #endif /* _PERMIT_RULE_H_ */
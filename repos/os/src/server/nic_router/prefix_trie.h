@@ -0,0 +1,166 @@
+/*
+ * \brief  Path-compressed binary trie for longest-prefix matching
+ * \author agent
+ * \date   2026-10-16
+ *
+ * Each node stands for an IPv4 prefix and may carry a value. A node has
+ * at most two children whose prefixes extend the prefix of the node by at
+ * least one bit. Nodes with only one child and no value are never created,
+ * so the depth of the trie is bounded by the number of stored prefixes as
+ * well as by the 33 possible prefix lengths. A lookup walks down the trie
+ * only once and remembers the value of the deepest matching node.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _PREFIX_TRIE_H_
+#define _PREFIX_TRIE_H_
+
+/* local includes */
+#include <ipv4_address_prefix.h>
+
+/* Genode includes */
+#include <base/allocator.h>
+#include <util/noncopyable.h>
+
+namespace Net { template <typename> class Prefix_trie; }
+
+
+template <typename T>
+class Net::Prefix_trie : Genode::Noncopyable
+{
+	private:
+
+		using uint32_t = Genode::uint32_t;
+
+		struct Node
+		{
+			uint32_t const  key;
+			unsigned const  len;
+			T const        *value;
+			Node           *child[2] { nullptr, nullptr };
+
+			Node(uint32_t key, unsigned len, T const *value)
+			: key(key), len(len), value(value) { }
+		};
+
+		Node *_root { nullptr };
+
+		static uint32_t _mask(unsigned len) {
+			return len ? ~(uint32_t)0 << (32 - len) : 0; }
+
+		static unsigned _bit(uint32_t key, unsigned pos) {
+			return (key >> (31 - pos)) & 1; }
+
+		static unsigned _common_len(uint32_t key_1, uint32_t key_2)
+		{
+			uint32_t const diff = key_1 ^ key_2;
+			return diff ? (unsigned)__builtin_clz(diff) : 32;
+		}
+
+		static void _destroy(Genode::Deallocator &dealloc, Node *node)
+		{
+			if (!node) {
+				return; }
+
+			_destroy(dealloc, node->child[0]);
+			_destroy(dealloc, node->child[1]);
+			destroy(dealloc, node);
+		}
+
+	public:
+
+		/**
+		 * Attach 'value' to 'prefix' unless the prefix has a value already
+		 *
+		 * \throw Out_of_ram
+		 * \throw Out_of_caps
+		 */
+		void insert(Genode::Allocator         &alloc,
+		            Ipv4_address_prefix const &prefix,
+		            T                   const &value)
+		{
+			unsigned const len = prefix.prefix < 32 ? prefix.prefix : 32;
+			uint32_t const key =
+				prefix.address.to_uint32_little_endian() & _mask(len);
+
+			for (Node **link = &_root;;) {
+
+				Node *const node = *link;
+				if (!node) {
+					*link = new (alloc) Node(key, len, &value);
+					return;
+				}
+				unsigned common = _common_len(key, node->key);
+				if (common > len)       { common = len; }
+				if (common > node->len) { common = node->len; }
+
+				/* the prefix of the node is a prefix of the new one */
+				if (common == node->len) {
+					if (len == node->len) {
+						if (!node->value) {
+							node->value = &value; }
+						return;
+					}
+					link = &node->child[_bit(key, node->len)];
+					continue;
+				}
+				/* the new prefix is a prefix of the one of the node */
+				if (common == len) {
+					Node &parent = *new (alloc) Node(key, len, &value);
+					parent.child[_bit(node->key, len)] = node;
+					*link = &parent;
+					return;
+				}
+				/* the prefixes diverge, insert a branch at the common part */
+				Node &leaf = *new (alloc) Node(key, len, &value);
+				Node *branch_ptr;
+				try { branch_ptr = new (alloc) Node(key & _mask(common), common, nullptr); }
+				catch (...) {
+					destroy(alloc, &leaf);
+					throw;
+				}
+				Node &branch = *branch_ptr;
+				branch.child[_bit(node->key, common)] = node;
+				branch.child[_bit(key,       common)] = &leaf;
+				*link = &branch;
+				return;
+			}
+		}
+
+		/**
+		 * Return the value of the longest prefix that matches 'ip' or nullptr
+		 */
+		T const *longest_prefix_match(Ipv4_address const &ip) const
+		{
+			uint32_t const key  = ip.to_uint32_little_endian();
+			T const       *best = nullptr;
+			for (Node const *node = _root; node; ) {
+
+				if ((key & _mask(node->len)) != node->key) {
+					break; }
+
+				if (node->value) {
+					best = node->value; }
+
+				if (node->len == 32) {
+					break; }
+
+				node = node->child[_bit(key, node->len)];
+			}
+			return best;
+		}
+
+		void destroy_each(Genode::Deallocator &dealloc)
+		{
+			_destroy(dealloc, _root);
+			_root = nullptr;
+		}
+};
+
+#endif /* _PREFIX_TRIE_H_ */
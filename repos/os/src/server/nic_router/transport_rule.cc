@@ -86,9 +86,10 @@ Transport_rule::~Transport_rule()
 }
 
 
-Permit_rule const &Transport_rule::permit_rule(Port const port) const
+Permit_rule const *Transport_rule::permit_rule(Port const port) const
 {
-	try { return _permit_any_rule(); }
-	catch (Pointer<Permit_any_rule>::Invalid) { }
+	if (_permit_any_rule.valid()) {
+		return &_permit_any_rule(); }
+
 	return _permit_single_rules.find_by_port(port);
 }
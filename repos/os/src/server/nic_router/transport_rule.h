@@ -53,7 +53,10 @@ class Net::Transport_rule : public Direct_rule<Transport_rule>
 
 		~Transport_rule();
 
-		Permit_rule const &permit_rule(Port const port) const;
+		/**
+		 * Return rule that permits 'port' or nullptr if there is none
+		 */
+		Permit_rule const *permit_rule(Port const port) const;
 };
 
 #endif /* _TRANSPORT_RULE_H_ */
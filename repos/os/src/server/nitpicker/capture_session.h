@@ -18,6 +18,9 @@
 #include <base/session_object.h>
 #include <capture_session/capture_session.h>
 
+/* local includes */
+#include "damage_map.h"
+
 namespace Nitpicker { class Capture_session; }
 
 
@@ -50,9 +53,66 @@ class Nitpicker::Capture_session : public Session_object<Capture::Session>
 
 		Signal_context_capability _screen_size_sigh { };
 
-		using Dirty_rect = Genode::Dirty_rect<Rect, Affected_rects::NUM_RECTS>;
+		/* damage since the previous 'capture_at' or 'capture_frame' */
+		Damage_map _damage_map;
+
+		/*
+		 * State of the double-buffered frames defined via 'frames'
+		 *
+		 * For each pixel buffer, '_stale' tracks the damage since the
+		 * buffer was updated the last time.
+		 */
+		bool       _double_buffered = false;
+		unsigned   _next_buffer     = 0;
+		Point      _buffer_pos[2]   { };
+		Damage_map _stale[2];
+
+		unsigned long _frame_cnt = 0;
+
+		template <typename FN>
+		void _for_each_damage_map(FN const &fn)
+		{
+			fn(_damage_map); fn(_stale[0]); fn(_stale[1]);
+		}
+
+		void _configure_damage_maps(unsigned tile_size)
+		{
+			_for_each_damage_map([&] (Damage_map &map) {
+				map.configure(_view_stack.size(), tile_size); });
+		}
+
+		void _alloc_buffer(Area size, size_t bytes, bool double_buffered)
+		{
+			_buffer_size     = Area { };
+			_double_buffered = double_buffered;
+			_next_buffer     = 0;
+			_buffer_pos[0]   = _buffer_pos[1] = Point(0, 0);
+
+			_configure_damage_maps(_damage_map.tile_size());
+
+			if (size.count() == 0) {
+				_buffer.destruct();
+				return;
+			}
+
+			try {
+				_buffer.construct(_ram, _env.rm(), bytes);
+				_buffer_size = size;
+				_handler.capture_buffer_size_changed();
+			} catch (...) {
+				_handler.capture_buffer_size_changed();
+				throw;
+			}
+		}
+
+		void _trace_frame(Damage_map::Flush_result result, Trace::Timestamp start)
+		{
+			_frame_cnt++;
 
-		Dirty_rect _dirty_rect { };
+			trace("capture ", label(), " frame ", _frame_cnt, ": ",
+			      result.rects, " rects, ", result.pixels, " pixels, ",
+			      Trace::timestamp() - start, " cycles");
+		}
 
 	public:
 
@@ -61,16 +121,18 @@ class Nitpicker::Capture_session : public Session_object<Capture::Session>
 		                Label      const &label,
 		                Diag       const &diag,
 		                Handler          &handler,
-		                View_stack const &view_stack)
+		                View_stack const &view_stack,
+		                unsigned          tile_size)
 		:
 			Session_object(env.ep(), resources, label, diag),
 			_env(env),
 			_ram(env.ram(), _ram_quota_guard(), _cap_quota_guard()),
 			_handler(handler),
-			_view_stack(view_stack)
-		{
-			_dirty_rect.mark_as_dirty(Rect(Point(0, 0), view_stack.size()));
-		}
+			_view_stack(view_stack),
+			_damage_map(view_stack.size(), tile_size),
+			_stale { { view_stack.size(), tile_size },
+			         { view_stack.size(), tile_size } }
+		{ }
 
 		~Capture_session() { }
 
@@ -83,12 +145,19 @@ class Nitpicker::Capture_session : public Session_object<Capture::Session>
 
 		void mark_as_damaged(Rect rect)
 		{
-			// XXX not called yet
-			_dirty_rect.mark_as_dirty(rect);
+			_for_each_damage_map([&] (Damage_map &map) {
+				map.mark_as_dirty(rect); });
+		}
+
+		void tile_size(unsigned tile_size)
+		{
+			_configure_damage_maps(tile_size);
 		}
 
 		void screen_size_changed()
 		{
+			_configure_damage_maps(_damage_map.tile_size());
+
 			if (_screen_size_sigh.valid())
 				Signal_transmitter(_screen_size_sigh).submit();
 		}
@@ -107,21 +176,12 @@ class Nitpicker::Capture_session : public Session_object<Capture::Session>
 
 		void buffer(Area size) override
 		{
-			_buffer_size = Area { };
-
-			if (size.count() == 0) {
-				_buffer.destruct();
-				return;
-			}
+			_alloc_buffer(size, buffer_bytes(size), false);
+		}
 
-			try {
-				_buffer.construct(_ram, _env.rm(), buffer_bytes(size));
-				_buffer_size = size;
-				_handler.capture_buffer_size_changed();
-			} catch (...) {
-				_handler.capture_buffer_size_changed();
-				throw;
-			}
+		void frames(Area size) override
+		{
+			_alloc_buffer(size, frames_bytes(size), true);
 		}
 
 		Dataspace_capability dataspace() override
@@ -134,7 +194,7 @@ class Nitpicker::Capture_session : public Session_object<Capture::Session>
 
 		Affected_rects capture_at(Point pos) override
 		{
-			if (!_buffer.constructed())
+			if (!_buffer.constructed() || _double_buffered)
 				return Affected_rects { };
 
 			using Pixel = Pixel_rgb888;
@@ -144,20 +204,97 @@ class Nitpicker::Capture_session : public Session_object<Capture::Session>
 			Rect const buffer_rect(Point(0, 0), _buffer_size);
 
 			Affected_rects affected { };
+
+			if (!_damage_map.dirty())
+				return affected;
+
+			Trace::Timestamp const start = Trace::timestamp();
+
 			unsigned i = 0;
-			_dirty_rect.flush([&] (Rect const &rect) {
+			Damage_map::Flush_result const result = _damage_map.flush([&] (Rect const &rect) {
 
 				_view_stack.draw(canvas, rect);
 
-				if (i < Affected_rects::NUM_RECTS) {
-					Rect const translated(rect.p1() - pos, rect.area());
-					Rect const clipped = Rect::intersect(translated, buffer_rect);
+				Rect const translated(rect.p1() - pos, rect.area());
+				Rect const clipped = Rect::intersect(translated, buffer_rect);
+
+				if (!clipped.valid())
+					return;
+
+				/* merge the surplus rectangles into the last one */
+				if (i < Affected_rects::NUM_RECTS)
 					affected.rects[i++] = clipped;
-				}
+				else
+					affected.rects[i - 1] = Rect::compound(affected.rects[i - 1], clipped);
 			});
 
+			_trace_frame(result, start);
+
 			return affected;
 		}
+
+		Frame capture_frame(Point pos) override
+		{
+			if (!_buffer.constructed() || !_double_buffered)
+				return Frame { };
+
+			unsigned const b        = _next_buffer;
+			Rect     const viewport = Rect(pos, _buffer_size);
+
+			/* the viewport moved since the previous frame */
+			if (pos != _buffer_pos[!b])
+				_damage_map.mark_as_dirty(viewport);
+
+			/* the viewport moved since the buffer was updated the last time */
+			if (pos != _buffer_pos[b]) {
+				_stale[b].mark_as_dirty(viewport);
+				_buffer_pos[b] = pos;
+			}
+
+			if (!_damage_map.dirty())
+				return Frame { .buffer = !b, .num_rects = 0 };
+
+			Trace::Timestamp const start = Trace::timestamp();
+
+			using Pixel = Pixel_rgb888;
+
+			Canvas<Pixel> canvas = { _buffer->local_addr<Pixel>() + b*_buffer_size.count(),
+			                         pos, _buffer_size };
+
+			Damage_map::Flush_result const result = _stale[b].flush([&] (Rect const &rect) {
+				_view_stack.draw(canvas, rect); });
+
+			Damage &damage = *(Damage *)(_buffer->local_addr<char>()
+			                           + Damage::offset(_buffer_size));
+
+			Rect const buffer_rect(Point(0, 0), _buffer_size);
+
+			unsigned n = 0;
+			_damage_map.flush([&] (Rect const &rect) {
+
+				Rect const translated(rect.p1() - pos, rect.area());
+				Rect const clipped = Rect::intersect(translated, buffer_rect);
+
+				if (!clipped.valid())
+					return;
+
+				/* merge the surplus rectangles into the last one */
+				if (n < Damage::MAX_RECTS)
+					damage.rects[n++] = clipped;
+				else
+					damage.rects[n - 1] = Rect::compound(damage.rects[n - 1], clipped);
+			});
+
+			_trace_frame(result, start);
+
+			/* keep presenting the previous frame if the viewport is unaffected */
+			if (n == 0)
+				return Frame { .buffer = !b, .num_rects = 0 };
+
+			_next_buffer = !b;
+
+			return Frame { .buffer = b, .num_rects = n };
+		}
 };
 
 #endif /* _CAPTURE_SESSION_H_ */
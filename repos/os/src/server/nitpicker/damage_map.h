@@ -0,0 +1,186 @@
+/*
+ * \brief  Tile-based tracker of damaged screen areas
+ * \author agent
+ * \date   2026-10-16
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _DAMAGE_MAP_H_
+#define _DAMAGE_MAP_H_
+
+/* local includes */
+#include "types.h"
+
+namespace Nitpicker { class Damage_map; }
+
+
+/**
+ * Dirty-tile tracker
+ *
+ * In contrast to 'Genode::Dirty_rect', which merges all damage into a few
+ * rectangles, the damage map records the damage at the granularity of
+ * tiles. Small updates at distant places, e.g., a blinking cursor and a
+ * clock, thereby do not result in the redraw of their compound. When
+ * flushed, adjacent dirty tiles are combined into rectangles.
+ *
+ * The map has a fixed number of tiles. If the configured tile size would
+ * exceed this number for the covered area, the tile size is doubled until
+ * the area fits.
+ */
+class Nitpicker::Damage_map
+{
+	public:
+
+		enum { DEFAULT_TILE_SIZE = 64, MAX_TILES = 128*128 };
+
+		struct Flush_result
+		{
+			unsigned rects;
+			size_t   pixels;
+		};
+
+	private:
+
+		enum { BITS = 8*sizeof(addr_t) };
+
+		Area     _size { };
+		unsigned _tile_size = DEFAULT_TILE_SIZE;
+		unsigned _cols = 0, _rows = 0;
+		bool     _dirty = false;
+
+		addr_t _tiles[MAX_TILES / BITS] { };
+
+		bool _tile(unsigned col, unsigned row) const
+		{
+			unsigned const i = row*_cols + col;
+			return (_tiles[i / BITS] >> (i % BITS)) & 1;
+		}
+
+		void _set_tiles(unsigned col, unsigned row, unsigned n, bool value)
+		{
+			for (unsigned i = row*_cols + col, end = i + n; i < end; i++) {
+				addr_t const mask = (addr_t)1 << (i % BITS);
+				if (value) _tiles[i / BITS] |=  mask;
+				else       _tiles[i / BITS] &= ~mask;
+			}
+		}
+
+		bool _row_dirty(unsigned col, unsigned row, unsigned n) const
+		{
+			for (unsigned i = 0; i < n; i++)
+				if (!_tile(col + i, row))
+					return false;
+			return true;
+		}
+
+		Rect _tile_rect(unsigned col, unsigned row, unsigned cols, unsigned rows) const
+		{
+			Rect const rect(Point(col*_tile_size, row*_tile_size),
+			                Area(cols*_tile_size, rows*_tile_size));
+
+			return Rect::intersect(rect, Rect(Point(0, 0), _size));
+		}
+
+	public:
+
+		Damage_map(Area size, unsigned tile_size) { configure(size, tile_size); }
+
+		/**
+		 * Adapt map to the covered area and tile size
+		 *
+		 * The whole area is marked as dirty.
+		 */
+		void configure(Area size, unsigned tile_size)
+		{
+			_size      = size;
+			_tile_size = max(tile_size, 8U);
+
+			auto num_tiles = [&] (unsigned n) {
+				return (n + _tile_size - 1) / _tile_size; };
+
+			while (num_tiles(size.w())*num_tiles(size.h()) > MAX_TILES)
+				_tile_size *= 2;
+
+			_cols = num_tiles(size.w());
+			_rows = num_tiles(size.h());
+
+			mark_as_dirty(Rect(Point(0, 0), size));
+		}
+
+		Area     size()      const { return _size; }
+		unsigned tile_size() const { return _tile_size; }
+		bool     dirty()     const { return _dirty; }
+
+		void mark_as_dirty(Rect added)
+		{
+			Rect const rect = Rect::intersect(added, Rect(Point(0, 0), _size));
+
+			if (!rect.valid())
+				return;
+
+			unsigned const col1 = rect.x1() / _tile_size,
+			               col2 = rect.x2() / _tile_size,
+			               row1 = rect.y1() / _tile_size,
+			               row2 = rect.y2() / _tile_size;
+
+			for (unsigned row = row1; row <= row2; row++)
+				_set_tiles(col1, row, col2 - col1 + 1, true);
+
+			_dirty = true;
+		}
+
+		/**
+		 * Call functor for each dirty area
+		 *
+		 * The functor 'fn' takes a 'Rect const &' as argument. Each
+		 * rectangle is the largest block of dirty tiles found when scanning
+		 * the map row by row. This method resets the dirty tiles.
+		 */
+		template <typename FN>
+		Flush_result flush(FN const &fn)
+		{
+			Flush_result result { 0, 0 };
+
+			if (!_dirty)
+				return result;
+
+			for (unsigned row = 0; row < _rows; row++) {
+				for (unsigned col = 0; col < _cols; col++) {
+
+					if (!_tile(col, row))
+						continue;
+
+					/* extend block to the right and downwards */
+					unsigned cols = 1, rows = 1;
+					while (col + cols < _cols && _tile(col + cols, row))
+						cols++;
+
+					while (row + rows < _rows && _row_dirty(col, row + rows, cols))
+						rows++;
+
+					for (unsigned i = 0; i < rows; i++)
+						_set_tiles(col, row + i, cols, false);
+
+					Rect const rect = _tile_rect(col, row, cols, rows);
+
+					result.rects++;
+					result.pixels += rect.area().count();
+
+					fn(rect);
+
+					col += cols - 1;
+				}
+			}
+
+			_dirty = false;
+			return result;
+		}
+};
+
+#endif /* _DAMAGE_MAP_H_ */
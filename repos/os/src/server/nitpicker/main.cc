@@ -23,7 +23,6 @@
 #include <framebuffer_session/connection.h>
 #include <os/session_policy.h>
 #include <nitpicker_gfx/tff_font.h>
-#include <util/dirty_rect.h>
 
 /* local includes */
 #include "types.h"
@@ -34,6 +33,7 @@
 #include "domain_registry.h"
 #include "capture_session.h"
 #include "event_session.h"
+#include "damage_map.h"
 
 namespace Nitpicker {
 	class  Gui_root;
@@ -212,6 +212,8 @@ class Nitpicker::Capture_root : public Root_component<Capture_session>
 		View_stack         const &_view_stack;
 		Capture_session::Handler &_handler;
 
+		unsigned _tile_size = Damage_map::DEFAULT_TILE_SIZE;
+
 	protected:
 
 		Capture_session *_create_session(const char *args) override
@@ -221,7 +223,8 @@ class Nitpicker::Capture_root : public Root_component<Capture_session>
 				                            session_resources_from_args(args),
 				                            session_label_from_args(args),
 				                            session_diag_from_args(args),
-				                            _handler, _view_stack);
+				                            _handler, _view_stack,
+				                            _tile_size);
 		}
 
 		void _upgrade_session(Capture_session *s, const char *args) override
@@ -252,6 +255,19 @@ class Nitpicker::Capture_root : public Root_component<Capture_session>
 			_env(env), _view_stack(view_stack), _handler(handler)
 		{ }
 
+		/**
+		 * Set tile size used for tracking the damage of each capture client
+		 */
+		void tile_size(unsigned tile_size)
+		{
+			if (tile_size == _tile_size)
+				return;
+
+			_tile_size = tile_size;
+			_sessions.for_each([&] (Capture_session &session) {
+				session.tile_size(tile_size); });
+		}
+
 		/**
 		 * Determine the size of the bounding box of all capture pixel buffers
 		 */
@@ -352,8 +368,25 @@ struct Nitpicker::Main : Focus_updater, Hover_updater,
 
 	Signal_handler<Main> _timer_handler = { _env.ep(), *this, &Main::_handle_period };
 
+	/*
+	 * Frame scheduling
+	 *
+	 * Damage reported by the clients is accumulated and processed once
+	 * per frame. With a framebuffer, frames are paced by its sync signal.
+	 * Otherwise, frames are triggered by the timer at 'frame_period_ms'.
+	 */
 	unsigned long _timer_period_ms = 10;
 
+	unsigned _tile_size = Damage_map::DEFAULT_TILE_SIZE;
+
+	unsigned long _frame_cnt = 0;
+
+	void _update_timer_period()
+	{
+		if (!_framebuffer.constructed())
+			_timer.trigger_periodic(_timer_period_ms*1000);
+	}
+
 	Constructible<Framebuffer::Connection> _framebuffer { };
 
 	struct Input_connection
@@ -388,19 +421,17 @@ struct Nitpicker::Main : Focus_updater, Hover_updater,
 
 		Area size = screen.size();
 
-		typedef Genode::Dirty_rect<Rect, 3> Dirty_rect;
-
-		Dirty_rect dirty_rect { };
+		Damage_map damage_map;
 
 		/**
 		 * Constructor
 		 */
-		Framebuffer_screen(Region_map &rm, Framebuffer::Session &fb)
+		Framebuffer_screen(Region_map &rm, Framebuffer::Session &fb,
+		                   unsigned tile_size)
 		:
-			framebuffer(fb), fb_ds(rm, framebuffer.dataspace())
-		{
-			dirty_rect.mark_as_dirty(Rect(Point(0, 0), size));
-		}
+			framebuffer(fb), fb_ds(rm, framebuffer.dataspace()),
+			damage_map(size, tile_size)
+		{ }
 	};
 
 	bool _request_framebuffer = false;
@@ -485,7 +516,7 @@ struct Nitpicker::Main : Focus_updater, Hover_updater,
 	void mark_as_damaged(Rect rect) override
 	{
 		if (_fb_screen.constructed()) {
-			_fb_screen->dirty_rect.mark_as_dirty(rect);
+			_fb_screen->damage_map.mark_as_dirty(rect);
 		}
 
 		_capture_root.mark_as_damaged(rect);
@@ -739,17 +770,24 @@ void Nitpicker::Main::_handle_period()
 		handle_input_events(batch);
 	}
 
-	/* perform redraw */
-	if (_framebuffer.constructed() && _fb_screen.constructed()) {
-		/* call 'Dirty_rect::flush' on a copy to preserve the state */
-		Dirty_rect dirty_rect = _fb_screen->dirty_rect;
-		dirty_rect.flush([&] (Rect const &rect) {
-			_view_stack.draw(_fb_screen->screen, rect); });
-
-		/* flush pixels to the framebuffer, reset dirty_rect */
-		_fb_screen->dirty_rect.flush([&] (Rect const &rect) {
-			_framebuffer->refresh(rect.x1(), rect.y1(),
-			                      rect.w(),  rect.h()); });
+	/* perform redraw of the damage accumulated during the frame period */
+	if (_framebuffer.constructed() && _fb_screen.constructed()
+	 && _fb_screen->damage_map.dirty()) {
+
+		/* the time stamp is read locally, not via the timer session */
+		Trace::Timestamp const start = Trace::timestamp();
+
+		Damage_map::Flush_result const result =
+			_fb_screen->damage_map.flush([&] (Rect const &rect) {
+				_view_stack.draw(_fb_screen->screen, rect);
+				_framebuffer->refresh(rect.x1(), rect.y1(),
+				                      rect.w(),  rect.h()); });
+
+		_frame_cnt++;
+
+		trace("framebuffer frame ", _frame_cnt, ": ",
+		      result.rects, " rects, ", result.pixels, " pixels, ",
+		      Trace::timestamp() - start, " cycles");
 	}
 
 	/* deliver framebuffer synchronization events */
@@ -819,6 +857,21 @@ void Nitpicker::Main::_handle_config()
 	configure_reporter(config, _clicked_reporter);
 	configure_reporter(config, _displays_reporter);
 
+	/* update frame scheduling and damage tracking */
+	_timer_period_ms = max(1UL, config.attribute_value("frame_period_ms", 10UL));
+	_update_timer_period();
+
+	unsigned const tile_size =
+		config.attribute_value("damage_tile_size", (unsigned)Damage_map::DEFAULT_TILE_SIZE);
+
+	if (tile_size != _tile_size) {
+		_tile_size = tile_size;
+
+		if (_fb_screen.constructed())
+			_fb_screen->damage_map.configure(_fb_screen->size, _tile_size);
+	}
+	_capture_root.tile_size(_tile_size);
+
 	/* update domain registry and session policies */
 	for (Gui_session *s = _session_list.first(); s; s = s->next())
 		s->reset_domain();
@@ -909,7 +962,7 @@ void Nitpicker::Main::_handle_fb_mode()
 
 	/* reconstruct '_fb_screen' with updated mode */
 	if (_request_framebuffer && _framebuffer.constructed())
-		_fb_screen.construct(_env.rm(), *_framebuffer);
+		_fb_screen.construct(_env.rm(), *_framebuffer, _tile_size);
 
 	if (!_request_framebuffer && _fb_screen.constructed())
 		_fb_screen.destruct();
@@ -917,8 +970,7 @@ void Nitpicker::Main::_handle_fb_mode()
 	if (!_request_framebuffer && _framebuffer.constructed())
 		_framebuffer.destruct();
 
-	if (!_request_framebuffer)
-		_timer.trigger_periodic(_timer_period_ms*1000);
+	_update_timer_period();
 
 	capture_buffer_size_changed();
 }
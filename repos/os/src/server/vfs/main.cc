@@ -261,21 +261,30 @@ class Vfs_server::Session_component : private Session_resources,
 
 		bool _try_acknowledge_jobs()
 		{
-			bool progress = false;
+			/*
+			 * Collect the acknowledgements of all nodes and hand them over
+			 * to the packet stream as one batch, which results in at most
+			 * one wakeup signal for the client.
+			 */
+			enum { MAX_ACKS = ::File_system::Session::TX_QUEUE_SIZE };
+
+			Packet_descriptor acks[MAX_ACKS];
+			unsigned num_acks = 0;
+
+			unsigned const max_acks =
+				Genode::min((unsigned)MAX_ACKS, _stream.ack_slots_free());
 
 			Node_queue requeued_nodes { };
 
 			_active_nodes.dequeue_all([&] (Node &node) {
 
-				if (!_stream.ready_to_ack()) {
+				if (num_acks == max_acks) {
 					requeued_nodes.enqueue(node);
 					return;
 				}
 
-				if (node.acknowledgement_pending()) {
-					_stream.acknowledge_packet(node.dequeue_acknowledgement());
-					progress = true;
-				}
+				if (node.acknowledgement_pending())
+					acks[num_acks++] = node.dequeue_acknowledgement();
 
 				/*
 				 * If there is still another acknowledgement pending,
@@ -290,7 +299,12 @@ class Vfs_server::Session_component : private Session_resources,
 
 			_active_nodes = requeued_nodes;
 
-			return progress;
+			if (num_acks) {
+				(void)_stream.try_ack_packets(acks, num_acks);
+				_stream.wakeup();
+			}
+
+			return num_acks > 0;
 		}
 
 	public:
@@ -0,0 +1,271 @@
+/*
+ * \brief  Test for the damage-only transfer of captured frames
+ * \author agent
+ * \date   2026-10-16
+ *
+ * The test emulates a terminal that receives typed characters. For each
+ * frame, it compares the number of bytes copied by a capture client that
+ *
+ * - copies the whole frame,
+ * - copies the rectangles returned by 'capture_at', and
+ * - copies the damage list of double-buffered frames ('capture_frame').
+ *
+ * The copies are kept in local mirrors, which must eventually equal the
+ * captured screen.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/log.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/attached_ram_dataspace.h>
+#include <gui_session/connection.h>
+#include <capture_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	using Pixel = Capture::Pixel;
+	using Rect  = Capture::Rect;
+	using Point = Capture::Point;
+	using Area  = Capture::Area;
+
+	struct Terminal;
+	struct Mirror;
+	struct Main;
+}
+
+
+/**
+ * GUI client that emulates typing into a terminal
+ */
+struct Test::Terminal
+{
+	using View_handle = Gui::Session::View_handle;
+	using Command     = Gui::Session::Command;
+
+	enum { CHAR_W = 8, CHAR_H = 16 };
+
+	Area const size;
+
+	Gui::Connection _gui;
+
+	bool const _buffer_init = ( _gui.buffer({ .area = size }, false), true );
+
+	Attached_dataspace _fb_ds;
+
+	View_handle const _view = _gui.create_view(View_handle());
+
+	unsigned const _columns = size.w() / CHAR_W;
+	unsigned const _lines   = size.h() / CHAR_H;
+
+	unsigned _cursor = 0;
+	bool     _cursor_visible = false;
+
+	Rect _char_rect(unsigned pos) const
+	{
+		return Rect(Point((pos % _columns)*CHAR_W, (pos / _columns)*CHAR_H),
+		            Area(CHAR_W, CHAR_H));
+	}
+
+	void _fill(Rect rect, uint32_t color)
+	{
+		Pixel * const pixels = _fb_ds.local_addr<Pixel>();
+
+		for (int y = rect.y1(); y <= rect.y2(); y++)
+			for (int x = rect.x1(); x <= rect.x2(); x++)
+				pixels[y*size.w() + x].pixel = color;
+
+		_gui.framebuffer()->refresh(rect.x1(), rect.y1(), rect.w(), rect.h());
+	}
+
+	Terminal(Env &env, Area size)
+	:
+		size(size), _gui(env, "terminal"),
+		_fb_ds(env.rm(), _gui.framebuffer()->dataspace())
+	{
+		_gui.enqueue<Command::Geometry>(_view, Rect(Point(0, 0), size));
+		_gui.enqueue<Command::To_front>(_view, View_handle());
+		_gui.execute();
+	}
+
+	void type(char c)
+	{
+		/* draw a pseudo glyph that depends on the character */
+		_fill(_char_rect(_cursor), 0x010101u*(uint32_t)(unsigned char)c);
+
+		_cursor = (_cursor + 1) % (_columns*_lines);
+	}
+
+	void blink()
+	{
+		_cursor_visible = !_cursor_visible;
+
+		_fill(_char_rect(_cursor), _cursor_visible ? 0xffffffu : 0);
+	}
+};
+
+
+/**
+ * Local copy of the captured screen
+ */
+struct Test::Mirror
+{
+	Area const size;
+
+	Attached_ram_dataspace _ds;
+
+	uint64_t bytes = 0;
+
+	Mirror(Env &env, Area size)
+	: size(size), _ds(env.ram(), env.rm(), Capture::Session::buffer_bytes(size)) { }
+
+	void copy(Pixel const *src, Rect rect)
+	{
+		Pixel *dst = _ds.local_addr<Pixel>();
+
+		for (int y = rect.y1(); y <= rect.y2(); y++) {
+			unsigned const offset = y*size.w() + rect.x1();
+			memcpy(dst + offset, src + offset, rect.w()*sizeof(Pixel));
+		}
+
+		bytes += rect.area().count()*sizeof(Pixel);
+	}
+
+	bool equals(Pixel const *pixels) const
+	{
+		Pixel const *p = _ds.local_addr<Pixel const>();
+
+		for (unsigned i = 0; i < size.count(); i++)
+			if (p[i].pixel != pixels[i].pixel)
+				return false;
+
+		return true;
+	}
+};
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Area const _size { _config.xml().attribute_value("width",  640U),
+	                   _config.xml().attribute_value("height", 480U) };
+
+	unsigned const _frames          = _config.xml().attribute_value("frames", 500U);
+	unsigned const _chars_per_frame = _config.xml().attribute_value("chars_per_frame", 2U);
+
+	Terminal _terminal { _env, _size };
+
+	/*
+	 * Capture client using 'capture_at'
+	 */
+	Capture::Connection _capture { _env, "capture" };
+
+	bool const _capture_init = ( _capture.buffer(_size), true );
+
+	Attached_dataspace _capture_ds { _env.rm(), _capture.dataspace() };
+
+	Mirror _capture_mirror { _env, _size };
+
+	/*
+	 * Capture client using 'capture_frame'
+	 */
+	Capture::Connection _frames_capture { _env, "frames" };
+
+	bool const _frames_init = ( _frames_capture.frames(_size), true );
+
+	Attached_dataspace _frames_ds { _env.rm(), _frames_capture.dataspace() };
+
+	Mirror _frames_mirror { _env, _size };
+
+	Capture::Session::Frame _frame { };
+
+	Pixel const *_frame_pixels(unsigned buffer) const
+	{
+		return _frames_ds.local_addr<Pixel const>() + buffer*_size.count();
+	}
+
+	void _capture_at()
+	{
+		Capture::Session::Affected_rects const affected =
+			_capture.capture_at(Point(0, 0));
+
+		affected.for_each_rect([&] (Rect const &rect) {
+			_capture_mirror.copy(_capture_ds.local_addr<Pixel const>(), rect); });
+	}
+
+	void _capture_frame()
+	{
+		Capture::Session::Frame const frame =
+			_frames_capture.capture_frame(Point(0, 0));
+
+		if (!frame.valid())
+			return;
+
+		Capture::Session::Damage const &damage =
+			*(Capture::Session::Damage const *)
+				(_frames_ds.local_addr<char const>()
+				 + Capture::Session::Damage::offset(_size));
+
+		for (unsigned i = 0; i < frame.num_rects; i++)
+			_frames_mirror.copy(_frame_pixels(frame.buffer), damage.rects[i]);
+
+		_frame = frame;
+	}
+
+	void _log_bytes_per_frame(char const *what, uint64_t bytes)
+	{
+		log(what, ": ", bytes / _frames, " bytes/frame");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		/* obtain the initial screen content */
+		_capture_at();
+		_capture_frame();
+
+		_capture_mirror.bytes = _frames_mirror.bytes = 0;
+
+		char c = 'a';
+		for (unsigned i = 0; i < _frames; i++) {
+
+			for (unsigned j = 0; j < _chars_per_frame; j++) {
+				_terminal.type(c);
+				c = (c == 'z') ? 'a' : c + 1;
+			}
+			_terminal.blink();
+
+			_capture_at();
+			_capture_frame();
+		}
+
+		log("typing workload: ", _frames, " frames of ", _size, ", ",
+		    _chars_per_frame, " characters per frame");
+
+		_log_bytes_per_frame("whole frames   ", uint64_t(_frames)*Capture::Session::buffer_bytes(_size));
+		_log_bytes_per_frame("capture_at     ", _capture_mirror.bytes);
+		_log_bytes_per_frame("capture_frame  ", _frames_mirror.bytes);
+
+		bool const capture_ok = _capture_mirror.equals(_capture_ds.local_addr<Pixel const>());
+		bool const frames_ok  = _frames_mirror.equals(_frame_pixels(_frame.buffer));
+
+		if (!capture_ok) error("mirror of capture_at differs from screen");
+		if (!frames_ok)  error("mirror of capture_frame differs from screen");
+
+		_env.parent().exit(capture_ok && frames_ok ? 0 : -1);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
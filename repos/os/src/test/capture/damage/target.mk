@@ -0,0 +1,3 @@
+TARGET = test-capture_damage
+SRC_CC = main.cc
+LIBS   = base
@@ -49,6 +49,9 @@ struct Test
 	void conclusion(unsigned kib, uint64_t start_ms, uint64_t end_ms) {
 		log("throughput: ", kib / (end_ms - start_ms), " MiB/sec"); }
 
+	void pixel_conclusion(uint64_t pixels, uint64_t start_ms, uint64_t end_ms) {
+		log("throughput: ", pixels / 1000 / (end_ms - start_ms), " MPixel/sec"); }
+
 	~Test() { log("\nTEST ", id, " finished\n"); }
 
 	private:
@@ -128,20 +131,90 @@ struct Unaligned_blit_test : Test
 	}
 };
 
+struct Fill_test : Test
+{
+	static constexpr char const *brief = "32-bit fill via blit library of FB";
+
+	Fill_test(Env &env, int id) : Test(env, id, brief)
+	{
+		uint64_t       pixels   = 0;
+		uint64_t const start_ms = timer.elapsed_ms();
+		unsigned const n        = fb_mode.area.count();
+		for (unsigned i = 0; timer.elapsed_ms() - start_ms < DURATION_MS; i++) {
+			Blit::fill_32bit(fb_ds.local_addr<uint32_t>(), i, n);
+			pixels += n;
+		}
+		pixel_conclusion(pixels, start_ms, timer.elapsed_ms());
+	}
+};
+
+struct Blend_test : Test
+{
+	static constexpr char const *brief = "RGB888 alpha blending via blit library from RAM to FB";
+
+	Blend_test(Env &env, int id) : Test(env, id, brief)
+	{
+		/* use the first buffer as alpha channel with a mix of alpha values */
+		for (size_t i = 0; i < fb_ds.size(); i++)
+			buf[0][i] = (i % 4) ? (char)(i % 251) : 0;
+
+		uint64_t       pixels   = 0;
+		uint64_t const start_ms = timer.elapsed_ms();
+		unsigned const w        = fb_mode.area.w();
+		unsigned const h        = fb_mode.area.h();
+		for (; timer.elapsed_ms() - start_ms < DURATION_MS; ) {
+			for (unsigned y = 0; y < h; y++)
+				Blit::blend_rgb888(fb_ds.local_addr<uint32_t>() + y*w,
+				                   (uint32_t const *)buf[1] + y*w,
+				                   (unsigned char const *)buf[0] + y*w, w);
+			pixels += w*h;
+		}
+		pixel_conclusion(pixels, start_ms, timer.elapsed_ms());
+	}
+};
+
+struct Dither_test : Test
+{
+	static constexpr char const *brief = "RGB888 to RGB565 dithering via blit library from RAM to RAM";
+
+	Dither_test(Env &env, int id) : Test(env, id, brief)
+	{
+		uint64_t       pixels   = 0;
+		uint64_t const start_ms = timer.elapsed_ms();
+		unsigned const w        = fb_mode.area.w();
+		unsigned const h        = fb_mode.area.h();
+		for (; timer.elapsed_ms() - start_ms < DURATION_MS; ) {
+			for (unsigned y = 0; y < h; y++)
+				Blit::dither_rgb888_to_rgb565((uint16_t *)buf[0] + y*w,
+				                              (uint32_t const *)buf[1] + y*w,
+				                              w, 0, y);
+			pixels += w*h;
+		}
+		pixel_conclusion(pixels, start_ms, timer.elapsed_ms());
+	}
+};
+
 struct Main
 {
 	Constructible<Bytewise_ram_test>   test_1 { };
 	Constructible<Bytewise_fb_test>    test_2 { };
 	Constructible<Blit_test>           test_3 { };
 	Constructible<Unaligned_blit_test> test_4 { };
+	Constructible<Fill_test>           test_5 { };
+	Constructible<Blend_test>          test_6 { };
+	Constructible<Dither_test>         test_7 { };
 
 	Main(Env &env)
 	{
 		log("--- Framebuffer benchmark ---");
+		log("blit kernels: ", Blit::kernels_name());
 		test_1.construct(env, 1); test_1.destruct();
 		test_2.construct(env, 2); test_2.destruct();
 		test_3.construct(env, 3); test_3.destruct();
 		test_4.construct(env, 4); test_4.destruct();
+		test_5.construct(env, 5); test_5.destruct();
+		test_6.construct(env, 6); test_6.destruct();
+		test_7.construct(env, 7); test_7.destruct();
 		log("--- Framebuffer benchmark finished ---");
 	}
 };
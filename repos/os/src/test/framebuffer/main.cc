@@ -95,6 +95,11 @@ struct Test::Capture_session : Rpc_object<Capture::Session>
 
 		return affected;
 	}
+
+	/* double-buffered frames are not used by framebuffer drivers */
+	void frames(Area) override { }
+
+	Frame capture_frame(Point) override { return Frame { }; }
 };
 
 
@@ -0,0 +1,339 @@
+/*
+ * \brief  Throughput and latency of concurrent file-system clients
+ * \author agent
+ * \date   2026-10-16
+ *
+ * Each client opens a session to the file-system server and accesses a
+ * number of files via distinct handles. The packets are distributed over
+ * the handles in a round-robin fashion. The test first writes and then
+ * reads the files of all clients concurrently and reports the aggregate
+ * throughput and the distribution of the packet latencies.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/allocator_avl.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/component.h>
+#include <base/heap.h>
+#include <base/log.h>
+#include <file_system_session/connection.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	using File_system::Packet_descriptor;
+	using File_system::File_handle;
+	using File_system::Dir_handle;
+
+	struct Latencies;
+	struct Client;
+	struct Main;
+}
+
+
+/**
+ * Recorded packet latencies in microseconds
+ */
+struct Test::Latencies
+{
+	/*
+	 * Noncopyable
+	 */
+	Latencies(Latencies const &);
+	Latencies &operator = (Latencies const &);
+
+	Allocator &_alloc;
+
+	size_t const capacity;
+
+	uint64_t * const values = (uint64_t *)_alloc.alloc(capacity*sizeof(uint64_t));
+
+	size_t count = 0;
+
+	Latencies(Allocator &alloc, size_t capacity)
+	: _alloc(alloc), capacity(capacity) { }
+
+	~Latencies() { _alloc.free(values, capacity*sizeof(uint64_t)); }
+
+	void record(uint64_t us)
+	{
+		if (count < capacity)
+			values[count++] = us;
+	}
+
+	void sort()
+	{
+		/* shell sort */
+		for (size_t gap = count/2; gap > 0; gap /= 2)
+			for (size_t i = gap; i < count; i++)
+				for (size_t j = i; j >= gap && values[j - gap] > values[j]; j -= gap) {
+					uint64_t const v = values[j];
+					values[j]        = values[j - gap];
+					values[j - gap]  = v;
+				}
+	}
+
+	/**
+	 * Return percentile in per mille, values must be sorted
+	 */
+	uint64_t percentile(unsigned per_mille) const
+	{
+		if (!count)
+			return 0;
+
+		return values[min(count - 1, (count*per_mille)/1000)];
+	}
+};
+
+
+struct Test::Client : Noncopyable
+{
+	struct Finished_fn : Interface { virtual void client_finished() = 0; };
+
+	enum { MAX_HANDLES = 16, QUEUE_SIZE = File_system::Session::TX_QUEUE_SIZE };
+
+	Env &_env;
+
+	Timer::Connection &_timer;
+	Latencies         &_latencies;
+	Finished_fn       &_finished_fn;
+
+	size_t    const _packet_size;
+	unsigned  const _num_handles;
+	uint64_t  const _file_size;
+
+	Allocator_avl _tx_alloc;
+
+	File_system::Connection _fs;
+
+	File_system::Session::Tx::Source &_tx = *_fs.tx();
+
+	Dir_handle const _dir = _fs.dir("/", false);
+
+	unsigned long _handles[MAX_HANDLES] { };
+
+	Signal_handler<Client> _ack_handler {
+		_env.ep(), *this, &Client::_handle_ack };
+
+	Packet_descriptor::Opcode _op = Packet_descriptor::WRITE;
+
+	uint64_t _num_packets   = 0;
+	uint64_t _num_submitted = 0;
+	uint64_t _num_acked     = 0;
+
+	bool failed = false;
+
+	struct In_flight
+	{
+		bool     used;
+		off_t    offset;
+		uint64_t submit_us;
+	} _in_flight[QUEUE_SIZE] { };
+
+	uint64_t _now_us() { return _timer.curr_time().trunc_to_plain_us().value; }
+
+	void _submit_packets()
+	{
+		while (_num_submitted < _num_packets && _tx.ready_to_submit()) {
+
+			In_flight *slot = nullptr;
+			for (In_flight &s : _in_flight)
+				if (!s.used) { slot = &s; break; }
+
+			if (!slot)
+				return;
+
+			Packet_descriptor packet;
+			try { packet = _tx.alloc_packet(_packet_size); }
+			catch (File_system::Session::Tx::Source::Packet_alloc_failed) { return; }
+
+			unsigned const handle   = (unsigned)(_num_submitted % _num_handles);
+			uint64_t const position = (_num_submitted / _num_handles)*_packet_size;
+
+			if (_op == Packet_descriptor::WRITE)
+				memset(_tx.packet_content(packet), (int)position, _packet_size);
+
+			*slot = { .used      = true,
+			          .offset    = packet.offset(),
+			          .submit_us = _now_us() };
+
+			_tx.submit_packet(Packet_descriptor(packet, File_handle(_handles[handle]),
+			                                    _op, _packet_size, position));
+			_num_submitted++;
+		}
+	}
+
+	void _handle_ack()
+	{
+		while (_tx.ack_avail()) {
+
+			Packet_descriptor const packet = _tx.get_acked_packet();
+
+			for (In_flight &slot : _in_flight) {
+				if (slot.used && slot.offset == packet.offset()) {
+					_latencies.record(_now_us() - slot.submit_us);
+					slot.used = false;
+				}
+			}
+
+			if (!packet.succeeded() || packet.length() != _packet_size) {
+				error("packet at position ", packet.position(), " failed");
+				failed = true;
+			}
+
+			_tx.release_packet(packet);
+			_num_acked++;
+		}
+
+		if (_num_acked == _num_packets) {
+			_finished_fn.client_finished();
+			return;
+		}
+
+		_submit_packets();
+	}
+
+	Client(Env &env, Allocator &heap, Timer::Connection &timer,
+	       Latencies &latencies, Finished_fn &finished_fn, unsigned id,
+	       size_t packet_size, unsigned num_handles, uint64_t file_size)
+	:
+		_env(env), _timer(timer), _latencies(latencies),
+		_finished_fn(finished_fn), _packet_size(packet_size),
+		_num_handles(min(max(num_handles, 1U), (unsigned)MAX_HANDLES)),
+		_file_size(file_size), _tx_alloc(&heap),
+		_fs(env, _tx_alloc, String<32>("client", id).string(), "/", true,
+		    QUEUE_SIZE*(packet_size + 4096))
+	{
+		for (unsigned i = 0; i < _num_handles; i++)
+			_handles[i] = _fs.file(_dir, String<32>("client", id, "_file", i).string(),
+			                       File_system::READ_WRITE, true).value;
+
+		_fs.sigh_ack_avail(_ack_handler);
+		_fs.sigh_ready_to_submit(_ack_handler);
+	}
+
+	void start(Packet_descriptor::Opcode op)
+	{
+		_op            = op;
+		_num_packets   = _num_handles*(_file_size / _packet_size);
+		_num_submitted = 0;
+		_num_acked     = 0;
+
+		_submit_packets();
+	}
+
+	uint64_t bytes() const { return _num_acked*_packet_size; }
+};
+
+
+struct Test::Main : Client::Finished_fn
+{
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	unsigned const _num_clients =
+		min(_config.xml().attribute_value("clients", 4U), 16U);
+
+	size_t const _packet_size =
+		_config.xml().attribute_value("packet_size", Number_of_bytes(64*1024));
+
+	unsigned const _num_handles =
+		_config.xml().attribute_value("handles", 4U);
+
+	uint64_t const _file_size =
+		_config.xml().attribute_value("file_size", Number_of_bytes(16*1024*1024));
+
+	size_t const _packets_per_client =
+		_num_handles*(size_t)(_file_size / _packet_size);
+
+	Latencies _latencies { _heap, _num_clients*_packets_per_client };
+
+	Constructible<Client> _clients[16] { };
+
+	Packet_descriptor::Opcode _op = Packet_descriptor::WRITE;
+
+	unsigned _running  = 0;
+	uint64_t _start_us = 0;
+
+	uint64_t _now_us() { return _timer.curr_time().trunc_to_plain_us().value; }
+
+	void _start(Packet_descriptor::Opcode op)
+	{
+		_op       = op;
+		_running  = _num_clients;
+		_start_us = _now_us();
+
+		_latencies.count = 0;
+
+		for (unsigned i = 0; i < _num_clients; i++)
+			_clients[i]->start(op);
+	}
+
+	void _report()
+	{
+		uint64_t const duration_us = max(_now_us() - _start_us, (uint64_t)1);
+
+		uint64_t bytes = 0;
+		for (unsigned i = 0; i < _num_clients; i++)
+			bytes += _clients[i]->bytes();
+
+		_latencies.sort();
+
+		log(_op == Packet_descriptor::WRITE ? "write" : "read ", ": ",
+		    _num_clients, " clients, ", _num_handles, " handles each, ",
+		    Number_of_bytes(_packet_size), " packets: ",
+		    (bytes*1000*1000/duration_us)/(1024*1024), " MiB/s, "
+		    "latency p50 ", _latencies.percentile(500), " us, "
+		    "p99 ",         _latencies.percentile(990), " us, "
+		    "p99.9 ",       _latencies.percentile(999), " us, "
+		    "max ",         _latencies.percentile(1000), " us");
+	}
+
+	/**
+	 * Client::Finished_fn interface
+	 */
+	void client_finished() override
+	{
+		if (--_running)
+			return;
+
+		_report();
+
+		if (_op == Packet_descriptor::WRITE) {
+			_start(Packet_descriptor::READ);
+			return;
+		}
+
+		bool failed = false;
+		for (unsigned i = 0; i < _num_clients; i++)
+			failed |= _clients[i]->failed;
+
+		_env.parent().exit(failed ? -1 : 0);
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		for (unsigned i = 0; i < _num_clients; i++)
+			_clients[i].construct(_env, _heap, _timer, _latencies, *this, i,
+			                      _packet_size, _num_handles, _file_size);
+
+		_start(Packet_descriptor::WRITE);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,3 @@
+TARGET = test-fs_packet_load
+SRC_CC = main.cc
+LIBS   = base
@@ -0,0 +1,338 @@
+/*
+ * \brief  Test for the correctness and throughput of the internet checksum
+ * \author agent
+ * \date   2026-10-16
+ *
+ * The test compares the optimized checksum functions of the net library
+ * against a plain byte-wise reference at various sizes and alignments,
+ * checks that incrementally adapted UDP, TCP, and ICMP checksums equal fully
+ * recomputed ones, and finally measures the checksum throughput for sizes
+ * from 64 bytes to 64 KiB.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_ram_dataspace.h>
+#include <base/log.h>
+#include <timer_session/connection.h>
+#include <net/internet_checksum.h>
+#include <net/udp.h>
+#include <net/tcp.h>
+#include <net/icmp.h>
+
+namespace Test {
+
+	using namespace Genode;
+	using namespace Net;
+
+	struct Main;
+}
+
+
+struct Test::Main
+{
+	enum {
+		BUF_SIZE      = 64 * 1024 + 16,
+		MIN_SIZE      = 64,
+		MAX_SIZE      = 64 * 1024,
+		BYTES_PER_RUN = 64 * 1024 * 1024,
+	};
+
+	Env                    &_env;
+	Timer::Connection       _timer { _env };
+	Attached_ram_dataspace  _buf   { _env.ram(), _env.rm(), BUF_SIZE };
+	uint32_t                _seed  { 42 };
+
+	uint8_t *_base() { return _buf.local_addr<uint8_t>(); }
+
+	uint32_t _random()
+	{
+		_seed = _seed * 1103515245 + 12345;
+		return _seed >> 8;
+	}
+
+	/**
+	 * Straightforward RFC 1071 checksum used as reference
+	 */
+	static uint16_t _reference(uint8_t const *base, size_t size)
+	{
+		uint64_t sum = 0;
+		size_t   idx = 0;
+		for (; idx + 1 < size; idx += 2) {
+			uint16_t word;
+			memcpy(&word, &base[idx], sizeof(word));
+			sum += word;
+		}
+		if (idx < size) {
+			uint8_t const last[2] { base[idx], 0 };
+			uint16_t word;
+			memcpy(&word, last, sizeof(word));
+			sum += word;
+		}
+		while (sum >> 16) {
+			sum = (sum & 0xffff) + (sum >> 16); }
+
+		return (uint16_t)~sum;
+	}
+
+	void _test_checksum()
+	{
+		for (size_t idx = 0; idx < BUF_SIZE; idx++) {
+			_base()[idx] = (uint8_t)_random(); }
+
+		for (unsigned run = 0; run < 10000; run++) {
+
+			size_t const offset = _random() % 16;
+			size_t const size   = _random() % (run < 100 ? MAX_SIZE : 512);
+			uint8_t const *base = _base() + offset;
+
+			if (internet_checksum((Packed_uint16 const *)base, size) !=
+			    _reference(base, size))
+			{
+				error("wrong checksum at offset ", offset, " size ", size);
+				throw -1;
+			}
+		}
+		log("checksum matches reference");
+	}
+
+	void _fill(uint8_t *data, size_t size)
+	{
+		for (size_t idx = 0; idx < size; idx++) {
+			data[idx] = (uint8_t)_random(); }
+	}
+
+	Ipv4_packet &_compose_ip(Size_guard &size_guard, Ipv4_packet::Protocol prot)
+	{
+		Ipv4_packet &ip = *construct_at<Ipv4_packet>(_base());
+		size_guard.consume_head(sizeof(Ipv4_packet));
+		ip.header_length(sizeof(Ipv4_packet) / 4);
+		ip.version(4);
+		ip.time_to_live(64);
+		ip.protocol(prot);
+		ip.src(Ipv4_packet::ip_from_string("10.0.1.2"));
+		ip.dst(Ipv4_packet::ip_from_string("10.0.2.3"));
+		return ip;
+	}
+
+	/**
+	 * Rewrite addresses like a NAT does
+	 */
+	void _rewrite_ip(Ipv4_packet &ip, Internet_checksum_diff &ip_icd)
+	{
+		ip.src(Ipv4_address::from_uint32_little_endian(_random()), ip_icd);
+		ip.dst(Ipv4_address::from_uint32_little_endian(_random()), ip_icd);
+		ip.update_checksum(ip_icd);
+	}
+
+	void _test_incremental_udp()
+	{
+		for (unsigned run = 0; run < 10000; run++) {
+
+			Size_guard size_guard(MAX_SIZE);
+			Ipv4_packet &ip = _compose_ip(size_guard, Ipv4_packet::Protocol::UDP);
+
+			size_t const data_size = _random() % 1024;
+			Udp_packet &udp = ip.construct_at_data<Udp_packet>(size_guard);
+			_fill((uint8_t *)&udp + sizeof(Udp_packet), data_size);
+
+			udp.length((uint16_t)(sizeof(Udp_packet) + data_size));
+			udp.src_port(Port((uint16_t)_random()));
+			udp.dst_port(Port((uint16_t)_random()));
+			udp.update_checksum(ip.src(), ip.dst());
+			ip.total_length(sizeof(Ipv4_packet) + udp.length());
+			ip.update_checksum();
+
+			Internet_checksum_diff ip_icd { };
+			Internet_checksum_diff udp_icd { };
+			_rewrite_ip(ip, ip_icd);
+			udp.src_port(Port((uint16_t)_random()), udp_icd);
+			udp.dst_port(Port((uint16_t)_random()), udp_icd);
+			udp_icd.add_up_diff(ip_icd);
+			udp.update_checksum(udp_icd);
+
+			if (ip.checksum_error() || udp.checksum_error(ip.src(), ip.dst())) {
+				error("wrong incremental UDP checksum update");
+				throw -1;
+			}
+		}
+		log("incremental UDP update matches full recomputation");
+	}
+
+	/**
+	 * Check that an incremental UDP update that results in zero yields 0xffff
+	 *
+	 * A zero UDP checksum means that the sender did not compute a checksum
+	 * (RFC 768), so a computed zero must be transmitted as all ones.
+	 */
+	void _test_incremental_udp_zero()
+	{
+		for (unsigned run = 0; run < 100; run++) {
+
+			Size_guard size_guard(MAX_SIZE);
+			Ipv4_packet &ip = _compose_ip(size_guard, Ipv4_packet::Protocol::UDP);
+
+			enum { DATA_SIZE = 64 };
+			Udp_packet &udp = ip.construct_at_data<Udp_packet>(size_guard);
+			uint8_t *data = (uint8_t *)&udp + sizeof(Udp_packet);
+			_fill(data, DATA_SIZE);
+			udp.length((uint16_t)(sizeof(Udp_packet) + DATA_SIZE));
+
+			Ipv4_address const src      = ip.src();
+			Ipv4_address const dst      = ip.dst();
+			Port         const src_port = Port((uint16_t)_random());
+			Port         const dst_port = Port((uint16_t)_random());
+			Ipv4_address const nat_src  = Ipv4_address::from_uint32_little_endian(_random());
+			Port         const nat_port = Port((uint16_t)_random());
+
+			/*
+			 * Choose the first data word such that the one's complement sum
+			 * over the packet after the rewrite becomes 0xffff, which leaves
+			 * a computed checksum of zero.
+			 */
+			ip.src(nat_src);
+			udp.src_port(nat_port);
+			udp.dst_port(dst_port);
+			data[0] = data[1] = 0;
+			udp.update_checksum(ip.src(), dst);
+			uint16_t const word = host_to_big_endian(udp.checksum());
+			memcpy(data, &word, sizeof(word));
+
+			/* compose the packet as sent by the client */
+			ip.src(src);
+			udp.src_port(src_port);
+			udp.update_checksum(ip.src(), dst);
+
+			Internet_checksum_diff ip_icd { };
+			Internet_checksum_diff udp_icd { };
+			ip.src(nat_src, ip_icd);
+			udp.src_port(nat_port, udp_icd);
+			udp_icd.add_up_diff(ip_icd);
+			udp.update_checksum(udp_icd);
+
+			if (udp.checksum() != 0xffff || udp.checksum_error(ip.src(), dst)) {
+				error("incremental UDP update yields checksum ",
+				      Hex(udp.checksum()), " instead of 0xffff");
+				throw -1;
+			}
+		}
+		log("incremental UDP update maps zero to 0xffff");
+	}
+
+	void _test_incremental_tcp()
+	{
+		for (unsigned run = 0; run < 10000; run++) {
+
+			Size_guard size_guard(MAX_SIZE);
+			Ipv4_packet &ip = _compose_ip(size_guard, Ipv4_packet::Protocol::TCP);
+
+			size_t const data_size = _random() % 1024;
+			size_t const tcp_size  = sizeof(Tcp_packet) + data_size;
+			Tcp_packet &tcp = ip.construct_at_data<Tcp_packet>(size_guard);
+			_fill((uint8_t *)&tcp, tcp_size);
+
+			tcp.update_checksum(ip.src(), ip.dst(), tcp_size);
+			ip.total_length(sizeof(Ipv4_packet) + tcp_size);
+			ip.update_checksum();
+
+			Internet_checksum_diff ip_icd { };
+			Internet_checksum_diff tcp_icd { };
+			_rewrite_ip(ip, ip_icd);
+			tcp.src_port(Port((uint16_t)_random()), tcp_icd);
+			tcp.dst_port(Port((uint16_t)_random()), tcp_icd);
+			tcp_icd.add_up_diff(ip_icd);
+			tcp.update_checksum(tcp_icd);
+
+			Ipv4_address ip_src = ip.src();
+			Ipv4_address ip_dst = ip.dst();
+			if (ip.checksum_error() ||
+			    internet_checksum_pseudo_ip((Packed_uint16 *)&tcp, tcp_size,
+			                                host_to_big_endian((uint16_t)tcp_size),
+			                                Ipv4_packet::Protocol::TCP,
+			                                ip_src, ip_dst))
+			{
+				error("wrong incremental TCP checksum update");
+				throw -1;
+			}
+		}
+		log("incremental TCP update matches full recomputation");
+	}
+
+	void _test_incremental_icmp()
+	{
+		for (unsigned run = 0; run < 10000; run++) {
+
+			Size_guard size_guard(MAX_SIZE);
+			Ipv4_packet &ip = _compose_ip(size_guard, Ipv4_packet::Protocol::ICMP);
+
+			size_t const data_size = _random() % 1024;
+			Icmp_packet &icmp = ip.construct_at_data<Icmp_packet>(size_guard);
+			_fill((uint8_t *)&icmp + sizeof(Icmp_packet), data_size);
+
+			icmp.type(Icmp_packet::Type::ECHO_REQUEST);
+			icmp.code(Icmp_packet::Code::ECHO_REQUEST);
+			icmp.query_id((uint16_t)_random());
+			icmp.query_seq((uint16_t)_random());
+			icmp.update_checksum(data_size);
+			ip.total_length(sizeof(Ipv4_packet) + sizeof(Icmp_packet) + data_size);
+			ip.update_checksum();
+
+			/* the ICMP checksum does not cover the IP addresses */
+			Internet_checksum_diff ip_icd { };
+			Internet_checksum_diff icmp_icd { };
+			_rewrite_ip(ip, ip_icd);
+			icmp.query_id((uint16_t)_random(), icmp_icd);
+			icmp.update_checksum(icmp_icd);
+
+			if (ip.checksum_error() || icmp.checksum_error(data_size)) {
+				error("wrong incremental ICMP checksum update");
+				throw -1;
+			}
+		}
+		log("incremental ICMP update matches full recomputation");
+	}
+
+	void _measure_throughput()
+	{
+		for (size_t size = MIN_SIZE; size <= MAX_SIZE; size *= 2) {
+
+			unsigned long const runs = BYTES_PER_RUN / size;
+			uint16_t volatile result = 0;
+
+			uint64_t const start_us = _timer.elapsed_us();
+			for (unsigned long run = 0; run < runs; run++) {
+				result = (uint16_t)(result +
+					internet_checksum((Packed_uint16 const *)_base(), size)); }
+
+			uint64_t const duration_us =
+				max(_timer.elapsed_us() - start_us, (uint64_t)1);
+
+			log("size ", size, " bytes: ",
+			    ((uint64_t)BYTES_PER_RUN / duration_us), " MB/s");
+		}
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- internet checksum test ---");
+
+		_test_checksum();
+		_test_incremental_udp();
+		_test_incremental_udp_zero();
+		_test_incremental_tcp();
+		_test_incremental_icmp();
+		_measure_throughput();
+
+		log("--- internet checksum test finished ---");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
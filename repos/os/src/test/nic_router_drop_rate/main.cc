@@ -0,0 +1,206 @@
+/*
+ * \brief  Benchmark for the drop rate of the NIC router
+ * \author agent
+ * \date   2026-10-16
+ *
+ * The benchmark floods the NIC router with traffic that it cannot route or
+ * that it has to drop as malformed and reports the rate at which the router
+ * acknowledges the packets. The router is expected to attach the session of
+ * the benchmark to a domain without any routing rules. Each traffic class is
+ * sent for a fixed number of packets:
+ *
+ * unmatched  - UDP packets to a foreign IP address without a matching rule
+ * no_ipv4    - Ethernet frames of an unknown network-layer protocol
+ * bad_icmp   - ICMP echo requests with a wrong checksum
+ * fragment   - fragmented IPv4 packets
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+#include <base/heap.h>
+#include <base/log.h>
+#include <nic_session/connection.h>
+#include <nic/packet_allocator.h>
+#include <timer_session/connection.h>
+#include <net/ethernet.h>
+#include <net/ipv4.h>
+#include <net/udp.h>
+#include <net/icmp.h>
+
+namespace Test {
+
+	using namespace Genode;
+	using namespace Net;
+
+	struct Main;
+}
+
+
+struct Test::Main
+{
+	enum Traffic { UNMATCHED, NO_IPV4, BAD_ICMP, FRAGMENT };
+
+	enum {
+		PKT_SIZE    = 128,
+		BUF_SIZE    = 1000 * ::Nic::Packet_allocator::DEFAULT_PACKET_SIZE,
+		NUM_PACKETS = 200000,
+	};
+
+	Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	::Nic::Packet_allocator _pkt_alloc { &_heap };
+
+	::Nic::Connection _nic { _env, &_pkt_alloc, BUF_SIZE, BUF_SIZE };
+
+	Ipv4_address const _src_ip  { Ipv4_packet::ip_from_string("10.0.1.2") };
+	Ipv4_address const _dst_ip  { Ipv4_packet::ip_from_string("10.0.1.1") };
+	Ipv4_address const _ext_ip  { Ipv4_packet::ip_from_string("192.168.7.7") };
+
+	static char const *_name(Traffic traffic)
+	{
+		switch (traffic) {
+		case UNMATCHED: return "unmatched";
+		case NO_IPV4:   return "no_ipv4  ";
+		case BAD_ICMP:  return "bad_icmp ";
+		case FRAGMENT:  return "fragment ";
+		}
+		return "?";
+	}
+
+	Ipv4_packet &_ipv4(Ethernet_frame &eth, Size_guard &size_guard,
+	                   Ipv4_address const &dst, Ipv4_packet::Protocol prot)
+	{
+		Ipv4_packet &ip = eth.construct_at_data<Ipv4_packet>(size_guard);
+		ip.header_length(sizeof(Ipv4_packet) / 4);
+		ip.version(4);
+		ip.time_to_live(64);
+		ip.protocol(prot);
+		ip.src(_src_ip);
+		ip.dst(dst);
+		return ip;
+	}
+
+	void _write(Traffic traffic, void *base, unsigned seq)
+	{
+		Size_guard size_guard(PKT_SIZE);
+		Ethernet_frame &eth = Ethernet_frame::construct_at(base, size_guard);
+		eth.dst(Mac_address(0xff));
+		eth.src(_nic.mac_address());
+		eth.type(traffic == NO_IPV4 ? (Ethernet_frame::Type)0x86dd
+		                            : Ethernet_frame::Type::IPV4);
+		if (traffic == NO_IPV4)
+			return;
+
+		size_t const ip_off = size_guard.head_size();
+
+		switch (traffic) {
+		case UNMATCHED:
+			{
+				Ipv4_packet &ip = _ipv4(eth, size_guard, _ext_ip,
+				                        Ipv4_packet::Protocol::UDP);
+				size_t const udp_off = size_guard.head_size();
+				Udp_packet &udp = ip.construct_at_data<Udp_packet>(size_guard);
+				udp.src_port(Port((uint16_t)(1024 + (seq & 0x7fff))));
+				udp.dst_port(Port(7));
+				udp.length((uint16_t)(size_guard.head_size() - udp_off));
+				udp.update_checksum(ip.src(), ip.dst());
+				ip.total_length(size_guard.head_size() - ip_off);
+				ip.update_checksum();
+				break;
+			}
+		case BAD_ICMP:
+			{
+				Ipv4_packet &ip = _ipv4(eth, size_guard, _dst_ip,
+				                        Ipv4_packet::Protocol::ICMP);
+				Icmp_packet &icmp = ip.construct_at_data<Icmp_packet>(size_guard);
+				icmp.type(Icmp_packet::Type::ECHO_REQUEST);
+				icmp.code(Icmp_packet::Code::ECHO_REQUEST);
+				icmp.query_id(1);
+				icmp.query_seq((uint16_t)seq);
+				icmp.checksum(0xdead);
+				ip.total_length(size_guard.head_size() - ip_off);
+				ip.update_checksum();
+				break;
+			}
+		case FRAGMENT:
+			{
+				Ipv4_packet &ip = _ipv4(eth, size_guard, _ext_ip,
+				                        Ipv4_packet::Protocol::UDP);
+				ip.more_fragments(true);
+				ip.total_length(size_guard.head_size() - ip_off);
+				ip.update_checksum();
+				break;
+			}
+		default: break;
+		}
+	}
+
+	/**
+	 * Acknowledge all packets the router sent to us, e.g., ICMP errors
+	 */
+	void _drain_rx()
+	{
+		auto &sink = *_nic.rx();
+		while (sink.packet_avail() && sink.ready_to_ack())
+			sink.acknowledge_packet(sink.get_packet());
+	}
+
+	void _measure(Traffic traffic)
+	{
+		auto &source = *_nic.tx();
+
+		unsigned long submitted = 0;
+		unsigned long acked     = 0;
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		while (acked < NUM_PACKETS) {
+
+			while (submitted < NUM_PACKETS && source.ready_to_submit()) {
+				Packet_descriptor pkt;
+				try { pkt = source.alloc_packet(PKT_SIZE); }
+				catch (::Nic::Session::Tx::Source::Packet_alloc_failed) { break; }
+
+				_write(traffic, source.packet_content(pkt), (unsigned)submitted);
+				source.submit_packet(pkt);
+				submitted++;
+			}
+			while (source.ack_avail()) {
+				source.release_packet(source.get_acked_packet());
+				acked++;
+			}
+			_drain_rx();
+		}
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ULL);
+
+		log(_name(traffic), " packets=", acked,
+		    " duration=", duration_us/1000, " ms"
+		    " rate=", (acked*1000000ULL)/duration_us, " packets/s");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- nic_router drop-rate benchmark ---");
+
+		_measure(UNMATCHED);
+		_measure(NO_IPV4);
+		_measure(BAD_ICMP);
+		_measure(FRAGMENT);
+
+		log("--- nic_router drop-rate benchmark finished ---");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
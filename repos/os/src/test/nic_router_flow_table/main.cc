@@ -0,0 +1,169 @@
+/*
+ * \brief  Microbenchmark for the connection-tracking table of the NIC router
+ * \author agent
+ * \date   2026-10-16
+ *
+ * The benchmark fills the hash table that the NIC router uses for looking
+ * up links by their 5-tuple with 1k, 10k, and 100k flows. Afterwards, it
+ * performs lookups in a pseudo-random order that resembles interleaved
+ * traffic of all flows and reports the lookup rate as well as the 99th
+ * percentile of the per-lookup latency in timestamp ticks.
+ *
+ * Only the flow-table lookup is measured, which the router performs once
+ * for each forwarded packet. The remaining per-packet work, e.g., parsing,
+ * NAT rewriting, and checksum updates, is not part of the reported
+ * latency.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+#include <base/heap.h>
+#include <base/log.h>
+#include <timer_session/connection.h>
+#include <trace/timestamp.h>
+#include <util/construct_at.h>
+
+/* NIC-router includes */
+#include <hash_table.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Flow_id;
+	struct Flow;
+	struct Main;
+
+	using Flow_table = Net::Hash_table<Flow, Flow_id>;
+}
+
+
+struct Test::Flow_id
+{
+	uint32_t src_ip;
+	uint16_t src_port;
+	uint32_t dst_ip;
+	uint16_t dst_port;
+
+	uint32_t hash(uint32_t seed) const {
+		return Net::hash_bytes(this, sizeof(*this), seed); }
+
+	bool operator == (Flow_id const &id) const
+	{
+		return id.src_ip   == src_ip   && id.src_port == src_port &&
+		       id.dst_ip   == dst_ip   && id.dst_port == dst_port;
+	}
+}
+__attribute__((__packed__));
+
+
+struct Test::Flow
+{
+	Flow_id const _id;
+
+	Flow(Flow_id const &id) : _id(id) { }
+
+	Flow_id const &id() const { return _id; }
+};
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	enum {
+		NUM_LOOKUPS    = 1UL << 22,
+		NUM_BUCKETS    = 1024,
+		TICKS_PER_BKT  = 8,
+	};
+
+	/* histogram of per-lookup latencies, the last bucket catches outliers */
+	unsigned long _latency[NUM_BUCKETS];
+
+	static Flow_id _flow_id(unsigned i)
+	{
+		/* clients of a 10.0.0.0/16 network talking to one server port */
+		return Flow_id { 0x0a000000u | (i >> 8), (uint16_t)(1024 + (i & 0xff)),
+		                 0xc0a80001u, 443 };
+	}
+
+	unsigned long _p99_ticks() const
+	{
+		unsigned long const threshold = NUM_LOOKUPS - NUM_LOOKUPS / 100;
+		unsigned long sum = 0;
+		for (unsigned i = 0; i < NUM_BUCKETS; i++) {
+			sum += _latency[i];
+			if (sum >= threshold)
+				return (i + 1) * TICKS_PER_BKT;
+		}
+		return NUM_BUCKETS * TICKS_PER_BKT;
+	}
+
+	void _measure(unsigned num_flows)
+	{
+		Allocator &alloc = _heap;
+		Flow_table table { alloc };
+
+		Flow *flows = (Flow *)alloc.alloc(num_flows * sizeof(Flow));
+		for (unsigned i = 0; i < num_flows; i++)
+			table.insert(*construct_at<Flow>(&flows[i], _flow_id(i)));
+
+		for (unsigned i = 0; i < NUM_BUCKETS; i++)
+			_latency[i] = 0;
+
+		unsigned long found = 0;
+		unsigned      idx   = 0;
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned long i = 0; i < NUM_LOOKUPS; i++) {
+
+			/* step through the flows in a cache-unfriendly order */
+			idx = (idx + 7919) % num_flows;
+			Flow_id const id = _flow_id(idx);
+
+			Trace::Timestamp const start = Trace::timestamp();
+			Flow const *flow = table.find_by_id(id);
+			Trace::Timestamp const ticks = Trace::timestamp() - start;
+
+			found += (flow == &flows[idx]);
+			_latency[min(ticks / TICKS_PER_BKT, (Trace::Timestamp)NUM_BUCKETS - 1)]++;
+		}
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ULL);
+
+		log("flows=", num_flows, " lookups=", (unsigned long)NUM_LOOKUPS,
+		    " found=", found, " duration=", duration_us/1000, " ms"
+		    " throughput=", (NUM_LOOKUPS*1000000ULL)/duration_us, " lookups/s"
+		    " lookup_p99=", _p99_ticks(), " ticks");
+
+		for (unsigned i = 0; i < num_flows; i++)
+			table.remove(flows[i]);
+
+		_heap.free(flows, num_flows * sizeof(Flow));
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- nic_router flow-table benchmark ---");
+
+		_measure(1000);
+		_measure(10000);
+		_measure(100000);
+
+		log("--- nic_router flow-table benchmark finished ---");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,4 @@
+TARGET   = test-nic_router_flow_table
+SRC_CC   = main.cc
+LIBS     = base
+INC_DIR += $(REP_DIR)/src/server/nic_router
@@ -0,0 +1,225 @@
+/*
+ * \brief  Microbenchmark for batched packet-stream operations
+ * \author agent
+ * \date   2026-10-16
+ *
+ * The benchmark drives a packet-stream source and sink that share one
+ * communication buffer within the same component. It measures the
+ * throughput of the submit-get-ack cycle for the per-packet API
+ * and for batches of 1 to 256 packet descriptors. The packets are allocated
+ * once and re-submitted in each round so that only the queue handling and
+ * the wakeup signalling are measured.
+ *
+ * Before the measurement, the batch operations of the descriptor queue are
+ * checked to stay within the queue when the peer-controlled head and tail
+ * indices hold out-of-range values.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+#include <base/heap.h>
+#include <base/allocator_avl.h>
+#include <base/attached_ram_dataspace.h>
+#include <base/log.h>
+#include <os/packet_stream.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Main;
+
+	void check_queue_bounds();
+
+	enum { QUEUE_SIZE = 512, MAX_BATCH = 256 };
+
+	typedef Packet_stream_policy<Packet_descriptor, QUEUE_SIZE, QUEUE_SIZE, char>
+	        Policy;
+
+	typedef Packet_stream_source<Policy> Source;
+	typedef Packet_stream_sink<Policy>   Sink;
+}
+
+
+void Test::check_queue_bounds()
+{
+	enum { SIZE = 8, GUARD = 16 };
+
+	typedef Packet_descriptor_queue<Packet_descriptor, SIZE> Queue;
+
+	struct Guarded_queue
+	{
+		unsigned long lo[GUARD];
+		Queue         queue { Queue::PRODUCER };
+		unsigned long hi[GUARD];
+
+		Guarded_queue()
+		{
+			for (unsigned i = 0; i < GUARD; i++)
+				lo[i] = hi[i] = ~0UL;
+		}
+
+		/*
+		 * Mimic a peer that writes arbitrary values to the indices, which
+		 * are the first two members of the shared queue
+		 */
+		void indices(unsigned head, unsigned tail)
+		{
+			unsigned volatile * const index = (unsigned volatile *)&queue;
+			index[0] = head;
+			index[1] = tail;
+		}
+
+		bool intact() const
+		{
+			for (unsigned i = 0; i < GUARD; i++)
+				if (lo[i] != ~0UL || hi[i] != ~0UL)
+					return false;
+			return true;
+		}
+	};
+
+	struct Indices { unsigned head, tail; } const indices[] = {
+		{ ~0U, 0 }, { 0, ~0U }, { ~0U, ~0U }, { 1000, 3 },
+		{ 5, 1000 }, { 1U << 31, SIZE }, { SIZE, SIZE - 1 } };
+
+	static Guarded_queue guarded;
+
+	Packet_descriptor batch[2*SIZE];
+	for (unsigned i = 0; i < 2*SIZE; i++)
+		batch[i] = Packet_descriptor(~0UL, ~0UL);
+
+	for (Indices const &idx : indices) {
+
+		guarded.indices(idx.head, idx.tail);
+		unsigned const added = guarded.queue.add(batch, 2*SIZE);
+
+		guarded.indices(idx.head, idx.tail);
+		unsigned const got = guarded.queue.get(batch, 2*SIZE);
+
+		if (!guarded.intact() || added >= SIZE || got >= SIZE) {
+			error("batch operation out of bounds for head=", idx.head,
+			      " tail=", idx.tail, " added=", added, " got=", got);
+			throw Exception();
+		}
+	}
+
+	log("batch operations stay in bounds with out-of-range indices");
+}
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	Attached_ram_dataspace _buffer { _env.ram(), _env.rm(), 1024*1024 };
+
+	Allocator_avl _packet_alloc { &_heap };
+
+	Source _source { _buffer.cap(), _env.rm(), _packet_alloc };
+	Sink   _sink   { _buffer.cap(), _env.rm() };
+
+	/* the benchmark is driven synchronously, signals are merely delivered */
+	void _handle_signal() { }
+
+	Signal_handler<Main> _handler { _env.ep(), *this, &Main::_handle_signal };
+
+	Packet_descriptor _packets[MAX_BATCH];
+	Packet_descriptor _batch  [MAX_BATCH];
+
+	enum { NUM_PACKETS = 1UL << 20 };
+
+	/**
+	 * Process one round of packets via the per-packet API
+	 */
+	void _round_single(unsigned num)
+	{
+		for (unsigned i = 0; i < num; i++) {
+			_source.try_submit_packet(_packets[i]);
+			_source.wakeup();
+		}
+
+		for (unsigned i = 0; i < num; i++) {
+			_sink.try_ack_packet(_sink.try_get_packet());
+			_sink.wakeup();
+		}
+
+		for (unsigned i = 0; i < num; i++) {
+			(void)_source.try_get_acked_packet();
+			_source.wakeup();
+		}
+	}
+
+	/**
+	 * Process one round of packets via the batch API
+	 */
+	void _round_batched(unsigned num)
+	{
+		_source.try_submit_packets(_packets, num);
+		_source.wakeup();
+
+		unsigned const received = _sink.try_get_packets(_batch, num);
+		_sink.try_ack_packets(_batch, received);
+		_sink.wakeup();
+
+		(void)_source.try_get_acked_packets(_batch, num);
+		_source.wakeup();
+	}
+
+	template <typename FN>
+	void _measure(char const *mode, unsigned batch_size, FN const &round_fn)
+	{
+		unsigned long const rounds = NUM_PACKETS / batch_size;
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned long i = 0; i < rounds; i++)
+			round_fn(batch_size);
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ULL);
+
+		log(mode, " batch_size=", batch_size, " packets=", rounds*batch_size,
+		    " duration=", duration_us/1000, " ms"
+		    " throughput=", (rounds*batch_size*1000000ULL)/duration_us,
+		    " packets/s");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		_source.register_sigh_packet_avail(_handler);
+		_source.register_sigh_ready_to_ack(_handler);
+		_sink.register_sigh_ack_avail(_handler);
+		_sink.register_sigh_ready_to_submit(_handler);
+
+		for (unsigned i = 0; i < MAX_BATCH; i++)
+			_packets[i] = _source.alloc_packet(64);
+
+		log("--- packet-stream batch benchmark ---");
+
+		check_queue_bounds();
+
+		_measure("single ", 1, [&] (unsigned n) { _round_single(n); });
+
+		for (unsigned batch_size = 1; batch_size <= MAX_BATCH; batch_size <<= 1)
+			_measure("batched", batch_size, [&] (unsigned n) { _round_batched(n); });
+
+		for (unsigned i = 0; i < MAX_BATCH; i++)
+			_source.release_packet(_packets[i]);
+
+		log("--- packet-stream batch benchmark finished ---");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
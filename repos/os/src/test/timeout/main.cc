@@ -18,6 +18,7 @@
 #include <util/fifo.h>
 #include <util/misc_math.h>
 #include <base/attached_rom_dataspace.h>
+#include <base/heap.h>
 
 using namespace Genode;
 
@@ -783,6 +784,86 @@ struct Fast_polling : Test
 };
 
 
+struct Scheduling_costs : Test
+{
+	static constexpr char const *brief = "measure costs of scheduling and discarding timeouts";
+
+	/*
+	 * The timeouts are scheduled with durations of at least 10 seconds,
+	 * they are always discarded before they trigger.
+	 */
+	enum { MIN_DURATION_US  = 10000000 };
+	enum { DURATION_MASK_US = (1 << 29) - 1 };
+	enum { MIN_OPERATIONS   = 100000 };
+
+	struct Handler : Timeout_handler
+	{
+		void handle_timeout(Duration) override { }
+	};
+
+	Heap    heap    { env.ram(), env.rm() };
+	Handler handler { };
+
+	uint64_t curr_time_us() {
+		return timer.curr_time().trunc_to_plain_us().value; }
+
+	void measure(unsigned const nr_of_timeouts)
+	{
+		Allocator        &alloc    = heap;
+		Genode::Timeout **timeouts = (Genode::Timeout **)
+			alloc.alloc(sizeof(Genode::Timeout *) * nr_of_timeouts);
+
+		for (unsigned i = 0; i < nr_of_timeouts; i++)
+			timeouts[i] = new (heap) Genode::Timeout(timer);
+
+		unsigned const rounds      = max(1U, MIN_OPERATIONS / nr_of_timeouts);
+		uint64_t       schedule_us = 0;
+		uint64_t       discard_us  = 0;
+		uint32_t       seed        = 1;
+
+		for (unsigned round = 0; round < rounds; round++) {
+
+			uint64_t const start_us = curr_time_us();
+			for (unsigned i = 0; i < nr_of_timeouts; i++) {
+				seed = seed * 1103515245 + 12345;
+				timeouts[i]->schedule_one_shot(
+					Microseconds(MIN_DURATION_US + (seed & DURATION_MASK_US)),
+					handler);
+			}
+			uint64_t const scheduled_us = curr_time_us();
+			for (unsigned i = 0; i < nr_of_timeouts; i++)
+				timeouts[i]->discard();
+
+			uint64_t const discarded_us = curr_time_us();
+			schedule_us += scheduled_us - start_us;
+			discard_us  += discarded_us - scheduled_us;
+		}
+		uint64_t const nr_of_ops = (uint64_t)rounds * nr_of_timeouts;
+		log(nr_of_timeouts, " timeouts: schedule ",
+		    (schedule_us * 1000) / nr_of_ops, " ns, discard ",
+		    (discard_us * 1000) / nr_of_ops, " ns per operation");
+
+		for (unsigned i = 0; i < nr_of_timeouts; i++)
+			destroy(heap, timeouts[i]);
+
+		heap.free(timeouts, sizeof(Genode::Timeout *) * nr_of_timeouts);
+	}
+
+	Scheduling_costs(Env                       &env,
+	                 unsigned                  &error_cnt,
+	                 Signal_context_capability  done,
+	                 unsigned                   id)
+	:
+		Test(env, error_cnt, done, id, brief)
+	{
+		measure(10);
+		measure(1000);
+		measure(100000);
+		Test::done.submit();
+	}
+};
+
+
 struct Main
 {
 	Env                           &env;
@@ -791,10 +872,12 @@ struct Main
 	Constructible<Duration_test>   test_1      { };
 	Constructible<Fast_polling>    test_2      { };
 	Constructible<Mixed_timeouts>  test_3      { };
+	Constructible<Scheduling_costs> test_4     { };
 	Signal_handler<Main>           test_0_done { env.ep(), *this, &Main::handle_test_0_done };
 	Signal_handler<Main>           test_1_done { env.ep(), *this, &Main::handle_test_1_done };
 	Signal_handler<Main>           test_2_done { env.ep(), *this, &Main::handle_test_2_done };
 	Signal_handler<Main>           test_3_done { env.ep(), *this, &Main::handle_test_3_done };
+	Signal_handler<Main>           test_4_done { env.ep(), *this, &Main::handle_test_4_done };
 
 	Main(Env &env) : env(env)
 	{
@@ -822,6 +905,12 @@ struct Main
 	void handle_test_3_done()
 	{
 		test_3.destruct();
+		test_4.construct(env, error_cnt, test_4_done, 4);
+	}
+
+	void handle_test_4_done()
+	{
+		test_4.destruct();
 		if (error_cnt) {
 			error("test failed because of ", error_cnt, " error(s)");
 			env.parent().exit(-1);
@@ -0,0 +1,110 @@
+/*
+ * \brief  Microbenchmark for the path resolution of the VFS
+ * \author agent
+ * \date   2026-10-16
+ *
+ * The benchmark stats each path given as '<lookup path="..."/>' node of the
+ * config repeatedly and reports the lookup rate along with the hit and miss
+ * counters of the lookup cache of the VFS root.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+#include <base/heap.h>
+#include <base/log.h>
+#include <base/attached_rom_dataspace.h>
+#include <timer_session/connection.h>
+#include <vfs/file_system_factory.h>
+#include <vfs/dir_file_system.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Main;
+}
+
+
+struct Test::Main : Vfs::Env
+{
+	Genode::Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Vfs::Global_file_system_factory _fs_factory { _heap };
+
+	Vfs::Dir_file_system _root_dir { *this, _config.xml().sub_node("vfs"), _fs_factory };
+
+	enum { ROUNDS = 100000, MAX_PATHS = 32 };
+
+	typedef String<Vfs::MAX_PATH_LEN> Path;
+
+	Path     _paths[MAX_PATHS];
+	unsigned _num_paths = 0;
+
+	/**
+	 * Vfs::Env interface
+	 */
+	Genode::Env      &env()      override { return _env; }
+	Allocator        &alloc()    override { return _heap; }
+	Vfs::File_system &root_dir() override { return _root_dir; }
+
+	void _measure(char const *label)
+	{
+		unsigned long lookups = 0, found = 0;
+
+		Vfs::Dir_file_system::Lookup_stats const stats = _root_dir.lookup_stats();
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned i = 0; i < ROUNDS; i++) {
+			for (unsigned j = 0; j < _num_paths; j++) {
+
+				Vfs::Directory_service::Stat stat { };
+				if (_root_dir.stat(_paths[j].string(), stat) == Vfs::Directory_service::STAT_OK)
+					found++;
+				lookups++;
+			}
+		}
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ULL);
+
+		Vfs::Dir_file_system::Lookup_stats const now = _root_dir.lookup_stats();
+
+		log(label, ": lookups=", lookups, " found=", found,
+		    " duration=", duration_us/1000, " ms"
+		    " throughput=", (lookups*1000000ULL)/duration_us, " lookups/s"
+		    " hits=", now.hits - stats.hits, " misses=", now.misses - stats.misses);
+	}
+
+	Main(Genode::Env &env) : _env(env)
+	{
+		log("--- VFS lookup benchmark ---");
+
+		_config.xml().for_each_sub_node("lookup", [&] (Xml_node node) {
+			if (_num_paths < MAX_PATHS)
+				_paths[_num_paths++] = node.attribute_value("path", Path()); });
+
+		_measure("warm-up");
+		_measure("cached");
+
+		/* a config update flushes the cache */
+		_root_dir.apply_config(_config.xml().sub_node("vfs"));
+		_measure("after config update");
+
+		log("--- VFS lookup benchmark finished ---");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
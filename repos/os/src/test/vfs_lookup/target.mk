@@ -0,0 +1,3 @@
+TARGET = test-vfs_lookup
+SRC_CC = main.cc
+LIBS   = base vfs